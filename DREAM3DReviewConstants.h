@@ -153,6 +153,8 @@ const QString SubsurfaceFeatures("SubsurfaceFeatures");
 
 const QString SurfaceMeshCSLBoundary("SurfaceMeshCSLBoundary");
 const QString SurfaceMeshCSLBoundaryIncoherence("SurfaceMeshCSLBoundaryIncoherence");
+const QString SurfaceMeshCSLSigma("SurfaceMeshCSLSigma");
+const QString SurfaceMeshMisorientations("SurfaceMeshMisorientations");
 
 namespace CSL
 {
@@ -14,7 +14,10 @@
 
 #include "CombineStlFiles.h"
 
+#include <cmath>
 #include <cstring>
+#include <limits>
+#include <unordered_map>
 
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
@@ -22,17 +25,214 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+/**
+ * @brief Runs one ReadStlFile instance per input file. Every file is read into its
+ * own DataContainerArray, so the readers do not share any state.
+ */
+class ReadStlFilesImpl
+{
+public:
+  ReadStlFilesImpl(const IFilterFactory::Pointer& factory, const QFileInfoList& fileList, std::vector<DataContainerArray::Pointer>& dcas, std::vector<int32_t>& errors)
+  : m_Factory(factory)
+  , m_FileList(fileList)
+  , m_Dcas(dcas)
+  , m_Errors(errors)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const QFileInfo& file = m_FileList.at(static_cast<int>(i));
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      AbstractFilter::Pointer reader = m_Factory->create();
+      reader->setDataContainerArray(dca);
+
+      QVariant var;
+      var.setValue(file.canonicalFilePath());
+      reader->setProperty("StlFilePath", var);
+      var.setValue(file.baseName());
+      reader->setProperty("SurfaceMeshDataContainerName", var);
+      var.setValue(SIMPL::Defaults::FaceAttributeMatrixName);
+      reader->setProperty("FaceAttributeMatrixName", var);
+      var.setValue(SIMPL::FaceData::SurfaceMeshFaceNormals);
+      reader->setProperty("FaceNormalsArrayName", var);
+      reader->execute();
+
+      m_Errors[i] = reader->getErrorCode();
+      m_Dcas[i] = dca;
+    }
+  }
+
+private:
+  const IFilterFactory::Pointer& m_Factory;
+  const QFileInfoList& m_FileList;
+  std::vector<DataContainerArray::Pointer>& m_Dcas;
+  std::vector<int32_t>& m_Errors;
+};
+
+/**
+ * @brief Copies the triangles, vertices and face normals of the individual STL
+ * geometries into their slots of the combined geometry
+ */
+class CopyStlGeometriesImpl
+{
+public:
+  CopyStlGeometriesImpl(const std::vector<TriangleGeom::Pointer>& stlGeoms, const std::vector<DoubleArrayType::Pointer>& faceNormals, const std::vector<MeshIndexType>& triOffsets,
+                        const std::vector<MeshIndexType>& vertOffsets, MeshIndexType* tris, float* verts, double* normals)
+  : m_StlGeoms(stlGeoms)
+  , m_FaceNormals(faceNormals)
+  , m_TriOffsets(triOffsets)
+  , m_VertOffsets(vertOffsets)
+  , m_Tris(tris)
+  , m_Verts(verts)
+  , m_Normals(normals)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const TriangleGeom::Pointer& geom = m_StlGeoms[i];
+      MeshIndexType numTris = geom->getNumberOfTris();
+      MeshIndexType* curTris = geom->getTriPointer(0);
+      MeshIndexType* destTris = m_Tris + 3 * m_TriOffsets[i];
+      for(MeshIndexType t = 0; t < 3 * numTris; t++)
+      {
+        destTris[t] = curTris[t] + m_VertOffsets[i];
+      }
+      std::memcpy(m_Verts + 3 * m_VertOffsets[i], geom->getVertexPointer(0), geom->getNumberOfVertices() * 3 * sizeof(float));
+      std::memcpy(m_Normals + 3 * m_TriOffsets[i], m_FaceNormals[i]->getPointer(0), m_FaceNormals[i]->getSize() * sizeof(double));
+    }
+  }
+
+private:
+  const std::vector<TriangleGeom::Pointer>& m_StlGeoms;
+  const std::vector<DoubleArrayType::Pointer>& m_FaceNormals;
+  const std::vector<MeshIndexType>& m_TriOffsets;
+  const std::vector<MeshIndexType>& m_VertOffsets;
+  MeshIndexType* m_Tris = nullptr;
+  float* m_Verts = nullptr;
+  double* m_Normals = nullptr;
+};
+
+/**
+ * @brief Integer cell of the spatial hash used for welding
+ */
+struct WeldCell
+{
+  int64_t x = 0;
+  int64_t y = 0;
+  int64_t z = 0;
+
+  bool operator==(const WeldCell& other) const
+  {
+    return x == other.x && y == other.y && z == other.z;
+  }
+};
+
+struct WeldCellHash
+{
+  size_t operator()(const WeldCell& cell) const
+  {
+    // Large primes spread neighboring cells over the table; the products are formed in
+    // unsigned arithmetic, which wraps instead of overflowing
+    return static_cast<size_t>((static_cast<uint64_t>(cell.x) * 73856093ULL) ^ (static_cast<uint64_t>(cell.y) * 19349663ULL) ^ (static_cast<uint64_t>(cell.z) * 83492791ULL));
+  }
+};
+
+/**
+ * @brief Merges all vertices that lie within tolerance of each other. Vertices are
+ * quantized into cubic cells of edge length tolerance, so a matching vertex can only
+ * be found in the 27 cells around a vertex. A tolerance of 0 merges only vertices
+ * with identical coordinates.
+ * @param verts Vertex coordinates; the welded vertices are compacted to the front
+ * @param numVerts Number of vertices
+ * @param tolerance Maximum distance between merged vertices
+ * @param remap Receives the welded index of every input vertex
+ * @return Number of welded vertices
+ */
+MeshIndexType weldVertices(float* verts, MeshIndexType numVerts, float tolerance, std::vector<MeshIndexType>& remap)
+{
+  const float cellSize = tolerance > 0.0f ? tolerance : 1.0f;
+  const float toleranceSquared = tolerance * tolerance;
+  // Cells are clamped well inside the int64_t range, so neither the conversion nor the
+  // neighbor offsets can overflow; NaN coordinates end up in the cell -k_MaxCell
+  constexpr double k_MaxCell = 4.0e18;
+  const auto cellIndex = [cellSize](float coord) { return static_cast<int64_t>(std::fmin(std::fmax(std::floor(static_cast<double>(coord) / cellSize), -k_MaxCell), k_MaxCell)); };
+  const auto cellOf = [&cellIndex](const float* vert) { return WeldCell{cellIndex(vert[0]), cellIndex(vert[1]), cellIndex(vert[2])}; };
+
+  // Each cell points at the most recent welded vertex inside it; older ones are
+  // chained through next
+  std::unordered_map<WeldCell, MeshIndexType, WeldCellHash> cells;
+  cells.reserve(numVerts / 2);
+  std::vector<MeshIndexType> next;
+  next.reserve(numVerts / 2);
+  constexpr MeshIndexType k_None = std::numeric_limits<MeshIndexType>::max();
+
+  remap.resize(numVerts);
+  MeshIndexType numWelded = 0;
+  for(MeshIndexType v = 0; v < numVerts; v++)
+  {
+    const float* vert = verts + 3 * v;
+    WeldCell cell = cellOf(vert);
+    MeshIndexType match = k_None;
+    int64_t reach = tolerance > 0.0f ? 1 : 0;
+    for(int64_t dz = -reach; dz <= reach && match == k_None; dz++)
+    {
+      for(int64_t dy = -reach; dy <= reach && match == k_None; dy++)
+      {
+        for(int64_t dx = -reach; dx <= reach && match == k_None; dx++)
+        {
+          auto iter = cells.find(WeldCell{cell.x + dx, cell.y + dy, cell.z + dz});
+          for(MeshIndexType w = iter == cells.end() ? k_None : iter->second; w != k_None; w = next[w])
+          {
+            const float* welded = verts + 3 * w;
+            float distSquared = (welded[0] - vert[0]) * (welded[0] - vert[0]) + (welded[1] - vert[1]) * (welded[1] - vert[1]) + (welded[2] - vert[2]) * (welded[2] - vert[2]);
+            if(distSquared <= toleranceSquared)
+            {
+              match = w;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    if(match == k_None)
+    {
+      // Welded vertices are compacted in place; numWelded <= v, so the write never
+      // touches a vertex that has not been visited yet
+      match = numWelded++;
+      std::memmove(verts + 3 * match, vert, 3 * sizeof(float));
+      auto inserted = cells.emplace(cell, match);
+      next.push_back(inserted.second ? k_None : inserted.first->second);
+      inserted.first->second = match;
+    }
+    remap[v] = match;
+  }
+  return numWelded;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -68,6 +268,9 @@ void CombineStlFiles::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_INPUT_PATH_FP("Path to STL Files", StlFilesPath, FilterParameter::Category::Parameter, CombineStlFiles, "", ""));
+  std::vector<QString> linkedProps = {"WeldTolerance"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Weld Vertices", WeldVertices, FilterParameter::Category::Parameter, CombineStlFiles, linkedProps));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Weld Tolerance", WeldTolerance, FilterParameter::Category::Parameter, CombineStlFiles));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", TriangleDataContainerName, FilterParameter::Category::CreatedArray, CombineStlFiles));
   parameters.push_back(SeparatorFilterParameter::Create("Face Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Face Attribute Matrix", FaceAttributeMatrixName, TriangleDataContainerName, FilterParameter::Category::CreatedArray, CombineStlFiles));
@@ -106,6 +309,12 @@ void CombineStlFiles::dataCheck()
     setErrorCondition(-388, ss);
   }
 
+  if(getWeldVertices() && getWeldTolerance() < 0.0f)
+  {
+    QString ss = QObject::tr("The weld tolerance must be non-negative");
+    setErrorCondition(-389, ss);
+  }
+
   if(getErrorCode() < 0)
   {
     return;
@@ -160,52 +369,49 @@ void CombineStlFiles::execute()
     return;
   }
 
-  DataContainerArray::Pointer dca = DataContainerArray::New();
-
   FilterManager* fm = FilterManager::Instance();
   IFilterFactory::Pointer factory = fm->getFactoryFromClassName("ReadStlFile");
-  AbstractFilter::Pointer reader = factory->create();
-  reader->setDataContainerArray(dca);
 
-  for(auto&& file : m_FileList)
+  // Read all files concurrently, each into its own DataContainerArray
+  std::vector<DataContainerArray::Pointer> dcas(static_cast<size_t>(m_FileList.size()));
+  std::vector<int32_t> errors(dcas.size(), 0);
+  ParallelDataAlgorithm readAlg;
+  readAlg.setRange(0, dcas.size());
+  readAlg.execute(ReadStlFilesImpl(factory, m_FileList, dcas, errors));
+
+  for(size_t i = 0; i < errors.size(); i++)
   {
-    QVariant var;
-    var.setValue(file.canonicalFilePath());
-    reader->setProperty("StlFilePath", var);
-    var.setValue(file.baseName());
-    reader->setProperty("SurfaceMeshDataContainerName", var);
-    var.setValue(SIMPL::Defaults::FaceAttributeMatrixName);
-    reader->setProperty("FaceAttributeMatrixName", var);
-    var.setValue(SIMPL::FaceData::SurfaceMeshFaceNormals);
-    reader->setProperty("FaceNormalsArrayName", var);
-    reader->execute();
-    if(reader->getErrorCode() < 0)
+    if(errors[i] < 0)
     {
-      QString ss = QObject::tr("Error reading STL file: %1").arg(file.fileName());
-      setErrorCondition(reader->getErrorCode(), ss);
+      QString ss = QObject::tr("Error reading STL file: %1").arg(m_FileList.at(static_cast<int>(i)).fileName());
+      setErrorCondition(errors[i], ss);
       return;
     }
   }
 
-  std::list<TriangleGeom::Pointer> stlGeoms;
-  std::list<DoubleArrayType::Pointer> faceNormals;
-  auto containers = dca->getDataContainers();
+  if(getCancel())
+  {
+    return;
+  }
+
+  std::vector<TriangleGeom::Pointer> stlGeoms;
+  std::vector<DoubleArrayType::Pointer> faceNormals;
+  std::vector<MeshIndexType> triOffsets;
+  std::vector<MeshIndexType> vertOffsets;
+  MeshIndexType totalTriangles = 0;
+  MeshIndexType totalVertices = 0;
   DataArrayPath path;
 
-  for(auto&& container : containers)
+  for(auto&& dca : dcas)
   {
+    DataContainer::Pointer container = dca->getDataContainers().front();
     stlGeoms.push_back(container->getGeometryAs<TriangleGeom>());
     path.update(container->getName(), SIMPL::Defaults::FaceAttributeMatrixName, "");
     faceNormals.push_back(container->getAttributeMatrix(path)->getAttributeArrayAs<DoubleArrayType>(SIMPL::FaceData::SurfaceMeshFaceNormals));
-  }
-
-  int64_t totalTriangles = 0;
-  int64_t totalVertices = 0;
-
-  for(auto&& geom : stlGeoms)
-  {
-    totalTriangles += geom->getNumberOfTris();
-    totalVertices += geom->getNumberOfVertices();
+    triOffsets.push_back(totalTriangles);
+    vertOffsets.push_back(totalVertices);
+    totalTriangles += stlGeoms.back()->getNumberOfTris();
+    totalVertices += stlGeoms.back()->getNumberOfVertices();
   }
 
   TriangleGeom::Pointer combined = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
@@ -214,36 +420,48 @@ void CombineStlFiles::execute()
   combined->resizeTriList(totalTriangles);
   combined->resizeVertexList(totalVertices);
   faceAttrmat->resizeAttributeArrays(tDims);
-  MeshIndexType triOffset = 0;
-  MeshIndexType vertOffset = 0;
-  MeshIndexType triCounter = 0;
   MeshIndexType* tris = combined->getTriPointer(0);
   float* verts = combined->getVertexPointer(0);
+  m_FaceNormals = faceAttrmat->getAttributeArrayAs<DoubleArrayType>(m_FaceNormalsArrayName)->getPointer(0);
+
+  ParallelDataAlgorithm copyAlg;
+  copyAlg.setRange(0, stlGeoms.size());
+  copyAlg.execute(CopyStlGeometriesImpl(stlGeoms, faceNormals, triOffsets, vertOffsets, tris, verts, m_FaceNormals));
 
-  for(auto&& geom : stlGeoms)
+  // The individual geometries are no longer needed
+  stlGeoms.clear();
+  faceNormals.clear();
+  dcas.clear();
+
+  if(m_WeldVertices)
   {
-    MeshIndexType* curTris = geom->getTriPointer(0);
-    for(MeshIndexType t = 0; t < geom->getNumberOfTris(); t++)
+    notifyStatusMessage("Welding vertices");
+    std::vector<MeshIndexType> remap;
+    MeshIndexType numWelded = weldVertices(verts, totalVertices, m_WeldTolerance, remap);
+
+    // Point the triangles at the welded vertices and drop the ones that collapsed
+    MeshIndexType numTris = 0;
+    for(MeshIndexType t = 0; t < totalTriangles; t++)
     {
-      curTris[3 * t + 0] += triCounter;
-      curTris[3 * t + 1] += triCounter;
-      curTris[3 * t + 2] += triCounter;
+      MeshIndexType v0 = remap[tris[3 * t + 0]];
+      MeshIndexType v1 = remap[tris[3 * t + 1]];
+      MeshIndexType v2 = remap[tris[3 * t + 2]];
+      if(v0 == v1 || v1 == v2 || v0 == v2)
+      {
+        continue;
+      }
+      tris[3 * numTris + 0] = v0;
+      tris[3 * numTris + 1] = v1;
+      tris[3 * numTris + 2] = v2;
+      std::memmove(m_FaceNormals + 3 * numTris, m_FaceNormals + 3 * t, 3 * sizeof(double));
+      numTris++;
     }
-    triCounter += geom->getNumberOfVertices();
-    float* curVerts = geom->getVertexPointer(0);
-    std::memcpy(tris + triOffset, curTris, geom->getNumberOfTris() * 3 * sizeof(MeshIndexType));
-    std::memcpy(verts + vertOffset, curVerts, geom->getNumberOfVertices() * 3 * sizeof(float));
-    triOffset += geom->getNumberOfTris() * 3;
-    vertOffset += geom->getNumberOfVertices() * 3;
-  }
 
-  size_t faceNormalsOffset = 0;
-  m_FaceNormals = faceAttrmat->getAttributeArrayAs<DoubleArrayType>(m_FaceNormalsArrayName)->getPointer(0);
-
-  for(auto&& dataArray : faceNormals)
-  {
-    std::memcpy(m_FaceNormals + faceNormalsOffset, dataArray->getPointer(0), dataArray->getSize() * sizeof(double));
-    faceNormalsOffset += dataArray->getSize();
+    combined->resizeVertexList(numWelded);
+    combined->resizeTriList(numTris);
+    tDims[0] = numTris;
+    faceAttrmat->resizeAttributeArrays(tDims);
+    m_FaceNormals = faceAttrmat->getAttributeArrayAs<DoubleArrayType>(m_FaceNormalsArrayName)->getPointer(0);
   }
 
   notifyStatusMessage("Complete");
@@ -362,6 +580,30 @@ QString CombineStlFiles::getStlFilesPath() const
   return m_StlFilesPath;
 }
 
+// -----------------------------------------------------------------------------
+void CombineStlFiles::setWeldVertices(bool value)
+{
+  m_WeldVertices = value;
+}
+
+// -----------------------------------------------------------------------------
+bool CombineStlFiles::getWeldVertices() const
+{
+  return m_WeldVertices;
+}
+
+// -----------------------------------------------------------------------------
+void CombineStlFiles::setWeldTolerance(float value)
+{
+  m_WeldTolerance = value;
+}
+
+// -----------------------------------------------------------------------------
+float CombineStlFiles::getWeldTolerance() const
+{
+  return m_WeldTolerance;
+}
+
 // -----------------------------------------------------------------------------
 void CombineStlFiles::setTriangleDataContainerName(const QString& value)
 {
@@ -62,6 +62,28 @@ public:
   QString getStlFilesPath() const;
   Q_PROPERTY(QString StlFilesPath READ getStlFilesPath WRITE setStlFilesPath)
 
+  /**
+   * @brief Setter property for WeldVertices
+   */
+  void setWeldVertices(bool value);
+  /**
+   * @brief Getter property for WeldVertices
+   * @return Value of WeldVertices
+   */
+  bool getWeldVertices() const;
+  Q_PROPERTY(bool WeldVertices READ getWeldVertices WRITE setWeldVertices)
+
+  /**
+   * @brief Setter property for WeldTolerance
+   */
+  void setWeldTolerance(float value);
+  /**
+   * @brief Getter property for WeldTolerance
+   * @return Value of WeldTolerance
+   */
+  float getWeldTolerance() const;
+  Q_PROPERTY(float WeldTolerance READ getWeldTolerance WRITE setWeldTolerance)
+
   /**
    * @brief Setter property for TriangleDataContainerName
    */
@@ -168,6 +190,8 @@ private:
   double* m_FaceNormals = nullptr;
 
   QString m_StlFilesPath = {};
+  bool m_WeldVertices = {false};
+  float m_WeldTolerance = {0.0f};
   QString m_TriangleDataContainerName = {};
   QString m_FaceAttributeMatrixName = {};
   QString m_FaceNormalsArrayName = {};
@@ -35,6 +35,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DiscretizeDDDomain.h"
 
+#include <array>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -49,9 +52,9 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
-#include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SegmentRasterization.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -202,7 +205,7 @@ void DiscretizeDDDomain::dataCheck()
   // Get the name and create the array in the new data attrMat
   std::vector<size_t> dims(1, 1);
   tempPath.update(getOutputDataContainerName().getDataContainerName(), getOutputAttributeMatrixName(), getOutputArrayName());
-  m_OutputArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID31);
+  m_OutputArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0.0f, dims, "", DataArrayID31);
   if(nullptr != m_OutputArrayPtr.lock())
   {
     m_OutputArray = m_OutputArrayPtr.lock()->getPointer(0);
@@ -275,10 +278,6 @@ void DiscretizeDDDomain::execute()
   halfCellSize[0] = (m_CellSize[0] / 2.0);
   halfCellSize[1] = (m_CellSize[1] / 2.0);
   halfCellSize[2] = (m_CellSize[2] / 2.0);
-  FloatVec3Type quarterCellSize;
-  quarterCellSize[0] = (m_CellSize[0] / 4.0);
-  quarterCellSize[1] = (m_CellSize[1] / 4.0);
-  quarterCellSize[2] = (m_CellSize[2] / 4.0);
 
   vdc->getGeometryAs<ImageGeom>()->setOrigin(FloatVec3Type(xMin, yMin, zMin));
   size_t dcDims[3];
@@ -294,117 +293,28 @@ void DiscretizeDDDomain::execute()
   tDims[2] = dcDims[2];
   cellAttrMat->resizeAttributeArrays(tDims);
 
-  float point1[3], point2[3], corner1[3], corner2[3];
-  size_t xCellMin, xCellMax;
-  size_t yCellMin, yCellMax;
-  size_t zCellMin, zCellMax;
-  float x1, y1, z1, x2, y2, z2;
-  size_t zStride, yStride, point;
-  int system = 0;
-  float length;
-  for(size_t i = 0; i < numEdges; i++)
-  {
-    point1[0] = nodes[3 * edge[2 * i + 0] + 0];
-    point1[1] = nodes[3 * edge[2 * i + 0] + 1];
-    point1[2] = nodes[3 * edge[2 * i + 0] + 2];
-    point2[0] = nodes[3 * edge[2 * i + 1] + 0];
-    point2[1] = nodes[3 * edge[2 * i + 1] + 1];
-    point2[2] = nodes[3 * edge[2 * i + 1] + 2];
-    x1 = (point1[0] - xMin);
-    y1 = (point1[1] - yMin);
-    z1 = (point1[2] - zMin);
-    x2 = (point2[0] - xMin);
-    y2 = (point2[1] - yMin);
-    z2 = (point2[2] - zMin);
-    if(x1 > x2)
-    {
-      xCellMin = size_t(x2 / quarterCellSize[0]), xCellMax = size_t(x1 / quarterCellSize[0]);
-    }
-    else
-    {
-      xCellMin = size_t(x1 / quarterCellSize[0]), xCellMax = size_t(x2 / quarterCellSize[0]);
-    }
-    if(y1 > y2)
-    {
-      yCellMin = size_t(y2 / quarterCellSize[1]), yCellMax = size_t(y1 / quarterCellSize[1]);
-    }
-    else
-    {
-      yCellMin = size_t(y1 / quarterCellSize[1]), yCellMax = size_t(y2 / quarterCellSize[1]);
-    }
-    if(z1 > z2)
-    {
-      zCellMin = size_t(z2 / quarterCellSize[2]), zCellMax = size_t(z1 / quarterCellSize[2]);
-    }
-    else
+  // Accumulate the length of every segment inside the cell sized window around each voxel
+  std::array<double, 3> origin = {xMin, yMin, zMin};
+  std::array<double, 3> spacing = {halfCellSize[0], halfCellSize[1], halfCellSize[2]};
+  std::array<int64_t, 3> dims = {static_cast<int64_t>(tDims[0]), static_cast<int64_t>(tDims[1]), static_cast<int64_t>(tDims[2])};
+  const auto endpoints = [&](size_t i, std::array<double, 3>& point1, std::array<double, 3>& point2) {
+    for(size_t a = 0; a < 3; a++)
     {
-      zCellMin = size_t(z1 / quarterCellSize[2]), zCellMax = size_t(z2 / quarterCellSize[2]);
+      point1[a] = nodes[3 * edge[2 * i + 0] + a];
+      point2[a] = nodes[3 * edge[2 * i + 1] + a];
     }
-    xCellMin = (xCellMin - 1) / 2;
-    yCellMin = (yCellMin - 1) / 2;
-    zCellMin = (zCellMin - 1) / 2;
-    xCellMax = ((xCellMax - 1) / 2) + 1;
-    yCellMax = ((yCellMax - 1) / 2) + 1;
-    zCellMax = ((zCellMax - 1) / 2) + 1;
-    if(xCellMax >= tDims[0])
-    {
-      xCellMax = tDims[0] - 1;
-    }
-    if(yCellMax >= tDims[1])
-    {
-      yCellMax = tDims[1] - 1;
-    }
-    if(zCellMax >= tDims[2])
-    {
-      zCellMax = tDims[2] - 1;
-    }
-    for(size_t j = zCellMin; j <= zCellMax; j++)
-    {
-      zStride = j * tDims[0] * tDims[1];
-      corner1[2] = (j * halfCellSize[2]) - halfCellSize[2] + quarterCellSize[2] + zMin;
-      corner2[2] = (j * halfCellSize[2]) + halfCellSize[2] + quarterCellSize[2] + zMin;
-      for(size_t k = yCellMin; k <= yCellMax; k++)
-      {
-        yStride = k * tDims[0];
-        corner1[1] = (k * halfCellSize[1]) - halfCellSize[1] + quarterCellSize[1] + yMin;
-        corner2[1] = (k * halfCellSize[1]) + halfCellSize[1] + quarterCellSize[1] + yMin;
-        for(size_t l = xCellMin; l <= xCellMax; l++)
-        {
-          corner1[0] = (l * halfCellSize[0]) - halfCellSize[0] + quarterCellSize[0] + xMin;
-          corner2[0] = (l * halfCellSize[0]) + halfCellSize[0] + quarterCellSize[0] + xMin;
-          length = GeometryMath::LengthOfRayInBox(point1, point2, corner1, corner2);
-          point = (zStride + yStride + l);
-          m_OutputArray[14 * point + 0] += length;
-          m_OutputArray[14 * point + system] += length;
-        }
-      }
-    }
-  }
+  };
+  // The lengths are summed in floating point; a segment deposits many short pieces into a
+  // voxel, which are only converted to a density once every segment has been added
+  std::vector<float> lineLengths(tDims[0] * tDims[1] * tDims[2], 0.0f);
+  const auto deposit = [&](size_t /* edge */, size_t point, double length) { lineLengths[point] += static_cast<float>(length); };
+  SegmentRasterization::rasterizeOverlappingWindows(numEdges, endpoints, origin, spacing, dims, deposit);
 
-  float max = 0.0;
   float cellVolume = m_CellSize[0] * m_CellSize[1] * m_CellSize[2];
-  for(size_t j = 0; j < tDims[2]; j++)
+  for(size_t point = 0; point < lineLengths.size(); point++)
   {
-    zStride = j * tDims[0] * tDims[1];
-    for(size_t k = 0; k < tDims[1]; k++)
-    {
-      yStride = k * tDims[0];
-      for(size_t l = 0; l < tDims[0]; l++)
-      {
-        point = (zStride + yStride + l);
-        // take care of total density first before looping over all systems
-        m_OutputArray[14 * point] /= cellVolume;
-        // convert to m/mm^3 from um/um^3
-        m_OutputArray[14 * point] *= 1.0E12f;
-        max = 0.0;
-        for(int iter = 1; iter < 14; iter++)
-        {
-          m_OutputArray[14 * point + iter] /= cellVolume;
-          // convert to m/mm^3 from um/um^3
-          m_OutputArray[14 * point + iter] *= 1.0E12f;
-        }
-      }
-    }
+    // convert to m/mm^3 from um/um^3, as DislocationDensityTimeSeries does
+    m_OutputArray[point] = lineLengths[point] / cellVolume * 1.0E12f;
   }
 }
 
@@ -229,8 +229,8 @@ protected:
   void initialize();
 
 private:
-  std::weak_ptr<DataArray<int32_t>> m_OutputArrayPtr;
-  int32_t* m_OutputArray = nullptr;
+  std::weak_ptr<DataArray<float>> m_OutputArrayPtr;
+  float* m_OutputArray = nullptr;
 
   DataArrayPath m_EdgeDataContainerName = {SIMPL::Defaults::DataContainerName, "", ""};
   FloatVec3Type m_CellSize = {};
@@ -0,0 +1,603 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson,
+ * the US Air Force, BlueQuartz Software nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                   FA8650-07-D-5800 and FA8650-10-D-5226
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "DislocationDensityTimeSeries.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/FilePathGenerator.h"
+#include "SIMPLib/Utilities/FileSystemPathHelper.h"
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/DislocationSegments.hpp"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ParaDisParsing.hpp"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SegmentRasterization.hpp"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsingHelpers.hpp"
+#include "DREAM3DReview/DREAM3DReviewVersion.h"
+
+namespace
+{
+constexpr size_t k_TargetChunkBytes = 4 * 1024 * 1024;
+
+/**
+ * @brief Time series dataset of dimensions [t][z][y][x]. Every chunk holds a slab of Z planes
+ * of a single time step, so one time step is written without touching the others.
+ */
+class TimeSeriesDataset
+{
+public:
+  TimeSeriesDataset() = default;
+  ~TimeSeriesDataset()
+  {
+    close();
+  }
+
+  /**
+   * @brief Creates the dataset
+   * @return Negative value on error
+   */
+  herr_t create(hid_t fileId, const QString& name, size_t numSteps, const std::array<int64_t, 3>& dims)
+  {
+    m_Dims = {static_cast<hsize_t>(numSteps), static_cast<hsize_t>(dims[2]), static_cast<hsize_t>(dims[1]), static_cast<hsize_t>(dims[0])};
+    size_t planeBytes = static_cast<size_t>(dims[0] * dims[1]) * sizeof(float);
+    hsize_t slabDepth = std::min<hsize_t>(std::max<size_t>(1, k_TargetChunkBytes / planeBytes), m_Dims[1]);
+    std::array<hsize_t, 4> chunkDims = {1, slabDepth, m_Dims[2], m_Dims[3]};
+
+    hid_t dataspaceId = H5Screate_simple(4, m_Dims.data(), nullptr);
+    hid_t plistId = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(plistId, 4, chunkDims.data());
+    m_DatasetId = H5Dcreate(fileId, name.toLatin1().data(), H5T_NATIVE_FLOAT, dataspaceId, H5P_DEFAULT, plistId, H5P_DEFAULT);
+    H5Pclose(plistId);
+    H5Sclose(dataspaceId);
+    return m_DatasetId < 0 ? -1 : 0;
+  }
+
+  /**
+   * @brief Writes the grid of one time step
+   * @return Negative value on error
+   */
+  herr_t writeStep(size_t step, const std::vector<float>& values) const
+  {
+    std::array<hsize_t, 4> offset = {static_cast<hsize_t>(step), 0, 0, 0};
+    std::array<hsize_t, 4> count = {1, m_Dims[1], m_Dims[2], m_Dims[3]};
+    hid_t fileSpaceId = H5Dget_space(m_DatasetId);
+    hid_t memSpaceId = H5Screate_simple(4, count.data(), nullptr);
+    herr_t err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+    if(err >= 0)
+    {
+      err = H5Dwrite(m_DatasetId, H5T_NATIVE_FLOAT, memSpaceId, fileSpaceId, H5P_DEFAULT, values.data());
+    }
+    H5Sclose(memSpaceId);
+    H5Sclose(fileSpaceId);
+    return err;
+  }
+
+  void close()
+  {
+    if(m_DatasetId >= 0)
+    {
+      H5Dclose(m_DatasetId);
+      m_DatasetId = -1;
+    }
+  }
+
+  TimeSeriesDataset(const TimeSeriesDataset&) = delete;            // Copy Constructor Not Implemented
+  TimeSeriesDataset(TimeSeriesDataset&&) = delete;                 // Move Constructor Not Implemented
+  TimeSeriesDataset& operator=(const TimeSeriesDataset&) = delete; // Copy Assignment Not Implemented
+  TimeSeriesDataset& operator=(TimeSeriesDataset&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  hid_t m_DatasetId = -1;
+  std::array<hsize_t, 4> m_Dims = {0, 0, 0, 0};
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DislocationDensityTimeSeries::DislocationDensityTimeSeries()
+{
+  m_InputFileListInfo.StartIndex = 0;
+  m_InputFileListInfo.EndIndex = 0;
+  m_InputFileListInfo.IncrementIndex = 1;
+  m_InputFileListInfo.PaddingDigits = 0;
+  m_InputFileListInfo.Ordering = 0;
+  m_InputFileListInfo.FileExtension = "";
+  m_InputFileListInfo.FilePrefix = "";
+  m_InputFileListInfo.FileSuffix = "";
+  m_InputFileListInfo.InputPath = "";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DislocationDensityTimeSeries::~DislocationDensityTimeSeries() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setupFilterParameters()
+{
+  FilterParameterVectorType parameters;
+  parameters.push_back(SIMPL_NEW_FILELISTINFO_FP("ParaDis Snapshot Files", InputFileListInfo, FilterParameter::Category::Parameter, DislocationDensityTimeSeries));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Burgers Vector Length (Angstroms)", BurgersVector, FilterParameter::Category::Parameter, DislocationDensityTimeSeries));
+  parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Cell Size (Microns)", CellSize, FilterParameter::Category::Parameter, DislocationDensityTimeSeries));
+  parameters.push_back(SeparatorFilterParameter::Create("Output", FilterParameter::Category::Parameter));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, DislocationDensityTimeSeries, "*.h5", "HDF5 File"));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Dataset Name", DatasetName, FilterParameter::Category::Parameter, DislocationDensityTimeSeries));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
+  setBurgersVector(reader->readValue("BurgersVector", getBurgersVector()));
+  setCellSize(reader->readFloatVec3("CellSize", getCellSize()));
+  setOutputFile(reader->readString("OutputFile", getOutputFile()));
+  setDatasetName(reader->readString("DatasetName", getDatasetName()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::initialize()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> DislocationDensityTimeSeries::generateFileList() const
+{
+  bool hasMissingFiles = false;
+  bool orderAscending = (m_InputFileListInfo.Ordering == 0);
+  return FilePathGenerator::GenerateFileList(m_InputFileListInfo.StartIndex, m_InputFileListInfo.EndIndex, m_InputFileListInfo.IncrementIndex, hasMissingFiles, orderAscending,
+                                             m_InputFileListInfo.InputPath, m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension,
+                                             m_InputFileListInfo.PaddingDigits);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+
+  if(m_InputFileListInfo.InputPath.isEmpty())
+  {
+    QString ss = QObject::tr("The input directory must be set");
+    setErrorCondition(-11301, ss);
+    return;
+  }
+
+  QVector<QString> fileList = generateFileList();
+  if(fileList.empty())
+  {
+    QString ss = QObject::tr("No files have been selected for import. Have you set the input directory and other values so that input files will be generated?");
+    setErrorCondition(-11302, ss);
+    return;
+  }
+  for(const QString& filePath : fileList)
+  {
+    if(!QFileInfo::exists(filePath))
+    {
+      QString ss = QObject::tr("The snapshot file '%1' does not exist").arg(filePath);
+      setErrorCondition(-11303, ss);
+      return;
+    }
+  }
+
+  if(m_BurgersVector <= 0.0f)
+  {
+    QString ss = QObject::tr("The Burgers vector length must be greater than zero");
+    setErrorCondition(-11304, ss);
+  }
+  if(m_CellSize[0] <= 0.0f || m_CellSize[1] <= 0.0f || m_CellSize[2] <= 0.0f)
+  {
+    QString ss = QObject::tr("All components of the cell size must be greater than zero");
+    setErrorCondition(-11305, ss);
+  }
+  if(m_DatasetName.isEmpty())
+  {
+    QString ss = QObject::tr("The dataset name must be set");
+    setErrorCondition(-11306, ss);
+  }
+
+  FileSystemPathHelper::CheckOutputFile(this, "Output File", getOutputFile(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::execute()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  QVector<QString> fileList = generateFileList();
+  size_t numSteps = static_cast<size_t>(fileList.size());
+
+  // convert user input Burgers Vector to microns from angstroms
+  float burgersVec = m_BurgersVector / 10000.0f;
+  float cellVolume = m_CellSize[0] * m_CellSize[1] * m_CellSize[2];
+
+  // Make sure any directory path is also available as the user may have just typed
+  // in a path without actually creating the full path
+  QFileInfo fi(m_OutputFile);
+  QString parentPath = fi.path();
+  QDir dir;
+  if(!dir.mkpath(parentPath))
+  {
+    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath);
+    setErrorCondition(-11307, ss);
+    return;
+  }
+
+  hid_t fileId = QH5Utilities::createFile(m_OutputFile);
+  if(fileId < 0)
+  {
+    QString ss = QObject::tr("The HDF5 file could not be created.\n The given filename was:\n\t[%1]").arg(m_OutputFile);
+    setErrorCondition(-11308, ss);
+    return;
+  }
+  // This will make sure if we return early from this method that the HDF5 File is properly closed.
+  H5ScopedFileSentinel scopedFileSentinel(fileId, true);
+  TimeSeriesDataset dataset;
+
+  // Buffers reused by every snapshot; after the first few snapshots they have reached
+  // their final capacity and a snapshot no longer allocates
+  ParaDisParsing::Snapshot snapshot;
+  DislocationSegments::VertexEdges adjacency;
+  ConcurrentUnionFind<MeshIndexType> segmentForest;
+  std::vector<int32_t> dislocationIds;
+  std::vector<float> density;
+  std::vector<int32_t> segmentCounts(numSteps, 0);
+
+  std::array<float, 6> domainBounds = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  std::array<double, 3> origin = {0.0, 0.0, 0.0};
+  std::array<double, 3> spacing = {m_CellSize[0] / 2.0, m_CellSize[1] / 2.0, m_CellSize[2] / 2.0};
+  std::array<int64_t, 3> dims = {0, 0, 0};
+
+  for(size_t step = 0; step < numSteps; step++)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    const QString& filePath = fileList[static_cast<int>(step)];
+    QString ss = QObject::tr("Processing snapshot %1 of %2").arg(step + 1).arg(numSteps);
+    notifyStatusMessage(ss);
+
+    // Read the nodes and segments
+    TextParsingHelpers::MappedFile mappedFile(filePath);
+    if(!mappedFile.isValid())
+    {
+      ss = QObject::tr("The snapshot file could not be opened: %1").arg(filePath);
+      setErrorCondition(-11309, ss);
+      return;
+    }
+    TextParsingHelpers::LineScanner scanner(mappedFile.begin(), mappedFile.end());
+    int32_t err = ParaDisParsing::readHeader(scanner, burgersVec, filePath, snapshot, ss);
+    if(err >= 0)
+    {
+      err = ParaDisParsing::readNodes(scanner, burgersVec, filePath, [this] { return getCancel(); }, snapshot, ss);
+    }
+    if(err < 0)
+    {
+      setErrorCondition(err, ss);
+      return;
+    }
+    if(getCancel())
+    {
+      return;
+    }
+
+    // The grid spans the simulation domain, which all snapshots of a run share
+    if(step == 0)
+    {
+      domainBounds = snapshot.domainBounds;
+      for(size_t a = 0; a < 3; a++)
+      {
+        origin[a] = domainBounds[a];
+        dims[a] = static_cast<int64_t>((domainBounds[a + 3] - domainBounds[a]) / static_cast<float>(spacing[a]));
+      }
+      if(dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0)
+      {
+        ss = QObject::tr("The domain of '%1' is smaller than half a cell along at least one axis").arg(filePath);
+        setErrorCondition(-11310, ss);
+        return;
+      }
+      density.resize(static_cast<size_t>(dims[0] * dims[1] * dims[2]));
+      if(dataset.create(fileId, m_DatasetName, numSteps, dims) < 0)
+      {
+        ss = QObject::tr("Error creating the dataset '%1' in %2").arg(m_DatasetName).arg(m_OutputFile);
+        setErrorCondition(-11311, ss);
+        return;
+      }
+    }
+    else if(snapshot.domainBounds != domainBounds)
+    {
+      ss = QObject::tr("The domain bounds of '%1' differ from those of the first snapshot").arg(filePath);
+      setErrorCondition(-11312, ss);
+      return;
+    }
+
+    // Identify the dislocation segments
+    size_t numEdges = snapshot.numEdges();
+    adjacency.build(static_cast<size_t>(snapshot.numVerts), snapshot.edges.data(), numEdges);
+    dislocationIds.resize(numEdges);
+    segmentCounts[step] =
+        DislocationSegments::identify(snapshot.edges.data(), numEdges, snapshot.burgersVectors.data(), snapshot.slipPlaneNormals.data(), adjacency, dislocationIds.data(), segmentForest);
+
+    // Discretize the line length onto the grid
+    std::fill(density.begin(), density.end(), 0.0f);
+    const auto endpoints = [&](size_t i, std::array<double, 3>& point1, std::array<double, 3>& point2) {
+      for(size_t a = 0; a < 3; a++)
+      {
+        point1[a] = snapshot.vertices[3 * snapshot.edges[2 * i + 0] + a];
+        point2[a] = snapshot.vertices[3 * snapshot.edges[2 * i + 1] + a];
+      }
+    };
+    const auto deposit = [&](size_t /* edge */, size_t point, double length) { density[point] += static_cast<float>(length); };
+    SegmentRasterization::rasterizeOverlappingWindows(numEdges, endpoints, origin, spacing, dims, deposit);
+    for(float& value : density)
+    {
+      // convert to m/mm^3 from um/um^3
+      value = value / cellVolume * 1.0E12f;
+    }
+
+    if(dataset.writeStep(step, density) < 0)
+    {
+      ss = QObject::tr("Error writing time step %1 of '%2' to %3").arg(step).arg(m_DatasetName).arg(m_OutputFile);
+      setErrorCondition(-11313, ss);
+      return;
+    }
+  }
+  dataset.close();
+
+  // Grid geometry and the number of dislocation segments of every time step
+  std::string name = m_DatasetName.toStdString();
+  std::vector<hsize_t> gridDims = {static_cast<hsize_t>(dims[0]), static_cast<hsize_t>(dims[1]), static_cast<hsize_t>(dims[2])};
+  std::array<float, 3> gridOrigin = {static_cast<float>(origin[0]), static_cast<float>(origin[1]), static_cast<float>(origin[2])};
+  std::array<float, 3> gridSpacing = {static_cast<float>(spacing[0]), static_cast<float>(spacing[1]), static_cast<float>(spacing[2])};
+  hsize_t vectorDims[1] = {3};
+  hsize_t countDims[1] = {static_cast<hsize_t>(numSteps)};
+  herr_t err = H5Lite::writeVectorAttribute(fileId, name, SIMPL::HDF5::TupleDimensions.toStdString(), gridDims);
+  if(err >= 0)
+  {
+    err = H5Lite::writePointerDataset(fileId, name + "Origin", 1, vectorDims, gridOrigin.data());
+  }
+  if(err >= 0)
+  {
+    err = H5Lite::writePointerDataset(fileId, name + "Spacing", 1, vectorDims, gridSpacing.data());
+  }
+  if(err >= 0)
+  {
+    err = H5Lite::writePointerDataset(fileId, name + "SegmentCounts", 1, countDims, segmentCounts.data());
+  }
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error writing the grid description of '%1' to %2").arg(m_DatasetName).arg(m_OutputFile);
+    setErrorCondition(-11314, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer DislocationDensityTimeSeries::newFilterInstance(bool copyFilterParameters) const
+{
+  DislocationDensityTimeSeries::Pointer filter = DislocationDensityTimeSeries::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getCompiledLibraryName() const
+{
+  return DDDAnalysisToolboxConstants::DDDAnalysisToolboxBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getBrandingString() const
+{
+  return "DDDAnalysisToolbox";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << DREAM3DReview::Version::Major() << "." << DREAM3DReview::Version::Minor() << "." << DREAM3DReview::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getGroupName() const
+{
+  return SIMPL::FilterGroups::Unsupported;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid DislocationDensityTimeSeries::getUuid() const
+{
+  return QUuid("{5f5aff81-4a36-4677-aaca-ee5f5ee0fcda}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::MiscFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getHumanLabel() const
+{
+  return "Dislocation Density Time Series (ParaDis)";
+}
+
+// -----------------------------------------------------------------------------
+DislocationDensityTimeSeries::Pointer DislocationDensityTimeSeries::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<DislocationDensityTimeSeries> DislocationDensityTimeSeries::New()
+{
+  struct make_shared_enabler : public DislocationDensityTimeSeries
+  {
+  };
+  std::shared_ptr<make_shared_enabler> val = std::make_shared<make_shared_enabler>();
+  val->setupFilterParameters();
+  return val;
+}
+
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getNameOfClass() const
+{
+  return QString("DislocationDensityTimeSeries");
+}
+
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::ClassName()
+{
+  return QString("DislocationDensityTimeSeries");
+}
+
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setInputFileListInfo(const StackFileListInfo& value)
+{
+  m_InputFileListInfo = value;
+}
+
+// -----------------------------------------------------------------------------
+StackFileListInfo DislocationDensityTimeSeries::getInputFileListInfo() const
+{
+  return m_InputFileListInfo;
+}
+
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setBurgersVector(float value)
+{
+  m_BurgersVector = value;
+}
+
+// -----------------------------------------------------------------------------
+float DislocationDensityTimeSeries::getBurgersVector() const
+{
+  return m_BurgersVector;
+}
+
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setCellSize(const FloatVec3Type& value)
+{
+  m_CellSize = value;
+}
+
+// -----------------------------------------------------------------------------
+FloatVec3Type DislocationDensityTimeSeries::getCellSize() const
+{
+  return m_CellSize;
+}
+
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setOutputFile(const QString& value)
+{
+  m_OutputFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getOutputFile() const
+{
+  return m_OutputFile;
+}
+
+// -----------------------------------------------------------------------------
+void DislocationDensityTimeSeries::setDatasetName(const QString& value)
+{
+  m_DatasetName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString DislocationDensityTimeSeries::getDatasetName() const
+{
+  return m_DatasetName;
+}
@@ -0,0 +1,243 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson,
+ * the US Air Force, BlueQuartz Software nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                   FA8650-07-D-5800 and FA8650-10-D-5226
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/StackFileListInfo.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "DREAM3DReview/DREAM3DReviewConstants.h"
+#include "DREAM3DReview/DREAM3DReviewDLLExport.h"
+
+/**
+ * @class DislocationDensityTimeSeries DislocationDensityTimeSeries.h DREAM3DReview/DREAM3DReviewFilters/DislocationDensityTimeSeries.h
+ * @brief Streams a numbered series of ParaDis restart files through reading, dislocation segment
+ * identification and discretization, and writes the dislocation line density of every snapshot
+ * as one time step of a chunked HDF5 dataset. The parse, adjacency and density buffers are reused
+ * from one snapshot to the next, and nothing is added to the data container array.
+ */
+class DREAM3DReview_EXPORT DislocationDensityTimeSeries : public AbstractFilter
+{
+  Q_OBJECT
+
+  // Start Python bindings declarations
+  PYB11_BEGIN_BINDINGS(DislocationDensityTimeSeries SUPERCLASS AbstractFilter)
+  PYB11_FILTER()
+  PYB11_SHARED_POINTERS(DislocationDensityTimeSeries)
+  PYB11_FILTER_NEW_MACRO(DislocationDensityTimeSeries)
+  PYB11_PROPERTY(StackFileListInfo InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
+  PYB11_PROPERTY(float BurgersVector READ getBurgersVector WRITE setBurgersVector)
+  PYB11_PROPERTY(FloatVec3Type CellSize READ getCellSize WRITE setCellSize)
+  PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+  PYB11_PROPERTY(QString DatasetName READ getDatasetName WRITE setDatasetName)
+  PYB11_END_BINDINGS()
+  // End Python bindings declarations
+
+public:
+  using Self = DislocationDensityTimeSeries;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static std::shared_ptr<DislocationDensityTimeSeries> New();
+
+  /**
+   * @brief Returns the name of the class for DislocationDensityTimeSeries
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for DislocationDensityTimeSeries
+   */
+  static QString ClassName();
+
+  ~DislocationDensityTimeSeries() override;
+
+  /**
+   * @brief Setter property for InputFileListInfo
+   */
+  void setInputFileListInfo(const StackFileListInfo& value);
+  /**
+   * @brief Getter property for InputFileListInfo
+   * @return Value of InputFileListInfo
+   */
+  StackFileListInfo getInputFileListInfo() const;
+  Q_PROPERTY(StackFileListInfo InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
+
+  /**
+   * @brief Setter property for BurgersVector
+   */
+  void setBurgersVector(float value);
+  /**
+   * @brief Getter property for BurgersVector
+   * @return Value of BurgersVector
+   */
+  float getBurgersVector() const;
+  Q_PROPERTY(float BurgersVector READ getBurgersVector WRITE setBurgersVector)
+
+  /**
+   * @brief Setter property for CellSize
+   */
+  void setCellSize(const FloatVec3Type& value);
+  /**
+   * @brief Getter property for CellSize
+   * @return Value of CellSize
+   */
+  FloatVec3Type getCellSize() const;
+  Q_PROPERTY(FloatVec3Type CellSize READ getCellSize WRITE setCellSize)
+
+  /**
+   * @brief Setter property for OutputFile
+   */
+  void setOutputFile(const QString& value);
+  /**
+   * @brief Getter property for OutputFile
+   * @return Value of OutputFile
+   */
+  QString getOutputFile() const;
+  Q_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+
+  /**
+   * @brief Setter property for DatasetName
+   */
+  void setDatasetName(const QString& value);
+  /**
+   * @brief Getter property for DatasetName
+   * @return Value of DatasetName
+   */
+  QString getDatasetName() const;
+  Q_PROPERTY(QString DatasetName READ getDatasetName WRITE setDatasetName)
+
+  /**
+   * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+   */
+  QString getCompiledLibraryName() const override;
+
+  /**
+   * @brief getBrandingString Returns the branding string for the filter, which is a tag
+   * used to denote the filter's association with specific plugins
+   * @return Branding string
+   */
+  QString getBrandingString() const override;
+
+  /**
+   * @brief getFilterVersion Returns a version string for this filter. Default
+   * value is an empty string.
+   * @return
+   */
+  QString getFilterVersion() const override;
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getGroupName() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  QUuid getUuid() const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  QString getHumanLabel() const override;
+
+  /**
+   * @brief This method will instantiate all the end user settable options/parameters
+   * for this filter
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief This method will read the options from a file
+   * @param reader The reader that is used to read the options from a file
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief Reimplemented from @see AbstractFilter class
+   */
+  void execute() override;
+
+protected:
+  DislocationDensityTimeSeries();
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  void dataCheck() override;
+
+  /**
+   * @brief Initializes all the private instance variables.
+   */
+  void initialize();
+
+  /**
+   * @brief Generates the list of snapshot files from the file list parameter
+   */
+  QVector<QString> generateFileList() const;
+
+private:
+  StackFileListInfo m_InputFileListInfo = {};
+  float m_BurgersVector = {2.5f};
+  FloatVec3Type m_CellSize = {1.0f, 1.0f, 1.0f};
+  QString m_OutputFile = {""};
+  QString m_DatasetName = {"DislocationLineDensity"};
+
+public:
+  DislocationDensityTimeSeries(const DislocationDensityTimeSeries&) = delete;            // Copy Constructor Not Implemented
+  DislocationDensityTimeSeries(DislocationDensityTimeSeries&&) = delete;                 // Move Constructor Not Implemented
+  DislocationDensityTimeSeries& operator=(const DislocationDensityTimeSeries&) = delete; // Copy Assignment Not Implemented
+  DislocationDensityTimeSeries& operator=(DislocationDensityTimeSeries&&) = delete;      // Move Assignment Not Implemented
+};
@@ -13,7 +13,11 @@
 
 #include "EstablishFoamMorphology.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <fstream>
+#include <unordered_map>
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
@@ -31,6 +35,7 @@
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
@@ -41,6 +46,7 @@
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/StatsData/PrecipitateStatsData.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/TimeUtilities.h"
 
 #include "EbsdLib/Core/Orientation.hpp"
@@ -50,6 +56,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/DistanceTransform.hpp"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -60,226 +67,9 @@
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_group.h>
 // clang-format on
 #endif
 
-/**
- * @brief The FindEuclideanMap2 class implements a threaded algorithm that computes the Euclidean distance map
- * for each point in the supplied volume
- */
-class FindEuclideanMap2
-{
-  DataContainer::Pointer m_DataContainer;
-  int32_t* m_FeatureIds;
-  int32_t* m_NearestNeighbors;
-  float* m_GBEuclideanDistances;
-  float* m_TJEuclideanDistances;
-  float* m_QPEuclideanDistances;
-  int32_t mapType;
-
-public:
-  FindEuclideanMap2(const DataContainer::Pointer& datacontainer, int32_t* fIds, int32_t* nearNeighs, float* gbDists, float* tjDists, float* qpDists, int32_t type)
-  : m_DataContainer(datacontainer)
-  , m_FeatureIds(fIds)
-  , m_NearestNeighbors(nearNeighs)
-  , m_GBEuclideanDistances(gbDists)
-  , m_TJEuclideanDistances(tjDists)
-  , m_QPEuclideanDistances(qpDists)
-  , mapType(type)
-  {
-  }
-
-  ~FindEuclideanMap2() = default;
-
-  void operator()() const
-  {
-    size_t totalPoints = m_DataContainer->getGeometryAs<ImageGeom>()->getNumberOfElements();
-    double euclideanDistance = 0.0f;
-    size_t count = 1;
-    size_t changed = 1;
-    size_t neighpoint = 0;
-    int64_t nearestneighbor;
-    std::array<int64_t, 6> neighbors = {0, 0, 0, 0, 0, 0};
-    ImageGeom::Pointer imageGeom = m_DataContainer->getGeometryAs<ImageGeom>();
-    int64_t xpoints = static_cast<int64_t>(imageGeom->getXPoints());
-    int64_t ypoints = static_cast<int64_t>(imageGeom->getYPoints());
-    int64_t zpoints = static_cast<int64_t>(imageGeom->getZPoints());
-
-    FloatVec3Type spacing = imageGeom->getSpacing();
-
-    double resx = static_cast<double>(spacing[0]);
-    double resy = static_cast<double>(spacing[1]);
-    double resz = static_cast<double>(spacing[2]);
-
-    neighbors[0] = -xpoints * ypoints;
-    neighbors[1] = -xpoints;
-    neighbors[2] = -1;
-    neighbors[3] = 1;
-    neighbors[4] = xpoints;
-    neighbors[5] = xpoints * ypoints;
-
-    // Use a std::vector to get an auto cleaned up array thus not needing the 'delete' keyword later on.
-    std::vector<int64_t> voxNN(totalPoints, 0);
-    int64_t* voxel_NearestNeighbor = &(voxNN.front());
-    std::vector<double> voxEDist(totalPoints, 0.0);
-    double* voxel_EuclideanDistance = &(voxEDist.front());
-
-    euclideanDistance = 0;
-    for(size_t a = 0; a < totalPoints; ++a)
-    {
-      if(m_NearestNeighbors[a * 3 + mapType] >= 0)
-      {
-        voxel_NearestNeighbor[a] = a;
-      } // if voxel is boundary voxel, then want to use itself as nearest boundary voxel
-      else
-      {
-        voxel_NearestNeighbor[a] = -1;
-      }
-      if(mapType == 0)
-      {
-        voxel_EuclideanDistance[a] = static_cast<double>(m_GBEuclideanDistances[a]);
-      }
-      else if(mapType == 1)
-      {
-        voxel_EuclideanDistance[a] = static_cast<double>(m_TJEuclideanDistances[a]);
-      }
-      else if(mapType == 2)
-      {
-        voxel_EuclideanDistance[a] = static_cast<double>(m_QPEuclideanDistances[a]);
-      }
-    }
-    count = 1;
-    changed = 1;
-    int64_t i = 0;
-    int64_t zBlock = xpoints * ypoints;
-    int64_t zStride = 0;
-    int64_t yStride = 0;
-    std::array<char, 6> mask = {0, 0, 0, 0, 0, 0};
-    while(count > 0 && changed > 0)
-    {
-      count = 0;
-      changed = 0;
-      euclideanDistance++;
-
-      for(int64_t z = 0; z < zpoints; ++z)
-      {
-        zStride = z * zBlock;
-        mask[0] = mask[5] = 1;
-        if(z == 0)
-        {
-          mask[0] = 0;
-        }
-        if(z == zpoints - 1)
-        {
-          mask[5] = 0;
-        }
-
-        for(int64_t y = 0; y < ypoints; ++y)
-        {
-          yStride = y * xpoints;
-          mask[1] = mask[4] = 1;
-          if(y == 0)
-          {
-            mask[1] = 0;
-          }
-          if(y == ypoints - 1)
-          {
-            mask[4] = 0;
-          }
-
-          for(int64_t x = 0; x < xpoints; ++x)
-          {
-            mask[2] = mask[3] = 1;
-            if(x == 0)
-            {
-              mask[2] = 0;
-            }
-            if(x == xpoints - 1)
-            {
-              mask[3] = 0;
-            }
-
-            i = zStride + yStride + x;
-            if(voxel_NearestNeighbor[i] == -1 && m_FeatureIds[i] > 0)
-            {
-              count++;
-              for(int32_t j = 0; j < 6; j++)
-              {
-                neighpoint = i + neighbors[j];
-                if(mask[j] == 1)
-                {
-                  if(voxel_EuclideanDistance[neighpoint] != -1.0)
-                  {
-                    voxel_NearestNeighbor[i] = voxel_NearestNeighbor[neighpoint];
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
-      for(size_t j = 0; j < totalPoints; ++j)
-      {
-        if(voxel_NearestNeighbor[j] != -1 && voxel_EuclideanDistance[j] == -1.0 && m_FeatureIds[j] > 0)
-        {
-          changed++;
-          voxel_EuclideanDistance[j] = euclideanDistance;
-        }
-      }
-    }
-    double x1 = 0.0;
-    double x2 = 0.0;
-    double y1 = 0.0;
-    double y2 = 0.0;
-    double z1 = 0.0;
-    double z2 = 0.0;
-    double dist = 0.0;
-    double oneOverzBlock = 1.0 / double(zBlock);
-    double oneOverxpoints = 1.0 / double(xpoints);
-    for(int64_t m = 0; m < zpoints; m++)
-    {
-      zStride = m * zBlock;
-      for(int64_t n = 0; n < ypoints; n++)
-      {
-        yStride = n * xpoints;
-        for(int64_t p = 0; p < xpoints; p++)
-        {
-          x1 = double(p) * resx;
-          y1 = double(n) * resy;
-          z1 = double(m) * resz;
-          nearestneighbor = voxel_NearestNeighbor[zStride + yStride + p];
-          if(nearestneighbor >= 0)
-          {
-            x2 = resx * double(nearestneighbor % xpoints);                           // find_xcoord(nearestneighbor);
-            y2 = resy * double(int64_t(nearestneighbor * oneOverxpoints) % ypoints); // find_ycoord(nearestneighbor);
-            z2 = resz * floor(nearestneighbor * oneOverzBlock);                      // find_zcoord(nearestneighbor);
-            dist = ((x1 - x2) * (x1 - x2)) + ((y1 - y2) * (y1 - y2)) + ((z1 - z2) * (z1 - z2));
-            dist = sqrt(dist);
-            voxel_EuclideanDistance[zStride + yStride + p] = dist;
-          }
-        }
-      }
-    }
-    for(size_t a = 0; a < totalPoints; ++a)
-    {
-      m_NearestNeighbors[a * 3 + mapType] = voxel_NearestNeighbor[a];
-      if(mapType == 0)
-      {
-        m_GBEuclideanDistances[a] = static_cast<float>(voxel_EuclideanDistance[a]);
-      }
-      else if(mapType == 1)
-      {
-        m_TJEuclideanDistances[a] = static_cast<float>(voxel_EuclideanDistance[a]);
-      }
-      else if(mapType == 2)
-      {
-        m_QPEuclideanDistances[a] = static_cast<float>(voxel_EuclideanDistance[a]);
-      }
-    }
-  }
-};
-
 /**
  * @brief The FoamAssignVoxelsGapsImpl class implements a threaded algorithm that assigns all the voxels
  * in the volume to a unique Feature.
@@ -438,6 +228,52 @@ public:
 #endif
 };
 
+namespace
+{
+/**
+ * @brief Derives the seed of the random stream of one trial move from the packing seed
+ * (SplitMix64 finalizer), so neighboring trials get unrelated streams
+ */
+uint64_t trialSeed(uint64_t seed, uint64_t trial)
+{
+  uint64_t z = seed + (trial + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+} // namespace
+
+/**
+ * @brief The EvaluateTrialMovesImpl class evaluates a batch of trial moves of the foam packing in
+ * parallel. The packing is only read while a batch is evaluated.
+ */
+class EvaluateTrialMovesImpl
+{
+public:
+  EvaluateTrialMovesImpl(const EstablishFoamMorphology* filter, const int32_t* featureOwners, int32_t firstIteration, std::vector<EstablishFoamMorphology::TrialMove_t>& trials)
+  : m_Filter(filter)
+  , m_FeatureOwners(featureOwners)
+  , m_FirstIteration(firstIteration)
+  , m_Trials(trials)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::unordered_map<int64_t, int32_t> ownerDeltas;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Filter->evaluate_trialmove(m_FirstIteration + static_cast<int32_t>(i), m_FeatureOwners, ownerDeltas, m_Trials[i]);
+    }
+  }
+
+private:
+  const EstablishFoamMorphology* m_Filter = nullptr;
+  const int32_t* m_FeatureOwners = nullptr;
+  int32_t m_FirstIteration = 0;
+  std::vector<EstablishFoamMorphology::TrialMove_t>& m_Trials;
+};
+
 // Include the MOC generated file for this class
 #include "moc_EstablishFoamMorphology.cpp"
 
@@ -478,8 +314,8 @@ void EstablishFoamMorphology::initialize()
   m_PlaneList.clear();
   m_EllipFuncList.clear();
 
-  m_PointsToAdd.clear();
-  m_PointsToRemove.clear();
+  m_AvailablePoints.clear();
+  m_AvailablePointsInv.clear();
   m_Seed = QDateTime::currentMSecsSinceEpoch();
   m_FirstFoamFeature = 1;
   m_SizeX = m_SizeY = m_SizeZ = m_TotalVol = 0.0f;
@@ -493,7 +329,10 @@ void EstablishFoamMorphology::initialize()
   m_TotalPackingPoints = 1;
 
   m_FeatureSizeDist.clear();
-  m_SimFeatureSizeDist.clear();
+  m_SimFeatureSizeCounts.clear();
+  m_SimFeatureCounts.clear();
+  m_SimFeatureSizeBhattSums.clear();
+  m_HalfMinFeatureDiameters.clear();
   m_NeighborDist.clear();
   m_SimNeighborDist.clear();
 
@@ -506,7 +345,7 @@ void EstablishFoamMorphology::initialize()
   m_PrecipitatePhases.clear();
   m_PrecipitatePhaseFractions.clear();
 
-  m_AvailablePointsCount = 1;
+  m_FillingErrorSum = 0;
   m_FillingError = m_OldFillingError = 0.0f;
   m_CurrentNeighborhoodError = m_OldNeighborhoodError = 0.0f;
   m_CurrentSizeDistError = m_OldSizeDistError = 0.0f;
@@ -519,6 +358,8 @@ void EstablishFoamMorphology::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_BOOL_FP("Periodic Boundaries", PeriodicBoundaries, FilterParameter::Category::Parameter, EstablishFoamMorphology));
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Parallel Packing", ParallelPacking, FilterParameter::Category::Parameter, EstablishFoamMorphology, {"PackingSeed"}));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Packing Seed", PackingSeed, FilterParameter::Category::Parameter, EstablishFoamMorphology));
 
   parameters.push_back(SeparatorFilterParameter::Create("Data Container", FilterParameter::Category::RequiredArray));
   {
@@ -1086,7 +927,8 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
   }
 
   clearErrorCode();
-  m_Seed = QDateTime::currentMSecsSinceEpoch();
+  // The parallel packing is reproducible, so it starts from the user supplied seed
+  m_Seed = m_ParallelPacking ? static_cast<uint64_t>(m_PackingSeed) : QDateTime::currentMSecsSinceEpoch();
   SIMPL_RANDOMNG_NEW_SEEDED(m_Seed);
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixPath().getDataContainerName());
@@ -1167,33 +1009,29 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
   Int32ArrayType::Pointer exclusionOwnersPtr = Int32ArrayType::CreateArray(m_TotalPackingPoints, cDim, "_INTERNAL_USE_ONLY_PackPrecipitateFeatures::exclusions_owners", true);
   exclusionOwnersPtr->initializeWithValue(0);
 
-  // This is the set that we are going to keep updated with the points that are not in an exclusion zone
-  std::map<size_t, size_t> availablePoints;
-  std::map<size_t, size_t> availablePointsInv;
-
   // Get a pointer to the Feature Owners that was just initialized in the initialize_packinggrid() method
   int32_t* featureOwners = featureOwnersPtr->getPointer(0);
   int32_t* exclusionOwners = exclusionOwnersPtr->getPointer(0);
   int64_t featureOwnersIdx = 0;
 
-  // determine initial set of available points
-  m_AvailablePointsCount = 0;
+  // determine initial set of available points; check_fillingerror keeps it updated from here on
+  m_AvailablePoints.clear();
+  m_AvailablePoints.reserve(static_cast<size_t>(m_TotalPackingPoints));
+  m_AvailablePointsInv.assign(static_cast<size_t>(m_TotalPackingPoints), -1);
   for(int64_t i = 0; i < m_TotalPackingPoints; i++)
   {
     if(exclusionOwners[i] == 0)
     {
-      availablePoints[i] = m_AvailablePointsCount;
-      availablePointsInv[m_AvailablePointsCount] = i;
-      m_AvailablePointsCount++;
+      add_availablepoint(i);
     }
   }
-  // and clear the pointsToRemove and pointsToAdd vectors from the initial packing
-  m_PointsToRemove.clear();
-  m_PointsToAdd.clear();
 
   // initialize the sim and goal size distributions for the precipitate phases
   m_FeatureSizeDist.resize(m_PrecipitatePhases.size());
-  m_SimFeatureSizeDist.resize(m_PrecipitatePhases.size());
+  m_SimFeatureSizeCounts.resize(m_PrecipitatePhases.size());
+  m_SimFeatureCounts.assign(m_PrecipitatePhases.size(), 0);
+  m_SimFeatureSizeBhattSums.assign(m_PrecipitatePhases.size(), 0.0);
+  m_HalfMinFeatureDiameters.resize(m_PrecipitatePhases.size());
   m_FeatureSizeDistStep.resize(m_PrecipitatePhases.size());
   size_t numPrecipitatePhases = m_PrecipitatePhases.size();
   for(size_t i = 0; i < numPrecipitatePhases; i++)
@@ -1204,7 +1042,8 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
     {
     }
     m_FeatureSizeDist[i].resize(40);
-    m_SimFeatureSizeDist[i].resize(40);
+    m_SimFeatureSizeCounts[i].assign(40, 0);
+    m_HalfMinFeatureDiameters[i] = pp->getMinFeatureDiameter() * 0.5f;
     m_FeatureSizeDistStep[i] = static_cast<float>(((2 * pp->getMaxFeatureDiameter()) - (pp->getMinFeatureDiameter() / 2.0f)) / m_FeatureSizeDist[i].size());
     float input = 0.0f;
     float previoustotal = 0.0f;
@@ -1278,6 +1117,7 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
         }
 
         transfer_attributes(gid, &feature);
+        add_to_sizedist(&feature);
         m_OldSizeDistError = m_CurrentSizeDistError;
         curphasevol[j] = curphasevol[j] + m_Volumes[gid];
         iter = 0;
@@ -1323,6 +1163,7 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
             updateFeatureInstancePointers();
           }
           transfer_attributes(gid, &feature);
+          add_to_sizedist(&feature);
           m_OldSizeDistError = m_CurrentSizeDistError;
           curphasevol[j] = curphasevol[j] + m_Volumes[gid];
           iter = 0;
@@ -1373,6 +1214,7 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
   m_EllipFuncList.resize(totalFeatures);
   m_PackQualities.resize(totalFeatures);
   m_FillingError = 1.0f;
+  m_FillingErrorSum = m_TotalPackingPoints;
 
   int64_t count = 0;
   int64_t column = 0;
@@ -1453,26 +1295,17 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
   // begin swaping/moving/adding/removing features to try to improve packing
   int32_t totalAdjustments = static_cast<int32_t>(100 * (totalFeatures - 1));
 
-  // determine initial set of available points
-  m_AvailablePointsCount = 0;
-  for(int64_t i = 0; i < m_TotalPackingPoints; i++)
+  if(m_ParallelPacking)
   {
-    if(exclusionOwners[i] == 0)
-    {
-      availablePoints[i] = m_AvailablePointsCount;
-      availablePointsInv[m_AvailablePointsCount] = i;
-      m_AvailablePointsCount++;
-    }
+    adjust_features_parallel(totalAdjustments, featureOwnersPtr, exclusionOwnersPtr, outFile, writeErrorFile);
+    return;
   }
 
-  // and clear the pointsToRemove and pointsToAdd vectors from the initial packing
-  m_PointsToRemove.clear();
-  m_PointsToAdd.clear();
-
   millis = QDateTime::currentMSecsSinceEpoch();
   startMillis = millis;
   bool good = false;
   size_t key = 0;
+  int64_t oldFillingErrorSum = 0;
   float xshift = 0.0f;
   float yshift = 0.0f;
   float zshift = 0.0f;
@@ -1502,7 +1335,9 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
 
     if(writeErrorFile && iteration % 25 == 0)
     {
-      outFile << iteration << " " << m_FillingError << "  " << availablePoints.size() << "  " << m_AvailablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
+      // The available point count fills two columns, which used to hold the size of the
+      // available point list and a separate count, so the file keeps its six columns
+      outFile << iteration << " " << m_FillingError << "  " << m_AvailablePoints.size() << "  " << m_AvailablePoints.size() << " " << totalFeatures << " " << acceptedmoves << "\n";
     }
 
     // JUMP - this option moves one feature to a random spot in the volume
@@ -1536,10 +1371,10 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
       }
       m_Seed++;
 
-      if(!availablePoints.empty())
+      if(!m_AvailablePoints.empty())
       {
-        key = static_cast<size_t>(rg.genrand_res53() * (m_AvailablePointsCount - 1));
-        featureOwnersIdx = availablePointsInv[key];
+        key = static_cast<size_t>(rg.genrand_res53() * (m_AvailablePoints.size() - 1));
+        featureOwnersIdx = m_AvailablePoints[key];
       }
       else
       {
@@ -1557,17 +1392,16 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
       oldyc = m_Centroids[3 * randomfeature + 1];
       oldzc = m_Centroids[3 * randomfeature + 2];
       m_OldFillingError = m_FillingError;
+      oldFillingErrorSum = m_FillingErrorSum;
       m_FillingError = check_fillingerror(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
       move_feature(randomfeature, xc, yc, zc);
       m_FillingError = check_fillingerror(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
 
-      if(m_FillingError > m_OldFillingError)
+      if(m_FillingErrorSum > oldFillingErrorSum)
       {
         m_FillingError = check_fillingerror(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
         move_feature(randomfeature, oldxc, oldyc, oldzc);
         m_FillingError = check_fillingerror(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        m_PointsToRemove.clear();
-        m_PointsToAdd.clear();
       }
     }
 
@@ -1632,22 +1466,231 @@ void EstablishFoamMorphology::place_features(const Int32ArrayType::Pointer& feat
         zc = oldzc;
       }
       m_OldFillingError = m_FillingError;
+      oldFillingErrorSum = m_FillingErrorSum;
       m_FillingError = check_fillingerror(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
       move_feature(randomfeature, xc, yc, zc);
       m_FillingError = check_fillingerror(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
 
-      if(m_FillingError > m_OldFillingError)
+      if(m_FillingErrorSum > oldFillingErrorSum)
       {
         m_FillingError = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
         move_feature(randomfeature, oldxc, oldyc, oldzc);
         m_FillingError = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        m_PointsToRemove.clear();
-        m_PointsToAdd.clear();
       }
     }
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::adjust_features_parallel(int32_t totalAdjustments, const Int32ArrayType::Pointer& featureOwnersPtr, const Int32ArrayType::Pointer& exclusionOwnersPtr,
+                                                       std::ofstream& outFile, bool writeErrorFile)
+{
+  // The batch size is fixed so the accepted moves do not depend on the number of threads
+  constexpr int32_t k_BatchSize = 256;
+
+  const int32_t* featureOwners = featureOwnersPtr->getPointer(0);
+  size_t totalFeatures = m_ColumnList.size();
+
+  std::vector<TrialMove_t> trials(k_BatchSize);
+  // Index of the last batch that changed a packing point or a Feature
+  std::vector<int32_t> pointStamps(static_cast<size_t>(m_TotalPackingPoints), -1);
+  std::vector<int32_t> featureStamps(totalFeatures, -1);
+
+  int32_t acceptedmoves = 0;
+  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
+  uint64_t startMillis = millis;
+  for(int32_t firstIteration = 0; firstIteration < totalAdjustments; firstIteration += k_BatchSize)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+
+    uint64_t currentMillis = QDateTime::currentMSecsSinceEpoch();
+    if(currentMillis - millis > 1000)
+    {
+      float timeDiff = ((float)firstIteration / (float)(currentMillis - startMillis));
+      uint64_t estimatedTime = (float)(totalAdjustments - firstIteration) / timeDiff;
+      QString ss = QObject::tr("Swapping/Moving Features in Parallel Iteration %1/%2").arg(firstIteration).arg(totalAdjustments);
+      ss += QObject::tr(" || Est. Time Remain: %1 || Iterations/Sec: %2").arg(DREAM3D::convertMillisToHrsMinSecs(estimatedTime)).arg(timeDiff * 1000);
+      notifyStatusMessage(ss);
+      millis = currentMillis;
+    }
+
+    if(writeErrorFile)
+    {
+      // Same six columns as the serial placement
+      outFile << firstIteration << " " << m_FillingError << "  " << m_AvailablePoints.size() << "  " << m_AvailablePoints.size() << " " << totalFeatures << " " << acceptedmoves << "\n";
+    }
+
+    int32_t batchSize = std::min(k_BatchSize, totalAdjustments - firstIteration);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, static_cast<size_t>(batchSize));
+    dataAlg.execute(EvaluateTrialMovesImpl(this, featureOwners, firstIteration, trials));
+
+    // Commit in trial order. A trial was evaluated against the packing at the start of the
+    // batch, so it is only valid if no earlier commit of this batch touched its Feature or points.
+    for(int32_t i = 0; i < batchSize; i++)
+    {
+      TrialMove_t& trial = trials[i];
+      if(trial.m_Feature < 0 || trial.m_FillingErrorDelta > 0)
+      {
+        continue;
+      }
+      bool conflict = featureStamps[trial.m_Feature] == firstIteration;
+      for(size_t j = 0; j < trial.m_Points.size() && !conflict; j++)
+      {
+        conflict = pointStamps[trial.m_Points[j]] == firstIteration;
+      }
+      if(conflict)
+      {
+        continue;
+      }
+      featureStamps[trial.m_Feature] = firstIteration;
+      for(int64_t point : trial.m_Points)
+      {
+        pointStamps[point] = firstIteration;
+      }
+
+      check_fillingerror(-1000, trial.m_Feature, featureOwnersPtr, exclusionOwnersPtr);
+      move_feature(trial.m_Feature, trial.m_Centroid[0], trial.m_Centroid[1], trial.m_Centroid[2]);
+      m_FillingError = check_fillingerror(trial.m_Feature, -1000, featureOwnersPtr, exclusionOwnersPtr);
+      acceptedmoves++;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::evaluate_trialmove(int32_t iteration, const int32_t* featureOwners, std::unordered_map<int64_t, int32_t>& ownerDeltas, TrialMove_t& trial) const
+{
+  trial.m_Feature = -1;
+  trial.m_FillingErrorDelta = 0;
+  trial.m_Points.clear();
+
+  int32_t totalFeatures = static_cast<int32_t>(m_ColumnList.size());
+  int32_t numFoamFeatures = totalFeatures - m_FirstFoamFeature;
+  if(numFoamFeatures <= 0)
+  {
+    return;
+  }
+
+  uint64_t seed = trialSeed(static_cast<uint64_t>(m_PackingSeed), static_cast<uint64_t>(iteration));
+  SIMPL_RANDOMNG_NEW_SEEDED(seed);
+
+  const auto packingCell = [this](float xc, float yc, float zc) {
+    return std::array<int64_t, 3>{static_cast<int64_t>((xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]), static_cast<int64_t>((yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]),
+                                  static_cast<int64_t>((zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2])};
+  };
+
+  // Same selection as the serial packing: prefer a Feature whose centroid point is shared
+  int32_t randomfeature = m_FirstFoamFeature + int32_t(rg.genrand_res53() * numFoamFeatures);
+  bool good = false;
+  int32_t count = 0;
+  while(!good && count < numFoamFeatures)
+  {
+    std::array<int64_t, 3> cell = packingCell(m_Centroids[3 * randomfeature], m_Centroids[3 * randomfeature + 1], m_Centroids[3 * randomfeature + 2]);
+    int64_t featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * cell[2]) + (m_PackingPoints[0] * cell[1]) + cell[0];
+    if(featureOwners[featureOwnersIdx] > 1)
+    {
+      good = true;
+    }
+    else
+    {
+      randomfeature++;
+    }
+    if(randomfeature >= totalFeatures)
+    {
+      randomfeature = m_FirstFoamFeature;
+    }
+    count++;
+  }
+
+  float oldxc = m_Centroids[3 * randomfeature];
+  float oldyc = m_Centroids[3 * randomfeature + 1];
+  float oldzc = m_Centroids[3 * randomfeature + 2];
+  float xc = oldxc;
+  float yc = oldyc;
+  float zc = oldzc;
+  if(iteration % 2 == 0)
+  {
+    // JUMP - move the Feature to a random available point
+    int64_t featureOwnersIdx = 0;
+    if(!m_AvailablePoints.empty())
+    {
+      size_t key = static_cast<size_t>(rg.genrand_res53() * (m_AvailablePoints.size() - 1));
+      featureOwnersIdx = m_AvailablePoints[key];
+    }
+    else
+    {
+      featureOwnersIdx = static_cast<int64_t>(rg.genrand_res53() * m_TotalPackingPoints);
+    }
+    int64_t column = featureOwnersIdx % m_PackingPoints[0];
+    int64_t row = (featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
+    int64_t plane = featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]);
+    xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
+    yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
+    zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
+  }
+  else
+  {
+    // NUDGE - move the Feature to a spot close to its current centroid
+    float xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])));
+    float yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])));
+    float zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])));
+    if((oldxc + xshift) < m_SizeX && (oldxc + xshift) > 0)
+    {
+      xc = oldxc + xshift;
+    }
+    if((oldyc + yshift) < m_SizeY && (oldyc + yshift) > 0)
+    {
+      yc = oldyc + yshift;
+    }
+    if((oldzc + zshift) < m_SizeZ && (oldzc + zshift) > 0)
+    {
+      zc = oldzc + zshift;
+    }
+  }
+
+  // Net change of the owner count of every packing point touched by the move; the points
+  // covered by both the old and the new position cancel out
+  std::array<int64_t, 3> oldCell = packingCell(oldxc, oldyc, oldzc);
+  std::array<int64_t, 3> newCell = packingCell(xc, yc, zc);
+  const std::vector<int64_t>& cl = m_ColumnList[randomfeature];
+  const std::vector<int64_t>& rl = m_RowList[randomfeature];
+  const std::vector<int64_t>& pl = m_PlaneList[randomfeature];
+  size_t numVoxels = cl.size();
+  ownerDeltas.clear();
+  for(size_t i = 0; i < numVoxels; i++)
+  {
+    int64_t featureOwnersIdx = find_packingindex(cl[i], rl[i], pl[i]);
+    if(featureOwnersIdx >= 0)
+    {
+      ownerDeltas[featureOwnersIdx]--;
+    }
+    featureOwnersIdx = find_packingindex(cl[i] + newCell[0] - oldCell[0], rl[i] + newCell[1] - oldCell[1], pl[i] + newCell[2] - oldCell[2]);
+    if(featureOwnersIdx >= 0)
+    {
+      ownerDeltas[featureOwnersIdx]++;
+    }
+  }
+
+  // A packing point with n owners contributes (n - 1)^2 to the filling error sum
+  trial.m_Points.reserve(ownerDeltas.size());
+  for(const auto& ownerDelta : ownerDeltas)
+  {
+    int64_t before = featureOwners[ownerDelta.first] - 1;
+    int64_t after = before + ownerDelta.second;
+    trial.m_FillingErrorDelta += after * after - before * before;
+    trial.m_Points.push_back(ownerDelta.first);
+  }
+  trial.m_Feature = randomfeature;
+  trial.m_Centroid = {xc, yc, zc};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -2132,88 +2175,69 @@ void EstablishFoamMorphology::compare_3Ddistributions(std::vector<std::vector<st
 // -----------------------------------------------------------------------------
 float EstablishFoamMorphology::check_sizedisterror(Feature_t* feature)
 {
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixPath().getDataContainerName());
-
-  StatsDataArray& statsDataArray = *(m_StatsDataArray.lock());
-
-  float dia = 0.0f;
-  float sizedisterror = 0.0f;
-  float bhattdist = 0.0f;
-  int32_t index = 0;
-  int32_t count = 0;
-  int32_t phase = 0;
+  // The histograms of the accepted Features are kept by add_to_sizedist(), so only the
+  // bin the candidate falls into changes. With c_b the counts, n their total and g_b the
+  // goal distribution, the Bhattacharyya coefficient of a phase is sum(sqrt(c_b * g_b)) / sqrt(n),
+  // so patching one term of the running sum gives the error without visiting any Feature.
+  double bhattdist = 0.0;
   size_t featureSizeDist_Size = m_FeatureSizeDist.size();
   for(size_t iter = 0; iter < featureSizeDist_Size; ++iter)
   {
-    phase = m_PrecipitatePhases[iter];
-    PrecipitateStatsData::Pointer pp = std::dynamic_pointer_cast<PrecipitateStatsData>(statsDataArray[phase]);
-    count = 0;
-    std::vector<float>& curFeatureSizeDist = m_FeatureSizeDist[iter];
-    std::vector<float>::size_type curFeatureSizeDistSize = curFeatureSizeDist.size();
-    std::vector<float>& curSimFeatureSizeDist = m_SimFeatureSizeDist[iter];
-    // Initialize all Values to Zero
-    for(size_t i = 0; i < curFeatureSizeDistSize; i++)
+    double bhattSum = m_SimFeatureSizeBhattSums[iter];
+    int32_t count = m_SimFeatureCounts[iter];
+    if(feature->m_FeaturePhases == m_PrecipitatePhases[iter])
     {
-      curSimFeatureSizeDist[i] = 0.0f;
+      size_t bin = find_sizedistbin(iter, feature->m_EquivalentDiameters);
+      double binCount = static_cast<double>(m_SimFeatureSizeCounts[iter][bin]);
+      double goal = static_cast<double>(m_FeatureSizeDist[iter][bin]);
+      bhattSum = bhattSum + std::sqrt((binCount + 1.0) * goal) - std::sqrt(binCount * goal);
+      count++;
     }
-    int64_t totalFeatures = m->getAttributeMatrix(getOutputCellFeatureAttributeMatrixName())->getNumberOfTuples();
-    float oneOverCurFeatureSizeDistStep = 1.0f / m_FeatureSizeDistStep[iter];
-    float halfMinFeatureDiameter = pp->getMinFeatureDiameter() * 0.5f;
-    for(int32_t b = m_FirstFoamFeature; b < totalFeatures; b++)
+    if(count > 0)
     {
-      index = b;
-      if(m_FeaturePhases[index] == phase)
-      {
-        dia = m_EquivalentDiameters[index];
-        dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-        if(dia < 0)
-        {
-          dia = 0.0f;
-        }
-        if(dia > curFeatureSizeDistSize - 1.0f)
-        {
-          dia = curFeatureSizeDistSize - 1.0f;
-        }
-        curSimFeatureSizeDist[int32_t(dia)]++;
-        count++;
-      }
+      bhattdist = bhattdist + bhattSum / std::sqrt(static_cast<double>(count));
     }
+  }
+  return static_cast<float>(bhattdist);
+}
 
-    if(feature->m_FeaturePhases == phase)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::add_to_sizedist(Feature_t* feature)
+{
+  size_t numPhases = m_PrecipitatePhases.size();
+  for(size_t iter = 0; iter < numPhases; ++iter)
+  {
+    if(feature->m_FeaturePhases != m_PrecipitatePhases[iter])
     {
-      dia = feature->m_EquivalentDiameters;
-      dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-      if(dia < 0)
-      {
-        dia = 0.0f;
-      }
-      if(dia > curFeatureSizeDistSize - 1.0f)
-      {
-        dia = curFeatureSizeDistSize - 1.0f;
-      }
-      curSimFeatureSizeDist[int32_t(dia)]++;
-      count++;
+      continue;
     }
-    float oneOverCount = 1.0f / count;
+    size_t bin = find_sizedistbin(iter, feature->m_EquivalentDiameters);
+    int32_t& binCount = m_SimFeatureSizeCounts[iter][bin];
+    double goal = static_cast<double>(m_FeatureSizeDist[iter][bin]);
+    m_SimFeatureSizeBhattSums[iter] = m_SimFeatureSizeBhattSums[iter] + std::sqrt((binCount + 1.0) * goal) - std::sqrt(binCount * goal);
+    binCount++;
+    m_SimFeatureCounts[iter]++;
+  }
+}
 
-    if(count == 0)
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = 0.0;
-      }
-    }
-    else
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = curSimFeatureSizeDist[i] * oneOverCount;
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t EstablishFoamMorphology::find_sizedistbin(size_t phaseIndex, float diameter) const
+{
+  float numBins = static_cast<float>(m_FeatureSizeDist[phaseIndex].size());
+  float dia = (diameter - m_HalfMinFeatureDiameters[phaseIndex]) * (1.0f / m_FeatureSizeDistStep[phaseIndex]);
+  if(dia < 0)
+  {
+    dia = 0.0f;
   }
-  compare_2Ddistributions(m_SimFeatureSizeDist, m_FeatureSizeDist, bhattdist);
-  sizedisterror = bhattdist;
-  return sizedisterror;
+  if(dia > numBins - 1.0f)
+  {
+    dia = numBins - 1.0f;
+  }
+  return static_cast<size_t>(dia);
 }
 
 // -----------------------------------------------------------------------------
@@ -2221,22 +2245,16 @@ float EstablishFoamMorphology::check_sizedisterror(Feature_t* feature)
 // -----------------------------------------------------------------------------
 float EstablishFoamMorphology::check_fillingerror(int32_t gadd, int32_t gremove, const Int32ArrayType::Pointer& featureOwnersPtr, const Int32ArrayType::Pointer& exclusionOwnersPtr)
 {
-  size_t featureOwnersIdx = 0;
   int32_t* featureOwners = featureOwnersPtr->getPointer(0);
   int32_t* exclusionOwners = exclusionOwnersPtr->getPointer(0);
 
-  m_FillingError = m_FillingError * float(m_TotalPackingPoints);
-  int64_t col = 0;
-  int64_t row = 0;
-  int64_t plane = 0;
-  int32_t k1 = 0;
-  int32_t k2 = 0;
-  int32_t k3 = 0;
+  // The error is the sum of (n - 1)^2 over all packing points, where n is the number of
+  // Features owning the point, divided by the number of packing points. Adding an owner
+  // to a point changes the sum by 2n - 1 and removing one by 3 - 2n, so the running sum
+  // is exact integer arithmetic and each call only visits the points of the Features
+  // involved.
   if(gadd > 0)
   {
-    k1 = 2;
-    k2 = -1;
-    k3 = 1;
     size_t numVoxelsForCurrentGrain = m_ColumnList[gadd].size();
     std::vector<int64_t>& cl = m_ColumnList[gadd];
     std::vector<int64_t>& rl = m_RowList[gadd];
@@ -2245,81 +2263,28 @@ float EstablishFoamMorphology::check_fillingerror(int32_t gadd, int32_t gremove,
     float packquality = 0;
     for(size_t i = 0; i < numVoxelsForCurrentGrain; i++)
     {
-      col = cl[i];
-      row = rl[i];
-      plane = pl[i];
-      if(m_PeriodicBoundaries)
+      int64_t featureOwnersIdx = find_packingindex(cl[i], rl[i], pl[i]);
+      if(featureOwnersIdx < 0)
       {
-        if(col < 0)
-        {
-          col = col + m_PackingPoints[0];
-        }
-        if(col > m_PackingPoints[0] - 1)
-        {
-          col = col - m_PackingPoints[0];
-        }
-        if(row < 0)
-        {
-          row = row + m_PackingPoints[1];
-        }
-        if(row > m_PackingPoints[1] - 1)
-        {
-          row = row - m_PackingPoints[1];
-        }
-        if(plane < 0)
-        {
-          plane = plane + m_PackingPoints[2];
-        }
-        if(plane > m_PackingPoints[2] - 1)
-        {
-          plane = plane - m_PackingPoints[2];
-        }
-        featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
-        int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
-        if(efl[i] > 0.1f)
-        {
-          if(exclusionOwners[featureOwnersIdx] == 0)
-          {
-            m_PointsToRemove.push_back(featureOwnersIdx);
-          }
-          exclusionOwners[featureOwnersIdx]++;
-        }
-        m_FillingError = static_cast<float>(m_FillingError + ((k1 * currentFeatureOwner + k2)));
-        //        fillingerror = fillingerror + (multiplier * (k1 * currentFeatureOwner  + k2));
-        featureOwners[featureOwnersIdx] = currentFeatureOwner + k3;
-        packquality = static_cast<float>(packquality + ((currentFeatureOwner) * (currentFeatureOwner)));
+        continue;
       }
-      else
+      int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
+      if(efl[i] > 0.1f)
       {
-        if(col >= 0 && col < m_PackingPoints[0] && row >= 0 && row < m_PackingPoints[1] && plane >= 0 && plane < m_PackingPoints[2])
+        if(exclusionOwners[featureOwnersIdx] == 0)
         {
-          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
-          int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
-          if(exclusionOwners[featureOwnersIdx] > 0)
-          {
-          }
-          if(efl[i] > 0.1f)
-          {
-            if(exclusionOwners[featureOwnersIdx] == 0)
-            {
-              m_PointsToRemove.push_back(featureOwnersIdx);
-            }
-            exclusionOwners[featureOwnersIdx]++;
-          }
-          m_FillingError = static_cast<float>(m_FillingError + ((k1 * currentFeatureOwner + k2)));
-          //        fillingerror = fillingerror + (multiplier * (k1 * currentFeatureOwner  + k2));
-          featureOwners[featureOwnersIdx] = currentFeatureOwner + k3;
-          packquality = static_cast<float>(packquality + ((currentFeatureOwner) * (currentFeatureOwner)));
+          remove_availablepoint(featureOwnersIdx);
         }
+        exclusionOwners[featureOwnersIdx]++;
       }
+      m_FillingErrorSum = m_FillingErrorSum + (2 * currentFeatureOwner - 1);
+      featureOwners[featureOwnersIdx] = currentFeatureOwner + 1;
+      packquality = static_cast<float>(packquality + ((currentFeatureOwner) * (currentFeatureOwner)));
     }
     m_PackQualities[gadd] = static_cast<int64_t>(packquality / float(numVoxelsForCurrentGrain));
   }
   if(gremove > 0)
   {
-    k1 = -2;
-    k2 = 3;
-    k3 = -1;
     size_t size = m_ColumnList[gremove].size();
     std::vector<int64_t>& cl = m_ColumnList[gremove];
     std::vector<int64_t>& rl = m_RowList[gremove];
@@ -2327,107 +2292,95 @@ float EstablishFoamMorphology::check_fillingerror(int32_t gadd, int32_t gremove,
     std::vector<float>& efl = m_EllipFuncList[gremove];
     for(size_t i = 0; i < size; i++)
     {
-      col = cl[i];
-      row = rl[i];
-      plane = pl[i];
-      if(m_PeriodicBoundaries)
+      int64_t featureOwnersIdx = find_packingindex(cl[i], rl[i], pl[i]);
+      if(featureOwnersIdx < 0)
       {
-        if(col < 0)
-        {
-          col = col + m_PackingPoints[0];
-        }
-        if(col > m_PackingPoints[0] - 1)
-        {
-          col = col - m_PackingPoints[0];
-        }
-        if(row < 0)
-        {
-          row = row + m_PackingPoints[1];
-        }
-        if(row > m_PackingPoints[1] - 1)
-        {
-          row = row - m_PackingPoints[1];
-        }
-        if(plane < 0)
-        {
-          plane = plane + m_PackingPoints[2];
-        }
-        if(plane > m_PackingPoints[2] - 1)
-        {
-          plane = plane - m_PackingPoints[2];
-        }
-        featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
-        int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
-        if(efl[i] > 0.1f)
-        {
-          exclusionOwners[featureOwnersIdx]--;
-          if(exclusionOwners[featureOwnersIdx] == 0)
-          {
-            m_PointsToAdd.push_back(featureOwnersIdx);
-          }
-        }
-        m_FillingError = static_cast<float>(m_FillingError + ((k1 * currentFeatureOwner + k2)));
-        //        fillingerror = fillingerror + (multiplier * (k1 * currentFeatureOwner  + k2));
-        featureOwners[featureOwnersIdx] = currentFeatureOwner + k3;
+        continue;
       }
-      else
+      int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
+      if(efl[i] > 0.1f)
       {
-        if(col >= 0 && col < m_PackingPoints[0] && row >= 0 && row < m_PackingPoints[1] && plane >= 0 && plane < m_PackingPoints[2])
+        exclusionOwners[featureOwnersIdx]--;
+        if(exclusionOwners[featureOwnersIdx] == 0)
         {
-          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
-          int32_t currentFeatureOwner = featureOwners[featureOwnersIdx];
-          if(efl[i] > 0.1f)
-          {
-            exclusionOwners[featureOwnersIdx]--;
-            if(exclusionOwners[featureOwnersIdx] == 0)
-            {
-              m_PointsToAdd.push_back(featureOwnersIdx);
-            }
-          }
-          m_FillingError = static_cast<float>(m_FillingError + ((k1 * currentFeatureOwner + k2)));
-          //          fillingerror = fillingerror + (multiplier * (k1 * currentFeatureOwner  + k2));
-          featureOwners[featureOwnersIdx] = currentFeatureOwner + k3;
+          add_availablepoint(featureOwnersIdx);
         }
       }
+      m_FillingErrorSum = m_FillingErrorSum + (3 - 2 * currentFeatureOwner);
+      featureOwners[featureOwnersIdx] = currentFeatureOwner - 1;
     }
   }
-  m_FillingError = m_FillingError / float(m_TotalPackingPoints);
+  m_FillingError = static_cast<float>(static_cast<double>(m_FillingErrorSum) / static_cast<double>(m_TotalPackingPoints));
   return m_FillingError;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void EstablishFoamMorphology::update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv)
+int64_t EstablishFoamMorphology::find_packingindex(int64_t col, int64_t row, int64_t plane) const
 {
-  size_t removeSize = m_PointsToRemove.size();
-  size_t addSize = m_PointsToAdd.size();
-  size_t featureOwnersIdx = 0;
-  size_t key = 0;
-  size_t val = 0;
-  for(size_t i = 0; i < removeSize; i++)
+  if(m_PeriodicBoundaries)
   {
-    featureOwnersIdx = m_PointsToRemove[i];
-    key = availablePoints[featureOwnersIdx];
-    //  availablePoints.erase(featureOwnersIdx);
-    val = availablePointsInv[m_AvailablePointsCount - 1];
-    //  availablePointsInv.erase(availablePointsCount-1);
-    if(key < m_AvailablePointsCount - 1)
+    if(col < 0)
     {
-      availablePointsInv[key] = val;
-      availablePoints[val] = key;
+      col = col + m_PackingPoints[0];
+    }
+    if(col > m_PackingPoints[0] - 1)
+    {
+      col = col - m_PackingPoints[0];
+    }
+    if(row < 0)
+    {
+      row = row + m_PackingPoints[1];
+    }
+    if(row > m_PackingPoints[1] - 1)
+    {
+      row = row - m_PackingPoints[1];
+    }
+    if(plane < 0)
+    {
+      plane = plane + m_PackingPoints[2];
+    }
+    if(plane > m_PackingPoints[2] - 1)
+    {
+      plane = plane - m_PackingPoints[2];
     }
-    m_AvailablePointsCount--;
   }
-  for(size_t i = 0; i < addSize; i++)
+  else if(col < 0 || col >= m_PackingPoints[0] || row < 0 || row >= m_PackingPoints[1] || plane < 0 || plane >= m_PackingPoints[2])
   {
-    featureOwnersIdx = m_PointsToAdd[i];
-    availablePoints[featureOwnersIdx] = m_AvailablePointsCount;
-    availablePointsInv[m_AvailablePointsCount] = featureOwnersIdx;
-    m_AvailablePointsCount++;
+    return -1;
   }
-  m_PointsToRemove.clear();
-  m_PointsToAdd.clear();
+  return (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::add_availablepoint(int64_t featureOwnersIdx)
+{
+  if(m_AvailablePointsInv[featureOwnersIdx] >= 0)
+  {
+    return;
+  }
+  m_AvailablePointsInv[featureOwnersIdx] = static_cast<int64_t>(m_AvailablePoints.size());
+  m_AvailablePoints.push_back(featureOwnersIdx);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::remove_availablepoint(int64_t featureOwnersIdx)
+{
+  int64_t slot = m_AvailablePointsInv[featureOwnersIdx];
+  if(slot < 0)
+  {
+    return;
+  }
+  int64_t last = m_AvailablePoints.back();
+  m_AvailablePoints[slot] = last;
+  m_AvailablePointsInv[last] = slot;
+  m_AvailablePoints.pop_back();
+  m_AvailablePointsInv[featureOwnersIdx] = -1;
 }
 
 // -----------------------------------------------------------------------------
@@ -3372,27 +3325,31 @@ void EstablishFoamMorphology::find_euclideandistmap()
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
+  // Exact distance from every voxel to the nearest grain boundary, triple line and
+  // quadruple point voxel. Voxels outside any feature that are not boundary voxels
+  // themselves keep a distance of -1.
+  FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
+  std::array<size_t, 3> gridDims = {udims[0], udims[1], udims[2]};
+  std::array<double, 3> gridSpacing = {static_cast<double>(spacing[0]), static_cast<double>(spacing[1]), static_cast<double>(spacing[2])};
+  std::array<float*, 3> distanceMaps = {m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances};
+  std::vector<double> squaredDistances;
+  std::vector<int64_t> nearestSeeds;
+  for(size_t mapType = 0; mapType < 3; mapType++)
   {
-    tbb::task_group* g = new tbb::task_group;
-    g->run(FindEuclideanMap2(m, m_FeatureIds, m_NearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, 0));
-    g->run(FindEuclideanMap2(m, m_FeatureIds, m_NearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, 1));
-    g->run(FindEuclideanMap2(m, m_FeatureIds, m_NearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, 2));
-    g->wait();
-    delete g;
-  }
-  else
-#endif
-  {
-    for(int32_t i = 0; i < 3; i++)
+    const auto isBoundary = [this, mapType](size_t a) { return m_NearestNeighbors[a * 3 + mapType] >= 0; };
+    DistanceTransform::computeSquared(gridDims, gridSpacing, isBoundary, squaredDistances, nearestSeeds);
+
+    float* distances = distanceMaps[mapType];
+    for(size_t a = 0; a < totalPoints; a++)
     {
-      if((i == 0) || (i == 1) || (i == 2))
+      if(m_NearestNeighbors[a * 3 + mapType] >= 0)
       {
-        FindEuclideanMap2 f(m, m_FeatureIds, m_NearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, i);
-        f();
+        m_NearestNeighbors[a * 3 + mapType] = static_cast<int32_t>(a);
+      }
+      else if(m_FeatureIds[a] > 0 && nearestSeeds[a] >= 0)
+      {
+        m_NearestNeighbors[a * 3 + mapType] = static_cast<int32_t>(nearestSeeds[a]);
+        distances[a] = static_cast<float>(std::sqrt(squaredDistances[a]));
       }
     }
   }
@@ -3782,3 +3739,27 @@ bool EstablishFoamMorphology::getSmoothStruts() const
 {
   return m_SmoothStruts;
 }
+
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::setParallelPacking(const bool& value)
+{
+  m_ParallelPacking = value;
+}
+
+// -----------------------------------------------------------------------------
+bool EstablishFoamMorphology::getParallelPacking() const
+{
+  return m_ParallelPacking;
+}
+
+// -----------------------------------------------------------------------------
+void EstablishFoamMorphology::setPackingSeed(const int& value)
+{
+  m_PackingSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+int EstablishFoamMorphology::getPackingSeed() const
+{
+  return m_PackingSeed;
+}
@@ -13,6 +13,11 @@
 
 #pragma once
 
+#include <array>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
@@ -61,6 +66,8 @@ class DREAM3DReview_EXPORT EstablishFoamMorphology : public AbstractFilter
   PYB11_PROPERTY(float StrutThicknessVariability READ getStrutThicknessVariability WRITE setStrutThicknessVariability)
   PYB11_PROPERTY(float StrutShapeVariability READ getStrutShapeVariability WRITE setStrutShapeVariability)
   PYB11_PROPERTY(bool SmoothStruts READ getSmoothStruts WRITE setSmoothStruts)
+  PYB11_PROPERTY(bool ParallelPacking READ getParallelPacking WRITE setParallelPacking)
+  PYB11_PROPERTY(int PackingSeed READ getPackingSeed WRITE setPackingSeed)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -361,6 +368,28 @@ public:
   bool getSmoothStruts() const;
   Q_PROPERTY(bool SmoothStruts READ getSmoothStruts WRITE setSmoothStruts)
 
+  /**
+   * @brief Setter property for ParallelPacking
+   */
+  void setParallelPacking(const bool& value);
+  /**
+   * @brief Getter property for ParallelPacking
+   * @return Value of ParallelPacking
+   */
+  bool getParallelPacking() const;
+  Q_PROPERTY(bool ParallelPacking READ getParallelPacking WRITE setParallelPacking)
+
+  /**
+   * @brief Setter property for PackingSeed
+   */
+  void setPackingSeed(const int& value);
+  /**
+   * @brief Getter property for PackingSeed
+   * @return Value of PackingSeed
+   */
+  int getPackingSeed() const;
+  Q_PROPERTY(int PackingSeed READ getPackingSeed WRITE setPackingSeed)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -486,6 +515,21 @@ protected:
    */
   float check_sizedisterror(Feature_t* feature);
 
+  /**
+   * @brief add_to_sizedist Adds an accepted Feature to the running size distribution
+   * histogram of its phase that check_sizedisterror compares against
+   * @param feature Feature_t struct pointer for the accepted Feature
+   */
+  void add_to_sizedist(Feature_t* feature);
+
+  /**
+   * @brief find_sizedistbin Finds the size distribution bin of a Feature diameter
+   * @param phaseIndex Index of the phase within the precipitate phases
+   * @param diameter Equivalent diameter of the Feature
+   * @return Bin index
+   */
+  size_t find_sizedistbin(size_t phaseIndex, float diameter) const;
+
   /**
    * @brief determine_neighbors Determines the neighbors for a given Feature
    * @param gnum Id for the Feature for which to find neighboring Features
@@ -514,11 +558,63 @@ protected:
   float check_fillingerror(int32_t gadd, int32_t gremove, const Int32ArrayType::Pointer& featureOwnersPtr, const Int32ArrayType::Pointer& exclusionOwnersPtr);
 
   /**
-   * @brief update_availablepoints Updates the maps used to associate packing points with an "available" state
-   * @param availablePoints Map between Feature owners and number of available points
-   * @param availablePointsInv Inverse associations for the availablePoints map
+   * @brief find_packingindex Maps a packing grid coordinate of a Feature onto the packing grid,
+   * wrapping it around for periodic boundaries
+   * @param col Column of the point
+   * @param row Row of the point
+   * @param plane Plane of the point
+   * @return Index of the packing point, or -1 if the point falls outside a non periodic grid
    */
-  void update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv);
+  int64_t find_packingindex(int64_t col, int64_t row, int64_t plane) const;
+
+  /**
+   * @brief adjust_features_parallel Runs the swapping/moving stage of the packing in batches of
+   * trial moves. The trials of a batch are evaluated concurrently against the unchanged packing;
+   * the improving trials are then committed in trial order, skipping any trial that touches a
+   * Feature or packing point already changed by a trial committed before it in the same batch.
+   * Every trial draws from its own random stream, so the result only depends on PackingSeed.
+   * @param totalAdjustments Number of trial moves
+   * @param featureOwnersPtr Array of Feature Ids for each packing point
+   * @param exclusionOwnersPtr Array of exlusion Ids for each packing point
+   * @param outFile Stream receiving the error history
+   * @param writeErrorFile Whether the error history is written
+   */
+  void adjust_features_parallel(int32_t totalAdjustments, const Int32ArrayType::Pointer& featureOwnersPtr, const Int32ArrayType::Pointer& exclusionOwnersPtr, std::ofstream& outFile,
+                                bool writeErrorFile);
+
+  /**
+   * @brief TrialMove_t Candidate move of one Feature proposed by the parallel packing
+   */
+  struct TrialMove_t
+  {
+    int32_t m_Feature = -1;
+    std::array<float, 3> m_Centroid = {0.0f, 0.0f, 0.0f};
+    int64_t m_FillingErrorDelta = 0;
+    std::vector<int64_t> m_Points;
+  };
+
+  /**
+   * @brief evaluate_trialmove Proposes the trial move with the given index and computes the change of
+   * the filling error it would cause, without modifying the packing
+   * @param iteration Index of the trial; selects the random stream and the kind of move
+   * @param featureOwners Array of Feature Ids for each packing point
+   * @param ownerDeltas Scratch map of owner count changes per packing point
+   * @param trial Receives the proposed move
+   */
+  void evaluate_trialmove(int32_t iteration, const int32_t* featureOwners, std::unordered_map<int64_t, int32_t>& ownerDeltas, TrialMove_t& trial) const;
+
+  /**
+   * @brief add_availablepoint Marks a packing point that left its last exclusion zone as available
+   * @param featureOwnersIdx Index of the packing point
+   */
+  void add_availablepoint(int64_t featureOwnersIdx);
+
+  /**
+   * @brief remove_availablepoint Removes a packing point that entered an exclusion zone from the
+   * available points by swapping it with the last available point
+   * @param featureOwnersIdx Index of the packing point
+   */
+  void remove_availablepoint(int64_t featureOwnersIdx);
 
   /**
    * @brief assign_voxels Assigns Feature Id values to voxels within the packing grid
@@ -606,6 +702,8 @@ private:
   float m_StrutThicknessVariability = {0.5f};
   float m_StrutShapeVariability = {0.5f};
   bool m_SmoothStruts = {};
+  bool m_ParallelPacking = {false};
+  int m_PackingSeed = {0};
   std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
   int32_t* m_FeatureIds = nullptr;
   std::weak_ptr<DataArray<int32_t>> m_CellPhasesPtr;
@@ -680,8 +778,10 @@ private:
   std::vector<std::vector<int64_t>> m_PlaneList;
   std::vector<std::vector<float>> m_EllipFuncList;
 
-  std::vector<size_t> m_PointsToAdd;
-  std::vector<size_t> m_PointsToRemove;
+  // Dense list of the packing points outside any exclusion zone, and for every packing
+  // point its slot in that list (-1 if the point is excluded)
+  std::vector<int64_t> m_AvailablePoints;
+  std::vector<int64_t> m_AvailablePointsInv;
 
   uint64_t m_Seed;
 
@@ -700,7 +800,10 @@ private:
   int64_t m_TotalPackingPoints = 0;
 
   std::vector<std::vector<float>> m_FeatureSizeDist;
-  std::vector<std::vector<float>> m_SimFeatureSizeDist;
+  std::vector<std::vector<int32_t>> m_SimFeatureSizeCounts;
+  std::vector<int32_t> m_SimFeatureCounts;
+  std::vector<double> m_SimFeatureSizeBhattSums;
+  std::vector<float> m_HalfMinFeatureDiameters;
   std::vector<std::vector<std::vector<float>>> m_NeighborDist;
   std::vector<std::vector<std::vector<float>>> m_SimNeighborDist;
 
@@ -713,7 +816,7 @@ private:
   std::vector<int32_t> m_PrecipitatePhases;
   std::vector<float> m_PrecipitatePhaseFractions;
 
-  size_t m_AvailablePointsCount = 0;
+  int64_t m_FillingErrorSum = 0;
   float m_FillingError = 0.0f;
   float m_OldFillingError = 0.0f;
 
@@ -730,6 +833,8 @@ private:
    */
   void updateFeatureInstancePointers();
 
+  friend class EvaluateTrialMovesImpl;
+
 public:
   EstablishFoamMorphology(const EstablishFoamMorphology&) = delete;            // Copy Constructor Not Implemented
   EstablishFoamMorphology(EstablishFoamMorphology&&) = delete;                 // Move Constructor Not Implemented
@@ -14,14 +14,19 @@
 
 #include "ExportCLIFile.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <map>
+#include <string>
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
@@ -35,6 +40,14 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextFormattingHelpers.hpp"
+
+namespace
+{
+// Binary CLI command indices from the Common Layer Interface specification
+constexpr uint16_t k_LayerLong = 127;
+constexpr uint16_t k_HatchesLong = 132;
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -69,6 +82,7 @@ void ExportCLIFile::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Precision (places after decimal)", Precision, FilterParameter::Category::Parameter, ExportCLIFile));
   parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Output File Directory", OutputDirectory, FilterParameter::Category::Parameter, ExportCLIFile));
   parameters.push_back(SIMPL_NEW_STRING_FP("Output File Prefix", OutputFilePrefix, FilterParameter::Category::Parameter, ExportCLIFile));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write Binary CLI Files", WriteBinaryFile, FilterParameter::Category::Parameter, ExportCLIFile));
   std::vector<QString> linkedProps = {"GroupIdsArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Split CLI Files by Group", SplitByGroup, FilterParameter::Category::Parameter, ExportCLIFile, linkedProps));
   DataContainerSelectionFilterParameter::RequirementType dcsReq;
@@ -218,32 +232,6 @@ void ExportCLIFile::execute()
   numGroups++;
   numLayers++;
 
-  QVector<std::shared_ptr<QFile>> files;
-  for(auto i = 0; i < numGroups; i++)
-  {
-    QString fname = m_OutputDirectory + "/" + m_OutputFilePrefix + "Group" + QString::number(i + 1) + ".cli";
-    std::shared_ptr<QFile> filePtr = std::make_shared<QFile>(fname);
-    filePtr->open(QIODevice::WriteOnly | QIODevice::Text);
-    files.push_back(filePtr);
-  }
-
-  for(auto&& f : files)
-  {
-    QString header = "$$HEADERSTART\n"
-                     "$$ASCII\n"
-                     "$$UNITS/" +
-                     QString::number(m_UnitsScaleFactor, 'f', m_Precision) +
-                     "\n"
-                     "$$HEADEREND\n"
-                     "$$GEOMETRYSTART\n"
-                     "\n"
-                     "$$LAYER/0.00000\n"
-                     "\n";
-
-    QTextStream out(f.get());
-    out << header;
-  }
-
   using GroupLayerTable = std::vector<std::vector<std::vector<int64_t>>>;
   using LayerTable = std::vector<std::vector<int64_t>>;
   GroupLayerTable table(numGroups, LayerTable(numLayers));
@@ -264,43 +252,116 @@ void ExportCLIFile::execute()
     table[groupIds[i]][m_LayerIds[i]].push_back(i);
   }
 
+  const double unitsScaleFactor = m_UnitsScaleFactor;
+  const int32_t precision = m_Precision;
+  const bool writeBinary = m_WriteBinaryFile;
+  std::atomic<int64_t> badHatch(-1);
+
   for(auto i = 0; i < numGroups; i++)
   {
-    QFile* file = files[i].get();
-    QTextStream out(file);
-    for(auto j = 0; j < numLayers; j++)
+    QString fname = m_OutputDirectory + "/" + m_OutputFilePrefix + "Group" + QString::number(i + 1) + ".cli";
+    QFile file(fname);
+    if(!file.open(writeBinary ? QIODevice::WriteOnly : QIODevice::WriteOnly | QIODevice::Text))
+    {
+      QString ss = QObject::tr("Error opening output file '%1'").arg(fname);
+      setErrorCondition(-11111, ss);
+      return;
+    }
+    const auto writeBuffer = [&file](const std::string& buffer) { return file.write(buffer.data(), static_cast<qint64>(buffer.size())) == static_cast<qint64>(buffer.size()); };
+
+    std::string header = "$$HEADERSTART\n";
+    header += writeBinary ? "$$BINARY\n" : "$$ASCII\n";
+    header += "$$UNITS/";
+    TextFormattingHelpers::appendFixed(header, unitsScaleFactor, precision);
+    header += "\n$$HEADEREND";
+    if(writeBinary)
+    {
+      // Binary commands follow $$HEADEREND directly, starting with the empty layer 0
+      TextFormattingHelpers::appendBinary(header, k_LayerLong);
+      TextFormattingHelpers::appendBinary(header, 0.0f);
+    }
+    else
     {
-      if(!table[i][j].empty())
+      header += "\n$$GEOMETRYSTART\n\n$$LAYER/0.00000\n\n";
+    }
+    writeBuffer(header);
+
+    // Every layer is formatted into its own buffer
+    const LayerTable& layers = table[i];
+    const auto formatLayers = [&](size_t start, size_t end, std::string& buffer) {
+      for(size_t j = start; j < end; j++)
       {
-        double layerHeight = static_cast<double>(vertices[3 * edges[2 * table[i][j].front() + 0] + 2]);
-        QString layerStr = "$$LAYER/" + QString::number(layerHeight / m_UnitsScaleFactor, 'f', m_Precision) + "\n";
-        out << layerStr;
-        QString hatchStr = "$$HATCHES/1," + QString::number(table[i][j].size()) + ",";
-        for(auto&& hatch : table[i][j])
+        const std::vector<int64_t>& hatches = layers[j];
+        if(hatches.empty())
+        {
+          continue;
+        }
+        double layerHeight = static_cast<double>(vertices[3 * edges[2 * hatches.front() + 0] + 2]);
+        if(writeBinary)
+        {
+          TextFormattingHelpers::appendBinary(buffer, k_LayerLong);
+          TextFormattingHelpers::appendBinary(buffer, static_cast<float>(layerHeight / unitsScaleFactor));
+          TextFormattingHelpers::appendBinary(buffer, k_HatchesLong);
+          TextFormattingHelpers::appendBinary(buffer, static_cast<int32_t>(1));
+          TextFormattingHelpers::appendBinary(buffer, static_cast<int32_t>(hatches.size()));
+        }
+        else
+        {
+          buffer += "$$LAYER/";
+          TextFormattingHelpers::appendFixed(buffer, layerHeight / unitsScaleFactor, precision);
+          buffer += "\n$$HATCHES/1,";
+          TextFormattingHelpers::appendInteger(buffer, hatches.size());
+        }
+        for(auto&& hatch : hatches)
         {
-          double zStart = static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 2] / m_UnitsScaleFactor);
-          double zEnd = static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 2] / m_UnitsScaleFactor);
+          double zStart = static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 2] / unitsScaleFactor);
+          double zEnd = static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 2] / unitsScaleFactor);
           if(!SIMPLibMath::closeEnough(zStart, layerHeight) || !SIMPLibMath::closeEnough(zEnd, layerHeight))
           {
-            QString ss = QObject::tr("Found Edge (%1) that spans multipe layers").arg(hatch);
-            setErrorCondition(-1, ss);
-            return;
+            badHatch = hatch;
+            return false;
           }
 
-          double xStart = static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 0] / m_UnitsScaleFactor);
-          double yStart = static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 1] / m_UnitsScaleFactor);
-          double xEnd = static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 0] / m_UnitsScaleFactor);
-          double yEnd = static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 1] / m_UnitsScaleFactor);
-          hatchStr += (QString::number(xStart, 'f', m_Precision) + "," + QString::number(yStart, 'f', m_Precision) + "," + QString::number(xEnd, 'f', m_Precision) + "," +
-                       QString::number(yEnd, 'f', m_Precision) + ",");
+          std::array<double, 4> coords = {static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 0] / unitsScaleFactor), static_cast<double>(vertices[3 * edges[2 * hatch + 0] + 1] / unitsScaleFactor),
+                                          static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 0] / unitsScaleFactor), static_cast<double>(vertices[3 * edges[2 * hatch + 1] + 1] / unitsScaleFactor)};
+          for(double coord : coords)
+          {
+            if(writeBinary)
+            {
+              TextFormattingHelpers::appendBinary(buffer, static_cast<float>(coord));
+            }
+            else
+            {
+              buffer += ',';
+              TextFormattingHelpers::appendFixed(buffer, coord, precision);
+            }
+          }
+        }
+        if(!writeBinary)
+        {
+          buffer += "\n\n";
         }
-        hatchStr.chop(1);
-        hatchStr += "\n\n";
-        out << hatchStr;
       }
+      return true;
+    };
+
+    bool success = TextFormattingHelpers::writeChunks(layers.size(), 1, formatLayers, writeBuffer);
+    if(success && !writeBinary)
+    {
+      success = writeBuffer("$$GEOMETRYEND\n");
+    }
+    if(badHatch >= 0)
+    {
+      QString ss = QObject::tr("Found Edge (%1) that spans multipe layers").arg(badHatch.load());
+      setErrorCondition(-1, ss);
+      return;
+    }
+    if(!success)
+    {
+      QString ss = QObject::tr("Error writing output file '%1'").arg(fname);
+      setErrorCondition(-11112, ss);
+      return;
     }
-    QString footer = "$$GEOMETRYEND\n";
-    out << footer;
   }
 
   notifyStatusMessage("Complete");
@@ -431,6 +492,18 @@ DataArrayPath ExportCLIFile::getLayerIdsArrayPath() const
   return m_LayerIdsArrayPath;
 }
 
+// -----------------------------------------------------------------------------
+void ExportCLIFile::setWriteBinaryFile(bool value)
+{
+  m_WriteBinaryFile = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportCLIFile::getWriteBinaryFile() const
+{
+  return m_WriteBinaryFile;
+}
+
 // -----------------------------------------------------------------------------
 void ExportCLIFile::setSplitByGroup(bool value)
 {
@@ -84,6 +84,17 @@ public:
   bool getSplitByGroup() const;
   Q_PROPERTY(bool SplitByGroup READ getSplitByGroup WRITE setSplitByGroup)
 
+  /**
+   * @brief Setter property for WriteBinaryFile
+   */
+  void setWriteBinaryFile(bool value);
+  /**
+   * @brief Getter property for WriteBinaryFile
+   * @return Value of WriteBinaryFile
+   */
+  bool getWriteBinaryFile() const;
+  Q_PROPERTY(bool WriteBinaryFile READ getWriteBinaryFile WRITE setWriteBinaryFile)
+
   /**
    * @brief Setter property for GroupIdsArrayPath
    */
@@ -216,6 +227,7 @@ private:
   DataArrayPath m_EdgeGeometry = {"", "", ""};
   DataArrayPath m_LayerIdsArrayPath = {"", "", ""};
   bool m_SplitByGroup = {};
+  bool m_WriteBinaryFile = {false};
   DataArrayPath m_GroupIdsArrayPath = {"", "", ""};
   QString m_OutputDirectory = {""};
   QString m_OutputFilePrefix = {""};
@@ -53,6 +53,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/StreamCompaction.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -208,27 +209,28 @@ inline void hashCombine(size_t& seed, const T& obj)
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyData(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::unordered_map<int64_t, int64_t>& elementMap)
+void copyData(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const StreamCompaction::IndexMap& elementMap)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
   T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
   typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
   T* outputData = static_cast<T*>(croppedDataPtr->getPointer(0));
 
-  size_t nTuples = outDataPtr->getNumberOfTuples();
-  size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
+  StreamCompaction::copyTuples(elementMap, inputData, outputData, inDataPtr->getNumberOfComponents());
+}
 
-  for(size_t i = 0; i < nTuples; i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
-    {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * elementMap[i] + d;
-      outputData[tmpIndex] = inputData[ptrIndex];
-    }
-  }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void copyData(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const std::vector<size_t>& elementSources)
+{
+  typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+  T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
+  typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
+  T* outputData = static_cast<T*>(croppedDataPtr->getPointer(0));
+
+  StreamCompaction::gatherTuples(elementSources, inputData, outputData, inDataPtr->getNumberOfComponents());
 }
 
 // -----------------------------------------------------------------------------
@@ -249,6 +251,18 @@ void ExtractInternalSurfacesFromTriangleGeometry::execute()
   MeshIndexType numVerts = tris->getNumberOfVertices();
   MeshIndexType numTris = tris->getNumberOfTris();
 
+  const auto isInternal = [&](MeshIndexType vert) { return m_NodeTypes[vert] == 2 || m_NodeTypes[vert] == 3 || m_NodeTypes[vert] == 4; };
+
+  // A triangle is internal when all of its vertices are; the internal triangles keep
+  // their original order
+  StreamCompaction::IndexMap triMap = StreamCompaction::compact(
+      numTris, [&](size_t tri) { return isInternal(triangles[3 * tri + 0]) && isInternal(triangles[3 * tri + 1]) && isInternal(triangles[3 * tri + 2]); });
+
+  if(getCancel())
+  {
+    return;
+  }
+
   typedef std::array<float, 3> Vertex;
 
   struct ArrayHasher
@@ -262,111 +276,61 @@ void ExtractInternalSurfacesFromTriangleGeometry::execute()
     }
   };
 
-  typedef std::array<int64_t, 3> Triangle;
-  typedef std::unordered_map<Vertex, int64_t, ArrayHasher> VertexMap;
-  VertexMap vertexMap;
-  std::unordered_map<int64_t, int64_t> internalVertexMap;
-  std::unordered_map<int64_t, int64_t> internalTriMap;
-  std::vector<Vertex> tmpVerts;
-  tmpVerts.reserve(numVerts);
-  std::vector<Triangle> tmpTris;
-  tmpTris.reserve(numTris);
-  std::vector<int8_t> tmpNodeTypes;
-  tmpNodeTypes.reserve(numVerts);
-  int64_t vertCounter = 0;
-  int64_t triCounter = 0;
-  int64_t tmpVert0 = 0;
-  int64_t tmpVert1 = 0;
-  int64_t tmpVert2 = 0;
-
-  int64_t progIncrement = numTris / 100;
-  int64_t prog = 1;
-  int64_t progressInt = 0;
-  int64_t counter = 0;
-
-  for(MeshIndexType i = 0; i < numTris; i++)
-  {
-    if(getCancel())
-    {
-      return;
-    }
-    if((m_NodeTypes[triangles[3 * i + 0]] == 2 || m_NodeTypes[triangles[3 * i + 0]] == 3 || m_NodeTypes[triangles[3 * i + 0]] == 4) &&
-       (m_NodeTypes[triangles[3 * i + 1]] == 2 || m_NodeTypes[triangles[3 * i + 1]] == 3 || m_NodeTypes[triangles[3 * i + 1]] == 4) &&
-       (m_NodeTypes[triangles[3 * i + 2]] == 2 || m_NodeTypes[triangles[3 * i + 2]] == 3 || m_NodeTypes[triangles[3 * i + 2]] == 4))
-    {
-      Vertex tmpCoords1 = {{vertices[3 * triangles[3 * i + 0] + 0], vertices[3 * triangles[3 * i + 0] + 1], vertices[3 * triangles[3 * i + 0] + 2]}};
-      Vertex tmpCoords2 = {{vertices[3 * triangles[3 * i + 1] + 0], vertices[3 * triangles[3 * i + 1] + 1], vertices[3 * triangles[3 * i + 1] + 2]}};
-      Vertex tmpCoords3 = {{vertices[3 * triangles[3 * i + 2] + 0], vertices[3 * triangles[3 * i + 2] + 1], vertices[3 * triangles[3 * i + 2] + 2]}};
+  // Vertices with the same coordinates are merged and numbered in the order the internal
+  // triangles first use them; vertSources holds the original vertex of every new one.
+  // newVerts caches the new index of every original vertex, so the coordinates of each
+  // original vertex are only hashed once
+  std::unordered_map<Vertex, size_t, ArrayHasher> vertexMap;
+  std::vector<size_t> newVerts(numVerts, StreamCompaction::k_Removed);
+  std::vector<size_t> vertSources;
+  TriangleGeom::Pointer internalTris = getDataContainerArray()->getDataContainer(m_InternalTrianglesName)->getGeometryAs<TriangleGeom>();
+  internalTris->resizeTriList(triMap.numKept);
+  MeshIndexType* internalTriangles = internalTris->getTriPointer(0);
 
-      auto iter = vertexMap.find(tmpCoords1);
-      if(iter == vertexMap.end())
-      {
-        tmpVerts.push_back(tmpCoords1);
-        tmpNodeTypes.push_back(m_NodeTypes[triangles[3 * i + 0]]);
-        vertexMap[tmpCoords1] = vertCounter;
-        tmpVert0 = vertCounter;
-        internalVertexMap[tmpVert0] = triangles[3 * i + 0];
-        vertCounter++;
-      }
-      else
-      {
-        tmpVert0 = vertexMap[tmpCoords1];
-      }
+  size_t progIncrement = triMap.numKept / 100;
+  size_t prog = 1;
+  size_t counter = 0;
 
-      iter = vertexMap.find(tmpCoords2);
-      if(iter == vertexMap.end())
+  for(const StreamCompaction::Run& run : triMap.runs)
+  {
+    for(size_t i = 0; i < run.length; i++)
+    {
+      if(getCancel())
       {
-        tmpVerts.push_back(tmpCoords2);
-        tmpNodeTypes.push_back(m_NodeTypes[triangles[3 * i + 1]]);
-        vertexMap[tmpCoords2] = vertCounter;
-        tmpVert1 = vertCounter;
-        internalVertexMap[tmpVert1] = triangles[3 * i + 1];
-        vertCounter++;
+        return;
       }
-      else
+      for(size_t v = 0; v < 3; v++)
       {
-        tmpVert1 = vertexMap[tmpCoords2];
+        MeshIndexType vert = triangles[3 * (run.source + i) + v];
+        if(newVerts[vert] == StreamCompaction::k_Removed)
+        {
+          Vertex coords = {{vertices[3 * vert + 0], vertices[3 * vert + 1], vertices[3 * vert + 2]}};
+          auto iter = vertexMap.emplace(coords, vertSources.size()).first;
+          if(iter->second == vertSources.size())
+          {
+            vertSources.push_back(vert);
+          }
+          newVerts[vert] = iter->second;
+        }
+        internalTriangles[3 * (run.sink + i) + v] = static_cast<MeshIndexType>(newVerts[vert]);
       }
 
-      iter = vertexMap.find(tmpCoords3);
-      if(iter == vertexMap.end())
-      {
-        tmpVerts.push_back(tmpCoords3);
-        tmpNodeTypes.push_back(m_NodeTypes[triangles[3 * i + 2]]);
-        vertexMap[tmpCoords3] = vertCounter;
-        tmpVert2 = vertCounter;
-        internalVertexMap[tmpVert2] = triangles[3 * i + 2];
-        vertCounter++;
-      }
-      else
+      if(counter > prog)
       {
-        tmpVert2 = vertexMap[tmpCoords3];
+        int64_t progressInt = static_cast<int64_t>((static_cast<float>(counter) / triMap.numKept) * 100.0f);
+        QString ss = QObject::tr("Merging Vertices of Internal Triangle %1 of %2 || %3% Completed").arg(counter).arg(triMap.numKept).arg(progressInt);
+        notifyStatusMessage(ss);
+        prog = prog + progIncrement;
       }
-
-      Triangle tmpTri = {{tmpVert0, tmpVert1, tmpVert2}};
-      tmpTris.push_back(tmpTri);
-      internalTriMap[triCounter] = i;
-      triCounter++;
-    }
-
-    if(counter > prog)
-    {
-      progressInt = static_cast<int64_t>((static_cast<float>(counter) / numTris) * 100.0f);
-      QString ss = QObject::tr("Checking Triangle %1 of %2 || %3% Completed").arg(counter).arg(numTris).arg(progressInt);
-      notifyStatusMessage(ss);
-      prog = prog + progIncrement;
+      counter++;
     }
-    counter++;
   }
 
   QString ss = QObject::tr("Finished Checking Triangles || Updating Array Information...");
   notifyStatusMessage(ss);
 
-  tmpVerts.shrink_to_fit();
-  tmpTris.shrink_to_fit();
-
-  std::vector<size_t> vertDims(1, tmpVerts.size());
-  std::vector<size_t> triDims(1, tmpTris.size());
+  std::vector<size_t> vertDims(1, vertSources.size());
+  std::vector<size_t> triDims(1, triMap.numKept);
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName);
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_InternalTrianglesName);
 
@@ -392,7 +356,7 @@ void ExtractInternalSurfacesFromTriangleGeometry::execute()
           assert(dest);
           assert(src->getNumberOfComponents() == dest->getNumberOfComponents());
 
-          EXECUTE_FUNCTION_TEMPLATE(this, copyData, src, src, dest, internalVertexMap)
+          EXECUTE_FUNCTION_TEMPLATE(this, copyData, src, src, dest, vertSources)
         }
       }
       else if(tempAttrMatType == AttributeMatrix::Type::Face)
@@ -411,33 +375,14 @@ void ExtractInternalSurfacesFromTriangleGeometry::execute()
           assert(dest);
           assert(src->getNumberOfComponents() == dest->getNumberOfComponents());
 
-          EXECUTE_FUNCTION_TEMPLATE(this, copyData, src, src, dest, internalTriMap)
+          EXECUTE_FUNCTION_TEMPLATE(this, copyData, src, src, dest, triMap)
         }
       }
     }
   }
 
-  TriangleGeom::Pointer internalTris = getDataContainerArray()->getDataContainer(m_InternalTrianglesName)->getGeometryAs<TriangleGeom>();
-  internalTris->resizeVertexList(tmpVerts.size());
-  internalTris->resizeTriList(tmpTris.size());
-  float* internalVertices = internalTris->getVertexPointer(0);
-  MeshIndexType* internalTriangles = internalTris->getTriPointer(0);
-  MeshIndexType numInternalTris = internalTris->getNumberOfTris();
-  MeshIndexType numInternalVerts = internalTris->getNumberOfVertices();
-
-  for(MeshIndexType i = 0; i < numInternalVerts; i++)
-  {
-    internalVertices[3 * i + 0] = tmpVerts[i][0];
-    internalVertices[3 * i + 1] = tmpVerts[i][1];
-    internalVertices[3 * i + 2] = tmpVerts[i][2];
-  }
-
-  for(MeshIndexType i = 0; i < numInternalTris; i++)
-  {
-    internalTriangles[3 * i + 0] = tmpTris[i][0];
-    internalTriangles[3 * i + 1] = tmpTris[i][1];
-    internalTriangles[3 * i + 2] = tmpTris[i][2];
-  }
+  internalTris->resizeVertexList(vertSources.size());
+  StreamCompaction::gatherTuples(vertSources, vertices, internalTris->getVertexPointer(0), 3);
 }
 
 // -----------------------------------------------------------------------------
@@ -4,6 +4,11 @@
 
 #include "FFTHDFWriterFilter.h"
 
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#include <QtCore/QByteArray>
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -13,17 +18,340 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+constexpr size_t k_TargetChunkBytes = 4 * 1024 * 1024;
+
+/**
+ * @brief Writes one cell array of an image geometry as a sequence of Z slabs. Each
+ * slab covers a fixed number of Z planes, so beyond the source array only a bounded
+ * amount of memory is used. With compression enabled every slab becomes one HDF5
+ * chunk; batches of chunks are deflated in parallel and handed to HDF5 already
+ * compressed.
+ *
+ * In component major order (the layout an FFT solver works on) each component is a
+ * separate grid: the dataset has dimensions [c][z][y][x] instead of [z][y][x][c].
+ */
+template <typename T>
+class SlabDatasetWriter
+{
+public:
+  SlabDatasetWriter(FFTHDFWriterFilter* filter, const DataArray<T>& array, const SizeVec3Type& dims, bool componentMajor, int32_t compressionLevel)
+  : m_Filter(filter)
+  , m_Array(array)
+  , m_ComponentMajor(componentMajor)
+  , m_CompressionLevel(compressionLevel)
+  {
+    m_PlaneSize = dims[0] * dims[1];
+    m_NumComps = m_Array.getNumberOfComponents();
+    size_t chunkComps = m_ComponentMajor ? 1 : m_NumComps;
+    m_SlabDepth = std::max<size_t>(1, k_TargetChunkBytes / (m_PlaneSize * chunkComps * sizeof(T)));
+    m_SlabDepth = std::min(m_SlabDepth, dims[2]);
+    m_NumSlabs = (dims[2] + m_SlabDepth - 1) / m_SlabDepth;
+    m_ChunkElements = m_SlabDepth * m_PlaneSize * chunkComps;
+
+    if(m_ComponentMajor)
+    {
+      m_DatasetDims = {m_NumComps, dims[2], dims[1], dims[0]};
+      m_ChunkDims = {1, m_SlabDepth, dims[1], dims[0]};
+    }
+    else
+    {
+      m_DatasetDims = {dims[2], dims[1], dims[0], m_NumComps};
+      m_ChunkDims = {m_SlabDepth, dims[1], dims[0], m_NumComps};
+    }
+  }
+
+  size_t numChunks() const
+  {
+    return m_ComponentMajor ? m_NumComps * m_NumSlabs : m_NumSlabs;
+  }
+
+  /**
+   * @brief Copies the values of one chunk into buffer, zero padding the part of the
+   * last slab that lies outside the grid
+   */
+  void fillChunk(size_t chunk, std::vector<T>& buffer) const
+  {
+    buffer.resize(m_ChunkElements);
+    size_t count = chunkVoxels(chunk);
+    const T* source = m_Array.getPointer(0) + slabOf(chunk) * m_SlabDepth * m_PlaneSize * m_NumComps;
+    if(m_ComponentMajor)
+    {
+      source += componentOf(chunk);
+      for(size_t i = 0; i < count; i++)
+      {
+        buffer[i] = source[i * m_NumComps];
+      }
+    }
+    else
+    {
+      count *= m_NumComps;
+      std::copy(source, source + count, buffer.begin());
+    }
+    std::fill(buffer.begin() + count, buffer.end(), static_cast<T>(0));
+  }
+
+  /**
+   * @brief Creates the dataset in gid and writes all slabs
+   * @return Negative value on error
+   */
+  herr_t write(hid_t gid)
+  {
+    hid_t dataspaceId = H5Screate_simple(4, m_DatasetDims.data(), nullptr);
+    hid_t plistId = H5Pcreate(H5P_DATASET_CREATE);
+    if(m_CompressionLevel > 0)
+    {
+      H5Pset_chunk(plistId, 4, m_ChunkDims.data());
+      H5Pset_deflate(plistId, static_cast<unsigned>(m_CompressionLevel));
+    }
+    hid_t datasetId = H5Dcreate(gid, m_Array.getName().toLatin1().data(), H5Lite::HDFTypeForPrimitive<T>(), dataspaceId, H5P_DEFAULT, plistId, H5P_DEFAULT);
+    H5Pclose(plistId);
+    H5Sclose(dataspaceId);
+    if(datasetId < 0)
+    {
+      return -1;
+    }
+
+    herr_t err = 0;
+#if H5_VERSION_GE(1, 10, 3)
+    if(m_CompressionLevel > 0)
+    {
+      err = writeCompressedChunks(datasetId);
+    }
+    else
+#endif
+    {
+      err = writeChunks(datasetId);
+    }
+    H5Dclose(datasetId);
+    if(err < 0)
+    {
+      return err;
+    }
+    return writeAttributes(gid);
+  }
+
+  /**
+   * @brief Deflates the chunks [start, end) into output, which is indexed relative
+   * to outputOffset
+   */
+  void compressChunks(size_t start, size_t end, std::vector<QByteArray>& output, size_t outputOffset) const
+  {
+    std::vector<T> buffer;
+    for(size_t chunk = start; chunk < end; chunk++)
+    {
+      fillChunk(chunk, buffer);
+      output[chunk - outputOffset] = qCompress(reinterpret_cast<const uchar*>(buffer.data()), static_cast<int>(buffer.size() * sizeof(T)), m_CompressionLevel);
+    }
+  }
+
+private:
+  FFTHDFWriterFilter* m_Filter = nullptr;
+  const DataArray<T>& m_Array;
+  bool m_ComponentMajor = false;
+  int32_t m_CompressionLevel = 0;
+  size_t m_PlaneSize = 0;
+  size_t m_NumComps = 0;
+  size_t m_SlabDepth = 0;
+  size_t m_NumSlabs = 0;
+  size_t m_ChunkElements = 0;
+  std::array<hsize_t, 4> m_DatasetDims = {0, 0, 0, 0};
+  std::array<hsize_t, 4> m_ChunkDims = {0, 0, 0, 0};
+
+  size_t slabOf(size_t chunk) const
+  {
+    return chunk % m_NumSlabs;
+  }
+
+  size_t componentOf(size_t chunk) const
+  {
+    return chunk / m_NumSlabs;
+  }
+
+  /**
+   * @brief Number of grid points of the chunk that lie inside the grid
+   */
+  size_t chunkVoxels(size_t chunk) const
+  {
+    size_t zStart = slabOf(chunk) * m_SlabDepth;
+    size_t zp = static_cast<size_t>(m_ComponentMajor ? m_DatasetDims[1] : m_DatasetDims[0]);
+    return std::min(m_SlabDepth, zp - zStart) * m_PlaneSize;
+  }
+
+  std::array<hsize_t, 4> chunkOffset(size_t chunk) const
+  {
+    hsize_t zStart = slabOf(chunk) * m_SlabDepth;
+    if(m_ComponentMajor)
+    {
+      return {componentOf(chunk), zStart, 0, 0};
+    }
+    return {zStart, 0, 0, 0};
+  }
+
+  void reportProgress(size_t chunksWritten) const
+  {
+    QString ss = QObject::tr("Writing %1 || %2% Complete").arg(m_Array.getName()).arg(100 * chunksWritten / numChunks());
+    m_Filter->notifyStatusMessage(ss);
+  }
+
+  /**
+   * @brief Writes slab by slab through a hyperslab selection; HDF5 applies the
+   * filter pipeline, if any, itself. Without a transpose the slabs are written
+   * straight from the source array.
+   */
+  herr_t writeChunks(hid_t datasetId) const
+  {
+    std::vector<T> buffer;
+    hid_t fileSpaceId = H5Dget_space(datasetId);
+    herr_t err = 0;
+    for(size_t chunk = 0; chunk < numChunks() && err >= 0; chunk++)
+    {
+      if(m_Filter->getCancel())
+      {
+        break;
+      }
+      std::array<hsize_t, 4> offset = chunkOffset(chunk);
+      std::array<hsize_t, 4> count = m_ChunkDims;
+      count[m_ComponentMajor ? 1 : 0] = chunkVoxels(chunk) / m_PlaneSize;
+
+      const T* data = m_Array.getPointer(0) + offset[0] * m_PlaneSize * m_NumComps;
+      if(m_ComponentMajor)
+      {
+        fillChunk(chunk, buffer);
+        data = buffer.data();
+      }
+      hid_t memSpaceId = H5Screate_simple(4, count.data(), nullptr);
+      err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+      if(err >= 0)
+      {
+        err = H5Dwrite(datasetId, H5Lite::HDFTypeForPrimitive<T>(), memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+      }
+      H5Sclose(memSpaceId);
+      reportProgress(chunk + 1);
+    }
+    H5Sclose(fileSpaceId);
+    return err;
+  }
+
+#if H5_VERSION_GE(1, 10, 3)
+  /**
+   * @brief Compresses batches of chunks in parallel and writes them in order with
+   * direct chunk writes. qCompress produces a zlib stream behind a 4 byte length
+   * prefix, which is exactly what the HDF5 deflate filter reads back.
+   */
+  herr_t writeCompressedChunks(hid_t datasetId) const;
+#endif
+
+  herr_t writeAttributes(hid_t gid) const;
+};
+
+/**
+ * @brief Compresses a range of chunks of a SlabDatasetWriter
+ */
+template <typename T>
+class CompressChunksImpl
+{
+public:
+  CompressChunksImpl(const SlabDatasetWriter<T>& writer, std::vector<QByteArray>& output, size_t batchStart)
+  : m_Writer(writer)
+  , m_Output(output)
+  , m_BatchStart(batchStart)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    m_Writer.compressChunks(m_BatchStart + range.min(), m_BatchStart + range.max(), m_Output, m_BatchStart);
+  }
+
+private:
+  const SlabDatasetWriter<T>& m_Writer;
+  std::vector<QByteArray>& m_Output;
+  size_t m_BatchStart = 0;
+};
+
+#if H5_VERSION_GE(1, 10, 3)
+// -----------------------------------------------------------------------------
+template <typename T>
+herr_t SlabDatasetWriter<T>::writeCompressedChunks(hid_t datasetId) const
+{
+  // Bound the memory held by compressed chunks that are waiting to be written
+  size_t batchSize = 2 * std::max(1U, std::thread::hardware_concurrency());
+  std::vector<QByteArray> compressed(batchSize);
+  for(size_t batchStart = 0; batchStart < numChunks(); batchStart += batchSize)
+  {
+    if(m_Filter->getCancel())
+    {
+      return 0;
+    }
+    size_t batchEnd = std::min(batchStart + batchSize, numChunks());
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, batchEnd - batchStart);
+    dataAlg.execute(CompressChunksImpl<T>(*this, compressed, batchStart));
+
+    for(size_t chunk = batchStart; chunk < batchEnd; chunk++)
+    {
+      const QByteArray& data = compressed[chunk - batchStart];
+      std::array<hsize_t, 4> offset = chunkOffset(chunk);
+      herr_t err = H5Dwrite_chunk(datasetId, H5P_DEFAULT, 0, offset.data(), static_cast<size_t>(data.size() - 4), data.constData() + 4);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+    reportProgress(batchEnd);
+  }
+  return 0;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+template <typename T>
+herr_t SlabDatasetWriter<T>::writeAttributes(hid_t gid) const
+{
+  // Same attributes a DataArray writes for itself, so the arrays can be read back
+  std::string name = m_Array.getName().toStdString();
+  std::vector<hsize_t> cDims(1, static_cast<hsize_t>(m_NumComps));
+  std::vector<hsize_t> tDims(m_DatasetDims.rbegin(), m_DatasetDims.rbegin() + 4);
+  tDims.erase(m_ComponentMajor ? tDims.end() - 1 : tDims.begin());
+  herr_t err = H5Lite::writeVectorAttribute(gid, name, SIMPL::HDF5::ComponentDimensions.toStdString(), cDims);
+  if(err >= 0)
+  {
+    err = H5Lite::writeVectorAttribute(gid, name, SIMPL::HDF5::TupleDimensions.toStdString(), tDims);
+  }
+  if(err >= 0)
+  {
+    err = H5Lite::writeScalarAttribute(gid, name, SIMPL::HDF5::DataArrayVersion.toStdString(), 2);
+  }
+  if(err >= 0)
+  {
+    err = H5Lite::writeStringAttribute(gid, name, SIMPL::HDF5::ObjectType.toStdString(), m_Array.getFullNameOfClass().toStdString());
+  }
+  if(err >= 0 && m_ComponentMajor)
+  {
+    err = H5Lite::writeStringAttribute(gid, name, "Layout", "ComponentMajor");
+  }
+  return err;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -47,6 +375,10 @@ void FFTHDFWriterFilter::setupFilterParameters()
   parameters.push_back(OutputFileFilterParameter::Create("Output File", "OutputFile", getOutputFile(), FilterParameter::Category::Parameter, SIMPL_BIND_SETTER(FFTHDFWriterFilter, this, OutputFile),
                                                          SIMPL_BIND_GETTER(FFTHDFWriterFilter, this, OutputFile), "*.dream3d", ""));
   //  parameters.push_back(BooleanFilterParameter::Create("Write Xdmf File", "WriteXdmfFile", getWriteXdmfFile(), FilterParameter::Category::Parameter, "ParaView Compatible File"));
+  std::vector<QString> linkedProps = {"CompressionLevel"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Write Compressed Chunks", UseCompression, FilterParameter::Category::Parameter, FFTHDFWriterFilter, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level", CompressionLevel, FilterParameter::Category::Parameter, FFTHDFWriterFilter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write FFT Slab Order", WriteSlabOrder, FilterParameter::Category::Parameter, FFTHDFWriterFilter));
   //--------------
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
@@ -78,6 +410,9 @@ void FFTHDFWriterFilter::readFilterParameters(AbstractFilterParametersReader* re
 {
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
+  setUseCompression(reader->readValue("UseCompression", getUseCompression()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setWriteSlabOrder(reader->readValue("WriteSlabOrder", getWriteSlabOrder()));
   //----------------------------
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath()));
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
@@ -104,6 +439,12 @@ void FFTHDFWriterFilter::dataCheck()
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Name", getOutputFile(), true);
 
+  if(getUseCompression() && (getCompressionLevel() < 1 || getCompressionLevel() > 9))
+  {
+    ss = QObject::tr("The compression level must be between 1 and 9, but is %1").arg(getCompressionLevel());
+    setErrorCondition(-11113, ss);
+  }
+
   QVector<DataArrayPath> dataArrayPaths;
 
   std::vector<size_t> cDims(1, 1);
@@ -191,6 +532,28 @@ void FFTHDFWriterFilter::execute()
   hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(dcaGid);
 
+  if(m_UseCompression || m_WriteSlabOrder)
+  {
+    // Stream the arrays slab by slab instead of handing each whole array to HDF5
+    SizeVec3Type dims = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+    int32_t compressionLevel = m_UseCompression ? m_CompressionLevel : 0;
+    err = SlabDatasetWriter<int32_t>(this, *m_FeatureIdsPtr.lock(), dims, m_WriteSlabOrder, compressionLevel).write(dcaGid);
+    if(err >= 0 && !getCancel())
+    {
+      err = SlabDatasetWriter<int32_t>(this, *m_CellPhasesPtr.lock(), dims, m_WriteSlabOrder, compressionLevel).write(dcaGid);
+    }
+    if(err >= 0 && !getCancel())
+    {
+      err = SlabDatasetWriter<float>(this, *m_CellEulerAnglesPtr.lock(), dims, m_WriteSlabOrder, compressionLevel).write(dcaGid);
+    }
+    if(err < 0)
+    {
+      QString ss = QObject::tr("Error writing the cell arrays to '%1'").arg(m_OutputFile);
+      setErrorCondition(-11114, ss);
+    }
+    return;
+  }
+
   AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(m_FeatureIdsArrayPath);
   std::vector<size_t> tDims = attrMat->getTupleDimensions();
   m_FeatureIdsPtr.lock()->writeH5Data(dcaGid, tDims);
@@ -411,6 +774,42 @@ bool FFTHDFWriterFilter::getAppendToExisting() const
   return m_AppendToExisting;
 }
 
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setUseCompression(bool value)
+{
+  m_UseCompression = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FFTHDFWriterFilter::getUseCompression() const
+{
+  return m_UseCompression;
+}
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setCompressionLevel(int value)
+{
+  m_CompressionLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int FFTHDFWriterFilter::getCompressionLevel() const
+{
+  return m_CompressionLevel;
+}
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setWriteSlabOrder(bool value)
+{
+  m_WriteSlabOrder = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FFTHDFWriterFilter::getWriteSlabOrder() const
+{
+  return m_WriteSlabOrder;
+}
+
 // -----------------------------------------------------------------------------
 void FFTHDFWriterFilter::setFeatureIdsArrayPath(const DataArrayPath& value)
 {
@@ -31,6 +31,9 @@ class DREAM3DReview_EXPORT FFTHDFWriterFilter : public AbstractFilter
   PYB11_SHARED_POINTERS(FFTHDFWriterFilter)
   PYB11_FILTER_NEW_MACRO(FFTHDFWriterFilter)
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+  PYB11_PROPERTY(bool UseCompression READ getUseCompression WRITE setUseCompression)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+  PYB11_PROPERTY(bool WriteSlabOrder READ getWriteSlabOrder WRITE setWriteSlabOrder)
   PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
   PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
   PYB11_PROPERTY(DataArrayPath CellEulerAnglesArrayPath READ getCellEulerAnglesArrayPath WRITE setCellEulerAnglesArrayPath)
@@ -89,6 +92,39 @@ public:
    */
   bool getAppendToExisting() const;
 
+  /**
+   * @brief Setter property for UseCompression
+   */
+  void setUseCompression(bool value);
+  /**
+   * @brief Getter property for UseCompression
+   * @return Value of UseCompression
+   */
+  bool getUseCompression() const;
+  Q_PROPERTY(bool UseCompression READ getUseCompression WRITE setUseCompression)
+
+  /**
+   * @brief Setter property for CompressionLevel
+   */
+  void setCompressionLevel(int value);
+  /**
+   * @brief Getter property for CompressionLevel
+   * @return Value of CompressionLevel
+   */
+  int getCompressionLevel() const;
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+  /**
+   * @brief Setter property for WriteSlabOrder
+   */
+  void setWriteSlabOrder(bool value);
+  /**
+   * @brief Getter property for WriteSlabOrder
+   * @return Value of WriteSlabOrder
+   */
+  bool getWriteSlabOrder() const;
+  Q_PROPERTY(bool WriteSlabOrder READ getWriteSlabOrder WRITE setWriteSlabOrder)
+
   //-------------------------------------------------------------------
 
   /**
@@ -234,6 +270,9 @@ private:
   QString m_OutputFile = {""};
   bool m_WritePipeline = {true};
   bool m_AppendToExisting = {false};
+  bool m_UseCompression = {false};
+  int m_CompressionLevel = {4};
+  bool m_WriteSlabOrder = {false};
   DataArrayPath m_FeatureIdsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds};
   DataArrayPath m_CellPhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Phases};
   DataArrayPath m_CellEulerAnglesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::EulerAngles};
@@ -36,9 +36,8 @@
 
 #include <cmath>
 #include <cstring>
-#include <functional>
-#include <unordered_map>
 
+#include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -53,18 +52,14 @@
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 #define STATISTICS_FILTER_CLASS_NAME FindArrayStatistics
 #include "util/StatisticsHelpers.hpp"
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#endif
+#include "util/GroupedStatistics.hpp"
 
 // -----------------------------------------------------------------------------
 FindArrayStatistics::FindArrayStatistics() = default;
@@ -115,6 +110,14 @@ void FindArrayStatistics::setupFilterParameters()
   linkedProps.push_back("SummationArrayName");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Summation", FindSummation, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
   linkedProps.clear();
+  linkedProps.push_back("Percentiles");
+  linkedProps.push_back("PercentilesArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Percentiles", FindPercentiles, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Percentiles (Comma Delimited)", Percentiles, FilterParameter::Category::Parameter, FindArrayStatistics));
+  linkedProps.clear();
+  linkedProps.push_back("InterquartileRangeArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Interquartile Range", FindInterquartileRange, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
+  linkedProps.clear();
 
   parameters.push_back(SeparatorFilterParameter::Create("Algorithm Options", FilterParameter::Category::Parameter));
   linkedProps.push_back("MaskArrayPath");
@@ -125,6 +128,10 @@ void FindArrayStatistics::setupFilterParameters()
   linkedProps.clear();
   linkedProps.push_back("StandardizedArrayName");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Standardize Data", StandardizeData, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
+  linkedProps.clear();
+  linkedProps.push_back("SketchCompression");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Approximate Median and Percentiles", UseApproximateQuantiles, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Quantile Sketch Compression", SketchCompression, FilterParameter::Category::Parameter, FindArrayStatistics));
 
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to Compute Statistics", SelectedArrayPath, FilterParameter::Category::RequiredArray, FindArrayStatistics, dasReq));
@@ -150,6 +157,10 @@ void FindArrayStatistics::setupFilterParameters()
                                                       FindArrayStatistics));
   parameters.push_back(
       SIMPL_NEW_DA_WITH_LINKED_AM_FP("Summation", SummationArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindArrayStatistics));
+  parameters.push_back(
+      SIMPL_NEW_DA_WITH_LINKED_AM_FP("Percentiles", PercentilesArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindArrayStatistics));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Interquartile Range", InterquartileRangeArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray,
+                                                      FindArrayStatistics));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Standardized Data", StandardizedArrayName, SelectedArrayPath, SelectedArrayPath, FilterParameter::Category::CreatedArray, FindArrayStatistics));
 
   setFilterParameters(parameters);
@@ -170,7 +181,8 @@ void FindArrayStatistics::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
-  if(!getFindHistogram() && !getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength())
+  if(!getFindHistogram() && !getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength() && !getFindPercentiles() &&
+     !getFindInterquartileRange())
   {
     QString ss = QObject::tr("No statistics have been selected, so this filter will perform no operations");
     setWarningCondition(-701, ss);
@@ -254,6 +266,12 @@ void FindArrayStatistics::dataCheck()
     }
   }
 
+  createQuantileArrays(-11004);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
   if(getUseMask())
   {
     m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getMaskArrayPath(), cDims);
@@ -289,63 +307,6 @@ void FindArrayStatistics::dataCheck()
   getDataContainerArray()->validateNumberOfTuples(this, dataArrayPaths);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::vector<float> findHistogram(C<T, Ts...>& source, float histmin, float histmax, bool histfullrange, int32_t numBins)
-{
-  if(source.empty())
-  {
-    return std::vector<float>(numBins, 0);
-  }
-
-  float min = 0.0f;
-  float max = 0.0f;
-
-  if(histfullrange)
-  {
-    min = static_cast<float>(StatisticsHelpers::findMin(source));
-    max = static_cast<float>(StatisticsHelpers::findMax(source));
-  }
-  else
-  {
-    min = histmin;
-    max = histmax;
-  }
-
-  float increment = (max - min) / (numBins);
-  if(std::abs(increment) < 1E-10)
-  {
-    numBins = 1;
-  }
-
-  std::vector<float> Histogram(numBins, 0);
-
-  if(numBins == 1) // if one bin, just set the first element to total number of points
-  {
-    Histogram[0] = static_cast<float>(source.size());
-  }
-  else
-  {
-    for(const auto s : source)
-    {
-      float value = static_cast<float>(s);
-      size_t bin = static_cast<size_t>((value - min) / increment); // find bin for this input array value
-      if((bin >= 0) && (bin < numBins))                            // make certain bin is in range
-      {
-        Histogram[bin]++; // increment histogram element corresponding to this input array value
-      }
-      else if(value == max)
-      {
-        Histogram[numBins - 1]++;
-      }
-    }
-  }
-
-  return Histogram;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -435,274 +396,67 @@ void standardizeData<bool>(IDataArray::Pointer dataPtr, FloatArrayType::Pointer
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-class FindArrayStatisticsByIndexImpl
-{
-public:
-  FindArrayStatisticsByIndexImpl(std::unordered_map<int32_t, std::list<T>>& featureDataMap, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
-                                 std::vector<IDataArray::Pointer>& arrays, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins)
-  : m_FeatureDataMap(featureDataMap)
-  , m_Length(length)
-  , m_Min(min)
-  , m_Max(max)
-  , m_Mean(mean)
-  , m_Median(median)
-  , m_StdDeviation(stdDeviation)
-  , m_Summation(summation)
-  , m_Histogram(hist)
-  , m_HistMin(histmin)
-  , m_HistMax(histmax)
-  , m_HistFullRange(histfullrange)
-  , m_NumBins(numBins)
-  , m_Arrays(arrays)
-  {
-  }
-
-  virtual ~FindArrayStatisticsByIndexImpl() = default;
+void findStatistics(IDataArray::Pointer source, Int32ArrayType::Pointer featureIds, bool useMask, bool* mask, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation,
+                    bool summation, std::vector<IDataArray::Pointer>& arrays, int32_t numFeatures, bool computeByIndex, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins,
+                    const std::vector<double>& percentileFractions, bool approximateQuantiles, double sketchCompression)
+{
+  size_t numTuples = source->getNumberOfTuples();
+  typename DataArray<T>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<T>>(source);
+  T* dataPtr = sourcePtr->getPointer(0);
 
-  void compute(size_t start, size_t end) const
+  GroupedStatistics::Outputs<T> outputs;
+  if(length && arrays[0])
   {
-    for(size_t i = start; i < end; i++)
-    {
-      if(m_Length)
-      {
-        if(m_Arrays[0])
-        {
-          int64_t val = static_cast<int64_t>(m_FeatureDataMap[i].size());
-          m_Arrays[0]->initializeTuple(i, &val);
-        }
-      }
-      if(m_Min)
-      {
-        if(m_Arrays[1])
-        {
-          T val = StatisticsHelpers::findMin(m_FeatureDataMap[i]);
-          m_Arrays[1]->initializeTuple(i, &val);
-        }
-      }
-      if(m_Max)
-      {
-        if(m_Arrays[2])
-        {
-          T val = StatisticsHelpers::findMax(m_FeatureDataMap[i]);
-          m_Arrays[2]->initializeTuple(i, &val);
-        }
-      }
-      if(m_Mean)
-      {
-        if(m_Arrays[3])
-        {
-          float val = StatisticsHelpers::findMean(m_FeatureDataMap[i]);
-          m_Arrays[3]->initializeTuple(i, &val);
-        }
-      }
-      if(m_Median)
-      {
-        if(m_Arrays[4])
-        {
-          float val = StatisticsHelpers::findMedian(m_FeatureDataMap[i]);
-          m_Arrays[4]->initializeTuple(i, &val);
-        }
-      }
-      if(m_StdDeviation)
-      {
-        if(m_Arrays[5])
-        {
-          float val = StatisticsHelpers::findStdDeviation(m_FeatureDataMap[i]);
-          m_Arrays[5]->initializeTuple(i, &val);
-        }
-      }
-      if(m_Summation)
-      {
-        if(m_Arrays[6])
-        {
-          float val = StatisticsHelpers::findSummation(m_FeatureDataMap[i]);
-          m_Arrays[6]->initializeTuple(i, &val);
-        }
-      }
-
-      if(m_Histogram)
-      {
-        if(m_Arrays[7])
-        {
-          std::vector<float> vals = findHistogram(m_FeatureDataMap[i], m_HistMin, m_HistMax, m_HistFullRange, m_NumBins);
-          std::shared_ptr<DataArray<float>> histArray = std::dynamic_pointer_cast<DataArray<float>>(m_Arrays[7]);
-          histArray->setTuple(i, vals);
-        }
-      }
-    }
+    outputs.length = std::dynamic_pointer_cast<MeshIndexArrayType>(arrays[0])->getPointer(0);
   }
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
+  if(min && arrays[1])
   {
-    compute(r.begin(), r.end());
+    outputs.minimum = std::dynamic_pointer_cast<DataArray<T>>(arrays[1])->getPointer(0);
   }
-#endif
-
-private:
-  std::unordered_map<int32_t, std::list<T>>& m_FeatureDataMap;
-  bool m_Length;
-  bool m_Min;
-  bool m_Max;
-  bool m_Mean;
-  bool m_Median;
-  bool m_StdDeviation;
-  bool m_Summation;
-  bool m_Histogram;
-  float m_HistMin;
-  float m_HistMax;
-  bool m_HistFullRange;
-  int32_t m_NumBins;
-  std::vector<IDataArray::Pointer>& m_Arrays;
-};
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation, std::vector<IDataArray::Pointer>& arrays, std::vector<T>& data, bool hist,
-                        float histmin, float histmax, bool histfullrange, int32_t numBins)
-{
-  if(length)
+  if(max && arrays[2])
   {
-    if(arrays[0])
-    {
-      int64_t val = static_cast<int64_t>(data.size());
-      arrays[0]->initializeTuple(0, &val);
-    }
+    outputs.maximum = std::dynamic_pointer_cast<DataArray<T>>(arrays[2])->getPointer(0);
   }
-  if(min)
+  if(mean && arrays[3])
   {
-    if(arrays[1])
-    {
-      T val = StatisticsHelpers::findMin(data);
-      arrays[1]->initializeTuple(0, &val);
-    }
+    outputs.mean = std::dynamic_pointer_cast<FloatArrayType>(arrays[3])->getPointer(0);
   }
-  if(max)
+  if(median && arrays[4])
   {
-    if(arrays[2])
-    {
-      T val = StatisticsHelpers::findMax(data);
-      arrays[2]->initializeTuple(0, &val);
-    }
+    outputs.median = std::dynamic_pointer_cast<FloatArrayType>(arrays[4])->getPointer(0);
   }
-  if(mean)
+  if(stdDeviation && arrays[5])
   {
-    if(arrays[3])
-    {
-      float val = StatisticsHelpers::findMean(data);
-      arrays[3]->initializeTuple(0, &val);
-    }
+    outputs.stdDeviation = std::dynamic_pointer_cast<FloatArrayType>(arrays[5])->getPointer(0);
   }
-  if(median)
+  if(summation && arrays[6])
   {
-    if(arrays[4])
-    {
-      float val = StatisticsHelpers::findMedian(data);
-      arrays[4]->initializeTuple(0, &val);
-    }
+    outputs.summation = std::dynamic_pointer_cast<FloatArrayType>(arrays[6])->getPointer(0);
   }
-  if(stdDeviation)
+  if(hist && arrays[7])
   {
-    if(arrays[5])
-    {
-      float val = StatisticsHelpers::findStdDeviation(data);
-      arrays[5]->initializeTuple(0, &val);
-    }
+    outputs.histogram = std::dynamic_pointer_cast<FloatArrayType>(arrays[7])->getPointer(0);
+    outputs.numBins = numBins;
+    outputs.histogramFullRange = histfullrange;
+    outputs.histogramMin = histmin;
+    outputs.histogramMax = histmax;
   }
-  if(summation)
+  if(arrays[8])
   {
-    if(arrays[6])
-    {
-      float val = StatisticsHelpers::findSummation(data);
-      arrays[6]->initializeTuple(0, &val);
-    }
+    outputs.percentiles = std::dynamic_pointer_cast<FloatArrayType>(arrays[8])->getPointer(0);
+    outputs.percentileFractions = percentileFractions;
   }
-
-  if(hist)
-  {
-    if(arrays[7])
-    {
-      std::vector<float> vals = findHistogram(data, histmin, histmax, histfullrange, numBins);
-      std::shared_ptr<DataArray<float>> histArray = std::dynamic_pointer_cast<DataArray<float>>(arrays[7]);
-      histArray->setTuple(0, vals);
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void findStatistics(IDataArray::Pointer source, Int32ArrayType::Pointer featureIds, bool useMask, bool* mask, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation,
-                    bool summation, std::vector<IDataArray::Pointer>& arrays, int32_t numFeatures, bool computeByIndex, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins)
-{
-  size_t numTuples = source->getNumberOfTuples();
-  typename DataArray<T>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<T>>(source);
-  T* dataPtr = sourcePtr->getPointer(0);
-
-  if(computeByIndex)
+  if(arrays[9])
   {
-    int32_t* featureIdsPtr = featureIds->getPointer(0);
-    std::unordered_map<int32_t, std::list<T>> featureValueMap;
-
-    for(size_t i = 0; i < numTuples; i++)
-    {
-      if(useMask)
-      {
-        if(mask[i])
-        {
-          featureValueMap[featureIdsPtr[i]].push_back(dataPtr[i]);
-        }
-      }
-      else
-      {
-        featureValueMap[featureIdsPtr[i]].push_back(dataPtr[i]);
-      }
-    }
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    bool doParallel = true;
-#endif
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    if(doParallel)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures),
-                        FindArrayStatisticsByIndexImpl<T>(featureValueMap, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      FindArrayStatisticsByIndexImpl<T> serial(featureValueMap, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins);
-      serial.compute(0, numFeatures);
-    }
+    outputs.interquartileRange = std::dynamic_pointer_cast<FloatArrayType>(arrays[9])->getPointer(0);
   }
-  else
-  {
-    std::vector<T> data;
-    data.reserve(numTuples);
-    for(size_t i = 0; i < numTuples; i++)
-    {
-      if(useMask)
-      {
-        if(mask[i])
-        {
-          data.push_back(dataPtr[i]);
-        }
-      }
-      else
-      {
-        data.push_back(dataPtr[i]);
-      }
-    }
-
-    data.shrink_to_fit();
+  outputs.approximateQuantiles = approximateQuantiles;
+  outputs.sketchCompression = sketchCompression;
 
-    findStatisticsImpl(length, min, max, mean, median, stdDeviation, summation, arrays, data, hist, histmin, histmax, histfullrange, numBins);
-  }
+  // Without an index every value belongs to the single group 0
+  int32_t* featureIdsPtr = computeByIndex ? featureIds->getPointer(0) : nullptr;
+  size_t numGroups = computeByIndex ? static_cast<size_t>(numFeatures) : 1;
+  GroupedStatistics::compute(dataPtr, featureIdsPtr, useMask ? mask : nullptr, numTuples, numGroups, outputs);
 }
 
 // -----------------------------------------------------------------------------
@@ -716,7 +470,7 @@ void FindArrayStatistics::execute()
     return;
   }
 
-  if(!m_FindHistogram && !m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength)
+  if(!m_FindHistogram && !m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength && !m_FindPercentiles && !m_FindInterquartileRange)
   {
     return;
   }
@@ -760,7 +514,7 @@ void FindArrayStatistics::execute()
     }
   }
 
-  std::vector<IDataArray::Pointer> arrays(8, nullptr);
+  std::vector<IDataArray::Pointer> arrays(10, nullptr);
 
   for(size_t i = 0; i < arrays.size(); i++)
   {
@@ -796,10 +550,19 @@ void FindArrayStatistics::execute()
     {
       arrays[7] = m_HistogramListPtr.lock();
     }
+    if(m_FindPercentiles)
+    {
+      arrays[8] = m_PercentilesPtr.lock();
+    }
+    if(m_FindInterquartileRange)
+    {
+      arrays[9] = m_InterquartileRangePtr.lock();
+    }
   }
 
   EXECUTE_FUNCTION_TEMPLATE(this, findStatistics, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), m_FeatureIdsPtr.lock(), m_UseMask, m_Mask, m_FindLength, m_FindMin, m_FindMax, m_FindMean,
-                            m_FindMedian, m_FindStdDeviation, m_FindSummation, arrays, numFeatures, m_ComputeByIndex, m_FindHistogram, m_MinRange, m_MaxRange, m_UseFullRange, m_NumBins)
+                            m_FindMedian, m_FindStdDeviation, m_FindSummation, arrays, numFeatures, m_ComputeByIndex, m_FindHistogram, m_MinRange, m_MaxRange, m_UseFullRange, m_NumBins,
+                            m_PercentileFractions, m_UseApproximateQuantiles, m_SketchCompression)
 
   if(m_StandardizeData)
   {
@@ -1056,6 +819,66 @@ bool FindArrayStatistics::getFindSummation() const
   return m_FindSummation;
 }
 
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setFindPercentiles(bool value)
+{
+  m_FindPercentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindArrayStatistics::getFindPercentiles() const
+{
+  return m_FindPercentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setPercentiles(const QString& value)
+{
+  m_Percentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindArrayStatistics::getPercentiles() const
+{
+  return m_Percentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setFindInterquartileRange(bool value)
+{
+  m_FindInterquartileRange = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindArrayStatistics::getFindInterquartileRange() const
+{
+  return m_FindInterquartileRange;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setUseApproximateQuantiles(bool value)
+{
+  m_UseApproximateQuantiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindArrayStatistics::getUseApproximateQuantiles() const
+{
+  return m_UseApproximateQuantiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setSketchCompression(double value)
+{
+  m_SketchCompression = value;
+}
+
+// -----------------------------------------------------------------------------
+double FindArrayStatistics::getSketchCompression() const
+{
+  return m_SketchCompression;
+}
+
 // -----------------------------------------------------------------------------
 void FindArrayStatistics::setUseMask(bool value)
 {
@@ -1212,6 +1035,30 @@ QString FindArrayStatistics::getSummationArrayName() const
   return m_SummationArrayName;
 }
 
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setPercentilesArrayName(const QString& value)
+{
+  m_PercentilesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindArrayStatistics::getPercentilesArrayName() const
+{
+  return m_PercentilesArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setInterquartileRangeArrayName(const QString& value)
+{
+  m_InterquartileRangeArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindArrayStatistics::getInterquartileRangeArrayName() const
+{
+  return m_InterquartileRangeArrayName;
+}
+
 // -----------------------------------------------------------------------------
 void FindArrayStatistics::setStandardizedArrayName(const QString& value)
 {
@@ -36,6 +36,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -68,6 +69,11 @@ class DREAM3DReview_EXPORT FindArrayStatistics : public AbstractFilter
   PYB11_PROPERTY(bool FindMedian READ getFindMedian WRITE setFindMedian)
   PYB11_PROPERTY(bool FindStdDeviation READ getFindStdDeviation WRITE setFindStdDeviation)
   PYB11_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
+  PYB11_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+  PYB11_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+  PYB11_PROPERTY(bool FindInterquartileRange READ getFindInterquartileRange WRITE setFindInterquartileRange)
+  PYB11_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
+  PYB11_PROPERTY(double SketchCompression READ getSketchCompression WRITE setSketchCompression)
   PYB11_PROPERTY(bool UseMask READ getUseMask WRITE setUseMask)
   PYB11_PROPERTY(bool StandardizeData READ getStandardizeData WRITE setStandardizeData)
   PYB11_PROPERTY(bool ComputeByIndex READ getComputeByIndex WRITE setComputeByIndex)
@@ -80,6 +86,8 @@ class DREAM3DReview_EXPORT FindArrayStatistics : public AbstractFilter
   PYB11_PROPERTY(QString MedianArrayName READ getMedianArrayName WRITE setMedianArrayName)
   PYB11_PROPERTY(QString StdDeviationArrayName READ getStdDeviationArrayName WRITE setStdDeviationArrayName)
   PYB11_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
+  PYB11_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
+  PYB11_PROPERTY(QString InterquartileRangeArrayName READ getInterquartileRangeArrayName WRITE setInterquartileRangeArrayName)
   PYB11_PROPERTY(QString StandardizedArrayName READ getStandardizedArrayName WRITE setStandardizedArrayName)
   PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
   PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
@@ -242,6 +250,61 @@ public:
   bool getFindSummation() const;
   Q_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
 
+  /**
+   * @brief Setter property for FindPercentiles
+   */
+  void setFindPercentiles(bool value);
+  /**
+   * @brief Getter property for FindPercentiles
+   * @return Value of FindPercentiles
+   */
+  bool getFindPercentiles() const;
+  Q_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+
+  /**
+   * @brief Setter property for Percentiles
+   */
+  void setPercentiles(const QString& value);
+  /**
+   * @brief Getter property for Percentiles
+   * @return Value of Percentiles
+   */
+  QString getPercentiles() const;
+  Q_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+
+  /**
+   * @brief Setter property for FindInterquartileRange
+   */
+  void setFindInterquartileRange(bool value);
+  /**
+   * @brief Getter property for FindInterquartileRange
+   * @return Value of FindInterquartileRange
+   */
+  bool getFindInterquartileRange() const;
+  Q_PROPERTY(bool FindInterquartileRange READ getFindInterquartileRange WRITE setFindInterquartileRange)
+
+  /**
+   * @brief Setter property for UseApproximateQuantiles
+   */
+  void setUseApproximateQuantiles(bool value);
+  /**
+   * @brief Getter property for UseApproximateQuantiles
+   * @return Value of UseApproximateQuantiles
+   */
+  bool getUseApproximateQuantiles() const;
+  Q_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
+
+  /**
+   * @brief Setter property for SketchCompression
+   */
+  void setSketchCompression(double value);
+  /**
+   * @brief Getter property for SketchCompression
+   * @return Value of SketchCompression
+   */
+  double getSketchCompression() const;
+  Q_PROPERTY(double SketchCompression READ getSketchCompression WRITE setSketchCompression)
+
   /**
    * @brief Setter property for UseMask
    */
@@ -385,6 +448,28 @@ public:
   QString getSummationArrayName() const;
   Q_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
 
+  /**
+   * @brief Setter property for PercentilesArrayName
+   */
+  void setPercentilesArrayName(const QString& value);
+  /**
+   * @brief Getter property for PercentilesArrayName
+   * @return Value of PercentilesArrayName
+   */
+  QString getPercentilesArrayName() const;
+  Q_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
+
+  /**
+   * @brief Setter property for InterquartileRangeArrayName
+   */
+  void setInterquartileRangeArrayName(const QString& value);
+  /**
+   * @brief Getter property for InterquartileRangeArrayName
+   * @return Value of InterquartileRangeArrayName
+   */
+  QString getInterquartileRangeArrayName() const;
+  Q_PROPERTY(QString InterquartileRangeArrayName READ getInterquartileRangeArrayName WRITE setInterquartileRangeArrayName)
+
   /**
    * @brief Setter property for StandardizedArrayName
    */
@@ -477,6 +562,8 @@ protected:
   template <typename T>
   void createCompatibleArrays(QVector<DataArrayPath>& dataArrayPaths);
 
+  void createQuantileArrays(int32_t errorCode);
+
   FindArrayStatistics();
   /**
    * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
@@ -506,6 +593,8 @@ private:
   float* m_StandardDeviation = nullptr;
   std::weak_ptr<DataArray<float>> m_SummationPtr;
   float* m_Summation = nullptr;
+  std::weak_ptr<DataArray<float>> m_PercentilesPtr;
+  std::weak_ptr<DataArray<float>> m_InterquartileRangePtr;
   std::weak_ptr<DataArray<float>> m_StandardizedPtr;
   float* m_Standardized = nullptr;
   std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
@@ -529,6 +618,12 @@ private:
   bool m_FindMedian = false;
   bool m_FindStdDeviation = false;
   bool m_FindSummation = false;
+  bool m_FindPercentiles = false;
+  QString m_Percentiles = {"5, 25, 75, 95"};
+  std::vector<double> m_PercentileFractions;
+  bool m_FindInterquartileRange = false;
+  bool m_UseApproximateQuantiles = false;
+  double m_SketchCompression = {100.0};
   bool m_UseMask = false;
   bool m_StandardizeData = false;
   bool m_ComputeByIndex = false;
@@ -544,6 +639,8 @@ private:
   QString m_MedianArrayName = {"Median"};
   QString m_StdDeviationArrayName = {"StandardDeviation"};
   QString m_SummationArrayName = {"Summation"};
+  QString m_PercentilesArrayName = {"Percentiles"};
+  QString m_InterquartileRangeArrayName = {"InterquartileRange"};
   QString m_StandardizedArrayName = {"Standardized"};
 
   DataArrayPath m_SelectedArrayPath = {};
@@ -37,6 +37,11 @@
 
 #include "FindCSLBoundaries.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -44,6 +49,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -67,11 +73,100 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID30 = 30,
   DataArrayID31 = 31,
   DataArrayID32 = 32,
+  DataArrayID33 = 33,
+  DataArrayID34 = 34,
 };
 
+namespace
+{
+/**
+ * @brief Symmetry operators of one Laue class laid out for the inner misorientation loop.
+ * Left multiplication by the conjugate of operator k maps the (x, y, z, w) components c of
+ * a quaternion to its component r through coefficients[(4 * r + c) * numOps + k], so all
+ * operators of the class are applied to one quaternion with straight loops over k.
+ */
+struct SymmetryTable
+{
+  size_t numOps = 0;
+  std::vector<QuatD> ops;
+  std::vector<double> coefficients;
+};
+
+/**
+ * @brief Builds the symmetry table of every crystal structure
+ */
+std::vector<SymmetryTable> buildSymmetryTables(const LaueOpsContainer& orientationOps)
+{
+  const std::array<QuatD, 4> basis = {QuatD(1.0, 0.0, 0.0, 0.0), QuatD(0.0, 1.0, 0.0, 0.0), QuatD(0.0, 0.0, 1.0, 0.0), QuatD(0.0, 0.0, 0.0, 1.0)};
+  std::vector<SymmetryTable> tables(orientationOps.size());
+  for(size_t phase = 0; phase < orientationOps.size(); phase++)
+  {
+    if(nullptr == orientationOps[phase])
+    {
+      continue;
+    }
+    SymmetryTable& table = tables[phase];
+    table.numOps = static_cast<size_t>(orientationOps[phase]->getNumSymOps());
+    table.ops.resize(table.numOps);
+    table.coefficients.resize(16 * table.numOps);
+    for(size_t k = 0; k < table.numOps; k++)
+    {
+      table.ops[k] = orientationOps[phase]->getQuatSymOp(static_cast<int>(k));
+      QuatD symConj = table.ops[k].conjugate();
+      for(size_t c = 0; c < 4; c++)
+      {
+        QuatD column = symConj * basis[c];
+        const std::array<double, 4> components = {column.x(), column.y(), column.z(), column.w()};
+        for(size_t r = 0; r < 4; r++)
+        {
+          table.coefficients[(4 * r + c) * table.numOps + k] = components[r];
+        }
+      }
+    }
+  }
+  return tables;
+}
+
+/**
+ * @brief A row of the CSL table with its axis normalized
+ */
+struct CSLTarget
+{
+  float sigma = 0.0f;
+  double angle = 0.0;
+  std::array<double, 3> axis = {0.0, 0.0, 1.0};
+};
+
+/**
+ * @brief Collects the CSL rows the faces are classified against, in table order
+ */
+std::vector<CSLTarget> buildCSLTargets(int cslIndex, bool allCSL)
+{
+  std::vector<CSLTarget> targets;
+  for(int i = 0; i < 21; ++i)
+  {
+    if(!allCSL && i != cslIndex)
+    {
+      continue;
+    }
+    const float* row = TransformationPhaseConstants::CSLAxisAngle[i];
+    CSLTarget target;
+    target.sigma = row[0];
+    target.angle = row[1];
+    double denom = std::sqrt(static_cast<double>(row[2] * row[2] + row[3] * row[3] + row[4] * row[4]));
+    for(size_t a = 0; a < 3; a++)
+    {
+      target.axis[a] = row[a + 2] / denom;
+    }
+    targets.push_back(target);
+  }
+  return targets;
+}
+
 class CalculateCSLBoundaryImpl
 {
-  int m_CSLIndex;
+  const std::vector<SymmetryTable>& m_SymmetryTables;
+  const std::vector<CSLTarget>& m_Targets;
   float m_AxisTol;
   float m_AngTol;
   int32_t* m_Labels = nullptr;
@@ -80,13 +175,15 @@ class CalculateCSLBoundaryImpl
   float* m_Quats = nullptr;
   bool* m_CSLBoundary = nullptr;
   float* m_CSLBoundaryIncoherence = nullptr;
+  float* m_CSLSigma = nullptr;
+  float* m_Misorientations = nullptr;
   unsigned int* m_CrystalStructures = nullptr;
-  LaueOpsContainer m_OrientationOps;
 
 public:
-  CalculateCSLBoundaryImpl(int cslindex, float angtol, float axistol, int32_t* Labels, double* Normals, float* Quats, int32_t* Phases, unsigned int* CrystalStructures, bool* CSLBoundary,
-                           float* CSLBoundaryIncoherence)
-  : m_CSLIndex(cslindex)
+  CalculateCSLBoundaryImpl(const std::vector<SymmetryTable>& symmetryTables, const std::vector<CSLTarget>& targets, float angtol, float axistol, int32_t* Labels, double* Normals, float* Quats,
+                           int32_t* Phases, unsigned int* CrystalStructures, bool* CSLBoundary, float* CSLBoundaryIncoherence, float* CSLSigma, float* Misorientations)
+  : m_SymmetryTables(symmetryTables)
+  , m_Targets(targets)
   , m_AxisTol(axistol)
   , m_AngTol(angtol)
   , m_Labels(Labels)
@@ -95,100 +192,163 @@ public:
   , m_Quats(Quats)
   , m_CSLBoundary(CSLBoundary)
   , m_CSLBoundaryIncoherence(CSLBoundaryIncoherence)
+  , m_CSLSigma(CSLSigma)
+  , m_Misorientations(Misorientations)
   , m_CrystalStructures(CrystalStructures)
   {
-    m_OrientationOps = LaueOps::GetAllOrientationOps();
   }
 
   virtual ~CalculateCSLBoundaryImpl() = default;
 
   void generate(size_t start, size_t end) const
   {
-    int feature1, feature2;
+    size_t maxOps = 0;
+    for(const SymmetryTable& table : m_SymmetryTables)
+    {
+      maxOps = std::max(maxOps, table.numOps);
+    }
+    // Components of s_k^-1 * misq * s_j for all k of one j
+    std::vector<double> batchX(maxOps);
+    std::vector<double> batchY(maxOps);
+    std::vector<double> batchZ(maxOps);
+    std::vector<double> batchW(maxOps);
+    std::vector<double> incoherences(m_Targets.size());
+    std::vector<uint8_t> matched(m_Targets.size());
+
     double normal[3];
     double g1[3][3];
-    double w;
-    unsigned int phase1, phase2;
-
-    double axisdiffCSL, angdiffCSL;
-    double n[3];
-    double incoherence;
-    double n1 = 0.0, n2 = 0.0, n3 = 0.0;
-
-    QuatD misq;
-    QuatD sym_q;
-    QuatD s1_misq;
-    QuatD s2_misq;
-
     double xstl_norm[3];
-    std::array<double, 3> s_xstl_norm;
-    double cslAxisNorm[3];
-    double cslAxisNormDenom = 0.0;
-    cslAxisNormDenom =
-        sqrtf(TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][2] + TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][3] + TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][4]);
-    for(int i = 0; i < 3; ++i)
-    {
-      cslAxisNorm[i] = TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][i + 2] / cslAxisNormDenom;
-    }
+    double n[3];
     for(size_t i = start; i < end; i++)
     {
-      feature1 = m_Labels[2 * i];
-      feature2 = m_Labels[2 * i + 1];
+      int32_t feature1 = m_Labels[2 * i];
+      int32_t feature2 = m_Labels[2 * i + 1];
       normal[0] = m_Normals[3 * i];
       normal[1] = m_Normals[3 * i + 1];
       normal[2] = m_Normals[3 * i + 2];
       // different than Find Twin Boundaries here because will only compare if
       // the features are different phases
-      if(feature1 > 0 && feature2 > 0) // && m_Phases[feature1] != m_Phases[feature2])
+      if(feature1 <= 0 || feature2 <= 0) // && m_Phases[feature1] != m_Phases[feature2])
+      {
+        continue;
+      }
+      unsigned int phase1 = m_CrystalStructures[m_Phases[feature1]];
+      unsigned int phase2 = m_CrystalStructures[m_Phases[feature2]];
+      if(phase1 != phase2 || phase1 >= m_SymmetryTables.size())
       {
-        w = 10000.0;
-        float* quatPtr = m_Quats + feature1 * 4;
-        QuatD q1(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
-        quatPtr = m_Quats + feature2 * 4;
-        QuatD q2(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
-
-        phase1 = m_CrystalStructures[m_Phases[feature1]];
-        phase2 = m_CrystalStructures[m_Phases[feature2]];
-        if(phase1 == phase2)
+        continue;
+      }
+      const SymmetryTable& table = m_SymmetryTables[phase1];
+      const size_t nsym = table.numOps;
+      const double* coef = table.coefficients.data();
+
+      float* quatPtr = m_Quats + feature1 * 4;
+      QuatD q1(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
+      quatPtr = m_Quats + feature2 * 4;
+      QuatD q2(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
+      QuatD misq = q1 * (q2.conjugate());
+      OrientationTransformation::qu2om<QuatD, OrientationD>(q1).toGMatrix(g1);
+      MatrixMath::Multiply3x3with3x1(g1, normal, xstl_norm);
+
+      std::fill(incoherences.begin(), incoherences.end(), 180.0);
+      std::fill(matched.begin(), matched.end(), 0);
+      double minAngle = std::numeric_limits<double>::max();
+      std::array<double, 4> disorientation = {0.0, 0.0, 1.0, 0.0};
+
+      for(size_t j = 0; j < nsym; j++)
+      {
+        const QuatD& sym_q = table.ops[j];
+        // calculate crystal direction parallel to normal
+        QuatD s1_misq = misq * sym_q;
+        std::array<double, 3> s_xstl_norm = sym_q.multiplyByVector(xstl_norm);
+        const double s1[4] = {s1_misq.x(), s1_misq.y(), s1_misq.z(), s1_misq.w()};
+
+        // calculate the symmetric misorientations for every k at once
+        for(size_t k = 0; k < nsym; k++)
         {
-          int nsym = m_OrientationOps[phase1]->getNumSymOps();
-          misq = q1 * (q2.conjugate());
-          OrientationTransformation::qu2om<QuatD, OrientationD>(q1).toGMatrix(g1);
-          MatrixMath::Multiply3x3with3x1(g1, normal, xstl_norm);
-          for(int j = 0; j < nsym; j++)
+          batchX[k] = coef[0 * nsym + k] * s1[0] + coef[1 * nsym + k] * s1[1] + coef[2 * nsym + k] * s1[2] + coef[3 * nsym + k] * s1[3];
+          batchY[k] = coef[4 * nsym + k] * s1[0] + coef[5 * nsym + k] * s1[1] + coef[6 * nsym + k] * s1[2] + coef[7 * nsym + k] * s1[3];
+          batchZ[k] = coef[8 * nsym + k] * s1[0] + coef[9 * nsym + k] * s1[1] + coef[10 * nsym + k] * s1[2] + coef[11 * nsym + k] * s1[3];
+          batchW[k] = coef[12 * nsym + k] * s1[0] + coef[13 * nsym + k] * s1[1] + coef[14 * nsym + k] * s1[2] + coef[15 * nsym + k] * s1[3];
+        }
+
+        for(size_t k = 0; k < nsym; k++)
+        {
+          double w = std::min(std::max(batchW[k], -1.0), 1.0);
+          double axisNorm = std::sqrt(batchX[k] * batchX[k] + batchY[k] * batchY[k] + batchZ[k] * batchZ[k]);
+          if(nullptr != m_Misorientations)
           {
-            sym_q = m_OrientationOps[phase1]->getQuatSymOp(j);
-            // calculate crystal direction parallel to normal
-            s1_misq = misq * sym_q;
-            s_xstl_norm = sym_q.multiplyByVector(xstl_norm);
-            for(int k = 0; k < nsym; k++)
+            double angle = 2.0 * std::acos(std::fabs(w));
+            if(angle < minAngle)
             {
-              // calculate the symmetric misorienation
-              sym_q = m_OrientationOps[phase1]->getQuatSymOp(k);
-              s2_misq = sym_q.conjugate() * s1_misq;
-
-              OrientationTransformation::qu2ax<QuatD, OrientationD>(s2_misq).toAxisAngle(n1, n2, n3, w);
-              w = w * 180.0 / SIMPLib::Constants::k_PiD;
-              axisdiffCSL = std::acos(std::fabs(n1) * cslAxisNorm[0] + std::fabs(n2) * cslAxisNorm[1] + std::fabs(n3) * cslAxisNorm[2]);
-              angdiffCSL = std::fabs(w - TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][1]);
-              if(axisdiffCSL < m_AxisTol && angdiffCSL < m_AngTol)
+              minAngle = angle;
+              if(axisNorm > 0.0)
+              {
+                double sign = w < 0.0 ? -1.0 : 1.0;
+                disorientation = {sign * batchX[k] / axisNorm, sign * batchY[k] / axisNorm, sign * batchZ[k] / axisNorm, angle * SIMPLib::Constants::k_180OverPiD};
+              }
+              else
               {
-                n[0] = n1;
-                n[1] = n2;
-                n[2] = n3;
-                m_CSLBoundary[i] = true;
-                incoherence = 180.0 * std::acos(GeometryMath::CosThetaBetweenVectors(n, s_xstl_norm.data())) / SIMPLib::Constants::k_PiD;
-                if(incoherence > 90.0)
-                {
-                  incoherence = 180.0 - incoherence;
-                }
-                if(incoherence < m_CSLBoundaryIncoherence[i])
-                {
-                  m_CSLBoundaryIncoherence[i] = incoherence;
-                }
+                disorientation = {0.0, 0.0, 1.0, 0.0};
               }
             }
           }
+
+          double omega = 2.0 * std::acos(w) * SIMPLib::Constants::k_180OverPiD;
+          if(axisNorm > 0.0)
+          {
+            n[0] = batchX[k] / axisNorm;
+            n[1] = batchY[k] / axisNorm;
+            n[2] = batchZ[k] / axisNorm;
+          }
+          else
+          {
+            n[0] = 0.0;
+            n[1] = 0.0;
+            n[2] = 1.0;
+          }
+          for(size_t t = 0; t < m_Targets.size(); t++)
+          {
+            const CSLTarget& target = m_Targets[t];
+            double angdiffCSL = std::fabs(omega - target.angle);
+            if(angdiffCSL >= m_AngTol)
+            {
+              continue;
+            }
+            double axisdiffCSL = std::acos(std::fabs(n[0]) * target.axis[0] + std::fabs(n[1]) * target.axis[1] + std::fabs(n[2]) * target.axis[2]);
+            if(axisdiffCSL < m_AxisTol)
+            {
+              matched[t] = 1;
+              double incoherence = 180.0 * std::acos(GeometryMath::CosThetaBetweenVectors(n, s_xstl_norm.data())) / SIMPLib::Constants::k_PiD;
+              if(incoherence > 90.0)
+              {
+                incoherence = 180.0 - incoherence;
+              }
+              incoherences[t] = std::min(incoherences[t], incoherence);
+            }
+          }
+        }
+      }
+
+      // The face is labeled with the first matching CSL in table order
+      for(size_t t = 0; t < m_Targets.size(); t++)
+      {
+        if(matched[t] != 0)
+        {
+          m_CSLBoundary[i] = true;
+          m_CSLBoundaryIncoherence[i] = std::min(m_CSLBoundaryIncoherence[i], static_cast<float>(incoherences[t]));
+          if(nullptr != m_CSLSigma)
+          {
+            m_CSLSigma[i] = m_Targets[t].sigma;
+          }
+          break;
+        }
+      }
+      if(nullptr != m_Misorientations)
+      {
+        for(size_t c = 0; c < 4; c++)
+        {
+          m_Misorientations[4 * i + c] = static_cast<float>(disorientation[c]);
         }
       }
     }
@@ -201,6 +361,7 @@ public:
   }
 #endif
 };
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -223,6 +384,8 @@ void FindCSLBoundaries::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("CSL (Sigma)", CSL, FilterParameter::Category::Parameter, FindCSLBoundaries));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Axis Tolerance (Degrees)", AxisTolerance, FilterParameter::Category::Parameter, FindCSLBoundaries));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Angle Tolerance (Degrees)", AngleTolerance, FilterParameter::Category::Parameter, FindCSLBoundaries));
+  std::vector<QString> linkedProps = {"SurfaceMeshCSLSigmaArrayName", "SurfaceMeshMisorientationsArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Classify All CSL Types", FindAllCSL, FilterParameter::Category::Parameter, FindCSLBoundaries, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Feature Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Category::Feature);
@@ -255,12 +418,18 @@ void FindCSLBoundaries::setupFilterParameters()
                                                       FilterParameter::Category::CreatedArray, FindCSLBoundaries));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("CSL Boundary Incoherence", SurfaceMeshCSLBoundaryIncoherenceArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath,
                                                       FilterParameter::Category::CreatedArray, FindCSLBoundaries));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("CSL Sigma", SurfaceMeshCSLSigmaArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindCSLBoundaries));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Misorientations", SurfaceMeshMisorientationsArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath,
+                                                      FilterParameter::Category::CreatedArray, FindCSLBoundaries));
   setFilterParameters(parameters);
 }
 // -----------------------------------------------------------------------------
 void FindCSLBoundaries::readFilterParameters(AbstractFilterParametersReader* reader, int index)
 {
   reader->openFilterGroup(this, index);
+  setSurfaceMeshMisorientationsArrayName(reader->readString("SurfaceMeshMisorientationsArrayName", getSurfaceMeshMisorientationsArrayName()));
+  setSurfaceMeshCSLSigmaArrayName(reader->readString("SurfaceMeshCSLSigmaArrayName", getSurfaceMeshCSLSigmaArrayName()));
   setSurfaceMeshCSLBoundaryIncoherenceArrayName(reader->readString("SurfaceMeshCSLBoundaryIncoherenceArrayName", getSurfaceMeshCSLBoundaryIncoherenceArrayName()));
   setSurfaceMeshCSLBoundaryArrayName(reader->readString("SurfaceMeshCSLBoundaryArrayName", getSurfaceMeshCSLBoundaryArrayName()));
   setSurfaceMeshFaceNormalsArrayPath(reader->readDataArrayPath("SurfaceMeshFaceNormalsArrayPath", getSurfaceMeshFaceNormalsArrayPath()));
@@ -271,6 +440,7 @@ void FindCSLBoundaries::readFilterParameters(AbstractFilterParametersReader* rea
   setCSL(reader->readValue("CSL", getCSL()));
   setAxisTolerance(reader->readValue("AxisTolerance", getAxisTolerance()));
   setAngleTolerance(reader->readValue("AngleTolerance", getAngleTolerance()));
+  setFindAllCSL(reader->readValue("FindAllCSL", getFindAllCSL()));
   reader->closeFilterGroup();
 }
 
@@ -340,6 +510,25 @@ void FindCSLBoundaries::dataCheckSurfaceMesh()
   {
     m_SurfaceMeshCSLBoundaryIncoherence = m_SurfaceMeshCSLBoundaryIncoherencePtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  m_SurfaceMeshCSLSigma = nullptr;
+  m_SurfaceMeshMisorientations = nullptr;
+  if(m_FindAllCSL)
+  {
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName(), getSurfaceMeshCSLSigmaArrayName());
+    m_SurfaceMeshCSLSigmaPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0.0f, dims, "", DataArrayID33);
+    if(nullptr != m_SurfaceMeshCSLSigmaPtr.lock())
+    {
+      m_SurfaceMeshCSLSigma = m_SurfaceMeshCSLSigmaPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    dims[0] = 4;
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName(), getSurfaceMeshMisorientationsArrayName());
+    m_SurfaceMeshMisorientationsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0.0f, dims, "", DataArrayID34);
+    if(nullptr != m_SurfaceMeshMisorientationsPtr.lock())
+    {
+      m_SurfaceMeshMisorientations = m_SurfaceMeshMisorientationsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -386,19 +575,23 @@ void FindCSLBoundaries::execute()
   float angtol = m_AngleTolerance;
   float axistol = static_cast<float>(m_AxisTolerance * M_PI / 180.0f);
 
+  // The symmetry tables and the CSL rows are shared read-only by all the threads
+  std::vector<SymmetryTable> symmetryTables = buildSymmetryTables(m_OrientationOps);
+  std::vector<CSLTarget> targets = buildCSLTargets(cslindex, m_FindAllCSL);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(true)
   {
     tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles),
-                      CalculateCSLBoundaryImpl(cslindex, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, m_SurfaceMeshCSLBoundary,
-                                               m_SurfaceMeshCSLBoundaryIncoherence),
+                      CalculateCSLBoundaryImpl(symmetryTables, targets, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures,
+                                               m_SurfaceMeshCSLBoundary, m_SurfaceMeshCSLBoundaryIncoherence, m_SurfaceMeshCSLSigma, m_SurfaceMeshMisorientations),
                       tbb::auto_partitioner());
   }
   else
 #endif
   {
-    CalculateCSLBoundaryImpl serial(cslindex, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, m_SurfaceMeshCSLBoundary,
-                                    m_SurfaceMeshCSLBoundaryIncoherence);
+    CalculateCSLBoundaryImpl serial(symmetryTables, targets, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures,
+                                    m_SurfaceMeshCSLBoundary, m_SurfaceMeshCSLBoundaryIncoherence, m_SurfaceMeshCSLSigma, m_SurfaceMeshMisorientations);
     serial.generate(0, numTriangles);
   }
 
@@ -542,6 +735,18 @@ float FindCSLBoundaries::getAngleTolerance() const
   return m_AngleTolerance;
 }
 
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setFindAllCSL(bool value)
+{
+  m_FindAllCSL = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindCSLBoundaries::getFindAllCSL() const
+{
+  return m_FindAllCSL;
+}
+
 // -----------------------------------------------------------------------------
 void FindCSLBoundaries::setAvgQuatsArrayPath(const DataArrayPath& value)
 {
@@ -625,3 +830,27 @@ QString FindCSLBoundaries::getSurfaceMeshCSLBoundaryIncoherenceArrayName() const
 {
   return m_SurfaceMeshCSLBoundaryIncoherenceArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setSurfaceMeshCSLSigmaArrayName(const QString& value)
+{
+  m_SurfaceMeshCSLSigmaArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindCSLBoundaries::getSurfaceMeshCSLSigmaArrayName() const
+{
+  return m_SurfaceMeshCSLSigmaArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setSurfaceMeshMisorientationsArrayName(const QString& value)
+{
+  m_SurfaceMeshMisorientationsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindCSLBoundaries::getSurfaceMeshMisorientationsArrayName() const
+{
+  return m_SurfaceMeshMisorientationsArrayName;
+}
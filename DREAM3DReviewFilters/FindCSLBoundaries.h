@@ -79,6 +79,7 @@ class DREAM3DReview_EXPORT FindCSLBoundaries : public AbstractFilter
   PYB11_PROPERTY(float CSL READ getCSL WRITE setCSL)
   PYB11_PROPERTY(float AxisTolerance READ getAxisTolerance WRITE setAxisTolerance)
   PYB11_PROPERTY(float AngleTolerance READ getAngleTolerance WRITE setAngleTolerance)
+  PYB11_PROPERTY(bool FindAllCSL READ getFindAllCSL WRITE setFindAllCSL)
   PYB11_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
   PYB11_PROPERTY(DataArrayPath FeaturePhasesArrayPath READ getFeaturePhasesArrayPath WRITE setFeaturePhasesArrayPath)
   PYB11_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
@@ -86,6 +87,8 @@ class DREAM3DReview_EXPORT FindCSLBoundaries : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SurfaceMeshFaceNormalsArrayPath READ getSurfaceMeshFaceNormalsArrayPath WRITE setSurfaceMeshFaceNormalsArrayPath)
   PYB11_PROPERTY(QString SurfaceMeshCSLBoundaryArrayName READ getSurfaceMeshCSLBoundaryArrayName WRITE setSurfaceMeshCSLBoundaryArrayName)
   PYB11_PROPERTY(QString SurfaceMeshCSLBoundaryIncoherenceArrayName READ getSurfaceMeshCSLBoundaryIncoherenceArrayName WRITE setSurfaceMeshCSLBoundaryIncoherenceArrayName)
+  PYB11_PROPERTY(QString SurfaceMeshCSLSigmaArrayName READ getSurfaceMeshCSLSigmaArrayName WRITE setSurfaceMeshCSLSigmaArrayName)
+  PYB11_PROPERTY(QString SurfaceMeshMisorientationsArrayName READ getSurfaceMeshMisorientationsArrayName WRITE setSurfaceMeshMisorientationsArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -141,6 +144,17 @@ public:
   float getAngleTolerance() const;
   Q_PROPERTY(float AngleTolerance READ getAngleTolerance WRITE setAngleTolerance)
 
+  /**
+   * @brief Setter property for FindAllCSL
+   */
+  void setFindAllCSL(bool value);
+  /**
+   * @brief Getter property for FindAllCSL
+   * @return Value of FindAllCSL
+   */
+  bool getFindAllCSL() const;
+  Q_PROPERTY(bool FindAllCSL READ getFindAllCSL WRITE setFindAllCSL)
+
   /**
    * @brief Setter property for AvgQuatsArrayPath
    */
@@ -218,6 +232,28 @@ public:
   QString getSurfaceMeshCSLBoundaryIncoherenceArrayName() const;
   Q_PROPERTY(QString SurfaceMeshCSLBoundaryIncoherenceArrayName READ getSurfaceMeshCSLBoundaryIncoherenceArrayName WRITE setSurfaceMeshCSLBoundaryIncoherenceArrayName)
 
+  /**
+   * @brief Setter property for SurfaceMeshCSLSigmaArrayName
+   */
+  void setSurfaceMeshCSLSigmaArrayName(const QString& value);
+  /**
+   * @brief Getter property for SurfaceMeshCSLSigmaArrayName
+   * @return Value of SurfaceMeshCSLSigmaArrayName
+   */
+  QString getSurfaceMeshCSLSigmaArrayName() const;
+  Q_PROPERTY(QString SurfaceMeshCSLSigmaArrayName READ getSurfaceMeshCSLSigmaArrayName WRITE setSurfaceMeshCSLSigmaArrayName)
+
+  /**
+   * @brief Setter property for SurfaceMeshMisorientationsArrayName
+   */
+  void setSurfaceMeshMisorientationsArrayName(const QString& value);
+  /**
+   * @brief Getter property for SurfaceMeshMisorientationsArrayName
+   * @return Value of SurfaceMeshMisorientationsArrayName
+   */
+  QString getSurfaceMeshMisorientationsArrayName() const;
+  Q_PROPERTY(QString SurfaceMeshMisorientationsArrayName READ getSurfaceMeshMisorientationsArrayName WRITE setSurfaceMeshMisorientationsArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -301,10 +337,15 @@ private:
   bool* m_SurfaceMeshCSLBoundary = nullptr;
   std::weak_ptr<DataArray<float>> m_SurfaceMeshCSLBoundaryIncoherencePtr;
   float* m_SurfaceMeshCSLBoundaryIncoherence = nullptr;
+  std::weak_ptr<DataArray<float>> m_SurfaceMeshCSLSigmaPtr;
+  float* m_SurfaceMeshCSLSigma = nullptr;
+  std::weak_ptr<DataArray<float>> m_SurfaceMeshMisorientationsPtr;
+  float* m_SurfaceMeshMisorientations = nullptr;
 
   float m_CSL = {3.0f};
   float m_AxisTolerance = {0.0f};
   float m_AngleTolerance = {0.0f};
+  bool m_FindAllCSL = {false};
   DataArrayPath m_AvgQuatsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::AvgQuats};
   DataArrayPath m_FeaturePhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::Phases};
   DataArrayPath m_CrystalStructuresArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellEnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures};
@@ -312,6 +353,8 @@ private:
   DataArrayPath m_SurfaceMeshFaceNormalsArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceNormals};
   QString m_SurfaceMeshCSLBoundaryArrayName = {TransformationPhaseConstants::SurfaceMeshCSLBoundary};
   QString m_SurfaceMeshCSLBoundaryIncoherenceArrayName = {TransformationPhaseConstants::SurfaceMeshCSLBoundaryIncoherence};
+  QString m_SurfaceMeshCSLSigmaArrayName = {TransformationPhaseConstants::SurfaceMeshCSLSigma};
+  QString m_SurfaceMeshMisorientationsArrayName = {TransformationPhaseConstants::SurfaceMeshMisorientations};
 
   LaueOpsContainer m_OrientationOps;
   CubicOps::Pointer m_CubicOps;
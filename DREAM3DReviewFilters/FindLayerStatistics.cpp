@@ -13,7 +13,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindLayerStatistics.h"
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -30,105 +32,20 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/LayerStatistics.hpp"
 
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#endif
-
-/**
- * @brief The CalcProjectedStatsImpl class implements a templated threaded algorithm for
- * determining the projected image statistics of a given volume.
- */
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
 template <typename T>
-class CalcLayerStatsImpl
-{
-
-public:
-  CalcLayerStatsImpl(T* data, float* min, float* max, float* avg, float* std, float* var, int32_t* startPoints, size_t* stride, size_t* dims)
-  : m_Data(data)
-  , m_Min(min)
-  , m_Max(max)
-  , m_Avg(avg)
-  , m_Std(std)
-  , m_Var(var)
-  , m_StartPoints(startPoints)
-  , m_Stride(stride)
-  , m_Dims(dims)
-  {
-  }
-  virtual ~CalcLayerStatsImpl() = default;
-
-  void convert(size_t start, size_t end) const
-  {
-    size_t shift = 0;
-    size_t count = 0;
-    size_t point = 0, newPoint = 0;
-    T val = static_cast<T>(0);
-    for(size_t i = start; i < end; i++)
-    {
-      count = 0;
-      point = m_StartPoints[i];
-      for(size_t k = 0; k < m_Dims[1]; k++)
-      {
-        shift = k * m_Stride[1];
-        for(size_t j = 0; j < m_Dims[0]; j++)
-        {
-          newPoint = static_cast<int32_t>(point + shift + (j * m_Stride[0]));
-          val = m_Data[newPoint];
-          if(val > 0.0)
-          {
-            if(val < m_Min[i])
-            {
-              m_Min[i] = val;
-            }
-            if(val > m_Max[i])
-            {
-              m_Max[i] = val;
-            }
-            m_Avg[i] += val;
-            count++;
-          }
-        }
-      }
-      m_Avg[i] /= count;
-      for(size_t k = 0; k < m_Dims[1]; k++)
-      {
-        shift = k * m_Stride[1];
-        for(size_t j = 0; j < m_Dims[0]; j++)
-        {
-          newPoint = static_cast<int32_t>(point + shift + (j * m_Stride[0]));
-          val = m_Data[newPoint];
-          if(val > 0.0)
-          {
-            m_Std[i] += ((val - m_Avg[i]) * (val - m_Avg[i]));
-          }
-        }
-      }
-      m_Std[i] /= count;
-      m_Var[i] = m_Std[i];
-      m_Std[i] = std::sqrt(m_Std[i]);
-    }
-  }
-
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
-  {
-    convert(r.begin(), r.end());
-  }
-#endif
-private:
-  T* m_Data = nullptr;
-  float* m_Min = nullptr;
-  float* m_Max = nullptr;
-  float* m_Avg = nullptr;
-  float* m_Std = nullptr;
-  float* m_Var = nullptr;
-  int32_t* m_StartPoints = nullptr;
-  size_t* m_Stride = nullptr;
-  size_t* m_Dims = nullptr;
-};
+void accumulateLayers(IDataArray::Pointer inputPtr, LayerStatistics::Accumulator& accumulator, size_t numPlanes, int32_t* layerIds)
+{
+  typename DataArray<T>::Pointer input = std::dynamic_pointer_cast<DataArray<T>>(inputPtr);
+  accumulator.addPlanes(input->getPointer(0), 0, numPlanes, layerIds);
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -322,237 +239,40 @@ void FindLayerStatistics::execute()
 
   SizeVec3Type dimsP = m->getGeometryAs<ImageGeom>()->getDimensions();
 
-  Int32ArrayType::Pointer startingPoints = Int32ArrayType::CreateArray(0, std::string("_INTERNAL_USE_ONLY_startingPoints"), true);
-  int32_t* startPoints = nullptr;
-  size_t stride[2];
-  size_t dims[2];
-  // size_t yStride = 0;
-  size_t depth = 0;
-  if(m_Plane == 0)
-  {
-    startingPoints->resizeTuples(dimsP[2]);
-    startPoints = startingPoints->getPointer(0);
-    stride[0] = 1;
-    stride[1] = dimsP[0];
-    dims[0] = dimsP[0];
-    dims[1] = dimsP[1];
-    depth = dimsP[2];
-    for(size_t i = 0; i < dimsP[2]; i++)
-    {
-      startPoints[i] = i * (dimsP[0] * dimsP[1]);
-    }
-  }
-  if(m_Plane == 1)
-  {
-    startingPoints->resizeTuples(dimsP[1]);
-    startPoints = startingPoints->getPointer(0);
-    stride[0] = 1;
-    stride[1] = (dimsP[0] * dimsP[1]);
-    dims[0] = dimsP[0];
-    dims[1] = dimsP[2];
-    depth = dimsP[1];
-    for(size_t i = 0; i < dimsP[1]; i++)
-    {
-      startPoints[i] = i * dimsP[0];
-    }
-  }
-  if(m_Plane == 2)
-  {
-    startingPoints->resizeTuples(dimsP[0]);
-    startPoints = startingPoints->getPointer(0);
-    stride[0] = dimsP[0];
-    stride[1] = (dimsP[0] * dimsP[1]);
-    dims[0] = dimsP[1];
-    dims[1] = dimsP[2];
-    depth = dimsP[0];
-    for(size_t i = 0; i < dimsP[0]; i++)
-    {
-      startPoints[i] = i;
-    }
-  }
-
-  if(nullptr == startPoints)
+  if(m_Plane > 2)
   {
     QString ss = QObject::tr("Unable to establish starting location for supplied plane. The plane is %1").arg(m_Plane);
     setErrorCondition(-11001, ss);
     return;
   }
 
-  if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InDataPtr.lock()))
-  {
-    Int8ArrayType::Pointer cellArray = std::dynamic_pointer_cast<Int8ArrayType>(m_InDataPtr.lock());
-    int8_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<int8_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<int8_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InDataPtr.lock()))
-  {
-    UInt8ArrayType::Pointer cellArray = std::dynamic_pointer_cast<UInt8ArrayType>(m_InDataPtr.lock());
-    uint8_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<uint8_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<uint8_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InDataPtr.lock()))
-  {
-    Int16ArrayType::Pointer cellArray = std::dynamic_pointer_cast<Int16ArrayType>(m_InDataPtr.lock());
-    int16_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<int16_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<int16_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InDataPtr.lock()))
-  {
-    UInt16ArrayType::Pointer cellArray = std::dynamic_pointer_cast<UInt16ArrayType>(m_InDataPtr.lock());
-    uint16_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<uint16_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<uint16_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InDataPtr.lock()))
-  {
-    Int32ArrayType::Pointer cellArray = std::dynamic_pointer_cast<Int32ArrayType>(m_InDataPtr.lock());
-    int32_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<int32_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<int32_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InDataPtr.lock()))
-  {
-    UInt32ArrayType::Pointer cellArray = std::dynamic_pointer_cast<UInt32ArrayType>(m_InDataPtr.lock());
-    uint32_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<uint32_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<uint32_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InDataPtr.lock()))
-  {
-    Int64ArrayType::Pointer cellArray = std::dynamic_pointer_cast<Int64ArrayType>(m_InDataPtr.lock());
-    int64_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<int64_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<int64_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InDataPtr.lock()))
-  {
-    UInt64ArrayType::Pointer cellArray = std::dynamic_pointer_cast<UInt64ArrayType>(m_InDataPtr.lock());
-    uint64_t* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<uint64_t>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<uint64_t> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InDataPtr.lock()))
+  // The volume is read once in storage order for every plane orientation
+  std::array<size_t, 3> dims = {dimsP[0], dimsP[1], dimsP[2]};
+  LayerStatistics::Accumulator accumulator(dims, static_cast<LayerStatistics::Plane>(m_Plane));
+  EXECUTE_FUNCTION_TEMPLATE_NO_BOOL(DataArray, this, accumulateLayers, m_InDataPtr.lock(), m_InDataPtr.lock(), accumulator, dims[2], m_LayerIDs)
+  if(getErrorCode() < 0)
   {
-    FloatArrayType::Pointer cellArray = std::dynamic_pointer_cast<FloatArrayType>(m_InDataPtr.lock());
-    float* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<float>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<float> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
+    return;
   }
-  else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InDataPtr.lock()))
+
+  // Layers without positive values are reported as 0
+  const std::vector<LayerStatistics::Moments>& layers = accumulator.layers();
+  for(size_t i = 0; i < layers.size(); i++)
   {
-    DoubleArrayType::Pointer cellArray = std::dynamic_pointer_cast<DoubleArrayType>(m_InDataPtr.lock());
-    double* cPtr = cellArray->getPointer(0);
-#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
-    if(doParallel == true)
+    if(layers[i].count == 0)
     {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, depth), CalcLayerStatsImpl<double>(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims),
-                        tbb::auto_partitioner());
+      m_LayerMin[i] = 0.0f;
+      m_LayerMax[i] = 0.0f;
+      m_LayerAvg[i] = 0.0f;
+      m_LayerStd[i] = 0.0f;
+      m_LayerVar[i] = 0.0f;
+      continue;
     }
-    else
-#endif
-    {
-      CalcLayerStatsImpl<double> serial(cPtr, m_LayerMin, m_LayerMax, m_LayerAvg, m_LayerStd, m_LayerVar, startPoints, stride, dims);
-      serial.convert(0, depth);
-    }
-  }
-  else
-  {
-    QString ss = QObject::tr("Selected array is of unsupported type. The type is %1").arg(m_InDataPtr.lock()->getTypeAsString());
-    setErrorCondition(-11001, ss);
-    return;
+    m_LayerMin[i] = static_cast<float>(layers[i].min);
+    m_LayerMax[i] = static_cast<float>(layers[i].max);
+    m_LayerAvg[i] = static_cast<float>(layers[i].mean);
+    m_LayerVar[i] = static_cast<float>(layers[i].variance());
+    m_LayerStd[i] = static_cast<float>(std::sqrt(layers[i].variance()));
   }
 
   notifyStatusMessage("Complete");
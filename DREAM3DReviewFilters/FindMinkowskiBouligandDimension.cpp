@@ -14,7 +14,10 @@
 
 #include "FindMinkowskiBouligandDimension.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 
 #include <QtCore/QTextStream>
 
@@ -22,12 +25,15 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/BoxCounting.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -58,6 +64,11 @@ void FindMinkowskiBouligandDimension::initialize()
 void FindMinkowskiBouligandDimension::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
+  std::vector<QString> linkedProps = {"MinimumBoxSize", "MaximumBoxSize"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Limit Scale Range", LimitScaleRange, FilterParameter::Category::Parameter, FindMinkowskiBouligandDimension, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Minimum Box Size (Voxels)", MinimumBoxSize, FilterParameter::Category::Parameter, FindMinkowskiBouligandDimension));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Box Size (Voxels)", MaximumBoxSize, FilterParameter::Category::Parameter, FindMinkowskiBouligandDimension));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Grid Offsets", NumberOfGridOffsets, FilterParameter::Category::Parameter, FindMinkowskiBouligandDimension));
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::Category::RequiredArray, FindMinkowskiBouligandDimension, dasReq));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Fractal Attribute Matrix", AttributeMatrixName, MaskArrayPath, FilterParameter::Category::CreatedArray, FindMinkowskiBouligandDimension));
@@ -88,6 +99,26 @@ void FindMinkowskiBouligandDimension::dataCheck()
     setErrorCondition(-1, ss);
   }
 
+  if(getLimitScaleRange())
+  {
+    if(getMinimumBoxSize() < 1)
+    {
+      QString ss = QObject::tr("The minimum box size must be at least 1 voxel");
+      setErrorCondition(-2, ss);
+    }
+    else if(firstLevel() >= lastLevel())
+    {
+      QString ss = QObject::tr("The scale range [%1, %2] must contain at least two power of two box sizes").arg(getMinimumBoxSize()).arg(getMaximumBoxSize());
+      setErrorCondition(-3, ss);
+    }
+  }
+
+  if(getNumberOfGridOffsets() < 1)
+  {
+    QString ss = QObject::tr("The number of grid offsets must be at least 1");
+    setErrorCondition(-4, ss);
+  }
+
   std::vector<size_t> cDims(1, 1);
 
   m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getMaskArrayPath(), cDims);
@@ -117,23 +148,35 @@ void FindMinkowskiBouligandDimension::dataCheck()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FindMinkowskiBouligandDimension::findSourceIndices(std::vector<size_t>& indices, size_t sourceDim, size_t index, size_t box[3], size_t imageDim)
+size_t FindMinkowskiBouligandDimension::firstLevel() const
 {
-  size_t zloop = imageDim == 3 ? 2 : 1;
-  for(size_t z = 0; z < zloop; z++)
+  if(!getLimitScaleRange())
   {
-    size_t zStride = (z * sourceDim * sourceDim) + (box[2] * sourceDim * sourceDim * 2);
-    for(size_t y = 0; y < 2; y++)
-    {
-      size_t yStride = (y * sourceDim) + (box[1] * sourceDim * 2);
-      for(size_t x = 0; x < 2; x++)
-      {
-        size_t idx = (z * 2 * 2) + (y * 2) + x;
-        size_t mov_idx = zStride + yStride + x + (box[0] * 2);
-        indices[idx] = mov_idx;
-      }
-    }
+    return 0;
+  }
+  size_t level = 0;
+  while((int64_t(1) << level) < getMinimumBoxSize())
+  {
+    level++;
+  }
+  return level;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FindMinkowskiBouligandDimension::lastLevel() const
+{
+  if(!getLimitScaleRange())
+  {
+    return std::numeric_limits<size_t>::max();
   }
+  size_t level = 0;
+  while((int64_t(2) << level) <= getMaximumBoxSize())
+  {
+    level++;
+  }
+  return level;
 }
 
 // -----------------------------------------------------------------------------
@@ -150,189 +193,65 @@ void FindMinkowskiBouligandDimension::execute()
 
   ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(m_MaskArrayPath.getDataContainerName())->getGeometryAs<ImageGeom>();
   SizeVec3Type dims = image->getDimensions();
-  // FloatVec3Type res = image->getSpacing();
-
-  size_t maxDim = std::max({dims[0], dims[1], dims[2]});
-  size_t imageDim = 3;
+  std::array<size_t, 3> extents = {dims[0], dims[1], dims[2]};
 
-  if(std::find(std::begin(dims), std::end(dims), 1) != std::end(dims))
+  // A 2D image is counted in its own plane; dropping the axis of length 1 does not
+  // change the linear voxel indices
+  if(std::find(std::begin(extents), std::end(extents), 1) != std::end(extents))
   {
-    imageDim = 2;
-    if(dims[0] == 1)
+    if(extents[0] == 1)
     {
-      dims[0] = dims[1];
-      dims[1] = dims[2];
+      extents[0] = extents[1];
+      extents[1] = extents[2];
     }
-    else if(dims[1] == 1)
-    {
-      dims[1] = dims[2];
-    }
-    dims[2] = 1;
-  }
-
-  auto is_pow_2 = [](size_t x) -> bool { return !(x & (x - 1)); };
-
-  auto next_pow_2 = [&](size_t x) -> size_t {
-    if(is_pow_2(x))
-    {
-      return x;
-    }
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-    x |= x >> 32;
-    return x + 1;
-  };
-
-  auto floor_log2 = [](size_t x) -> size_t {
-    size_t exp = 0;
-    while(x >>= 1)
+    else if(extents[1] == 1)
     {
-      ++exp;
+      extents[1] = extents[2];
     }
-    return exp;
-  };
-
-  maxDim = next_pow_2(maxDim);
-  size_t exponent = floor_log2(maxDim);
-  size_t totalSize = std::pow(maxDim, imageDim);
-
-  std::vector<bool> source(totalSize, 0);
-  size_t offsets[3] = {(maxDim - dims[0]) / 2, (maxDim - dims[1]) / 2, (maxDim - dims[2]) / 2};
-
-  if(imageDim == 2)
-  {
-    offsets[2] = 0;
+    extents[2] = 1;
   }
 
-  for(size_t z = 0; z < dims[2]; z++)
+  // Levels 0 ... numLevels - 1 have boxes of edge 1, 2, 4, ... voxels; the largest
+  // box spans the longest axis
+  size_t numLevels = BoxCounting::numberOfLevels(extents);
+  size_t first = firstLevel();
+  size_t last = std::min(lastLevel(), numLevels - 1);
+  if(first >= last)
   {
-    size_t zStride = (z * dims[1] * dims[0]);
-    for(size_t y = 0; y < dims[1]; y++)
-    {
-      size_t yStride = (y * dims[0]);
-      for(size_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = zStride + yStride + x;
-        size_t gridIndex = ((z + offsets[2]) * maxDim * maxDim) + ((y + offsets[1]) * maxDim) + (x + offsets[0]);
-        source[gridIndex] = m_Mask[index];
-      }
-    }
+    QString ss = QObject::tr("The scale range must contain at least two power of two box sizes no larger than %1 voxels").arg(size_t(1) << (numLevels - 1));
+    setErrorCondition(-5, ss);
+    return;
   }
 
-  size_t edgeLength = maxDim;
-  std::vector<size_t> boxDims(exponent + 1, edgeLength);
-  std::generate(std::next(std::begin(boxDims)), std::end(boxDims), [&edgeLength]() {
-    edgeLength /= 2;
-    return edgeLength;
-  });
-
-  std::vector<size_t> covering(exponent + 1, 0);
-  size_t nextDim = *std::next(std::begin(boxDims));
-  std::vector<bool> sink;
-  sink.reserve(std::pow(nextDim, imageDim));
-  std::vector<size_t> indices(std::pow(2, imageDim), 0);
-  auto dimsIter = std::next(std::begin(boxDims));
-  auto coverIter = std::next(std::begin(covering));
-  size_t box[3] = {0, 0, 0};
-
-  for(auto&& box : source)
+  size_t numVoxels = extents[0] * extents[1] * extents[2];
+  std::vector<size_t> covering(last + 1, 0);
+  covering[0] = static_cast<size_t>(std::count(m_Mask, m_Mask + numVoxels, true));
+  if(covering[0] == 0)
   {
-    if(box)
-    {
-      (*std::begin(covering))++;
-    }
+    QString ss = QObject::tr("The mask does not contain any true values");
+    setErrorCondition(-6, ss);
+    return;
   }
 
-  for(; dimsIter != std::prev(std::end(boxDims)); ++dimsIter, ++coverIter)
+  // Count every level on each grid offset and keep the smallest count, which is the
+  // best covering found at that scale
+  std::vector<std::array<size_t, 3>> offsets = BoxCounting::gridOffsets(extents, numLevels, static_cast<size_t>(m_NumberOfGridOffsets));
+  std::vector<size_t> counts;
+  for(size_t j = 0; j < offsets.size(); j++)
   {
-    sink.resize(std::pow(*dimsIter, imageDim));
-
-    size_t zloop = imageDim == 3 ? *dimsIter : 1;
-    for(size_t z = 0; z < zloop; z++)
+    notifyStatusMessage(QObject::tr("Counting boxes on grid offset %1 of %2").arg(j + 1).arg(offsets.size()));
+    BoxCounting::countCoarseBoxes(m_Mask, extents, offsets[j], last + 1, counts, [this]() { return getCancel(); });
+    if(getCancel())
     {
-      for(size_t y = 0; y < *dimsIter; y++)
-      {
-        for(size_t x = 0; x < *dimsIter; x++)
-        {
-          size_t index = (z * (*dimsIter) * (*dimsIter)) + (y * (*dimsIter)) + x;
-          box[0] = x;
-          box[1] = y;
-          box[2] = z;
-          findSourceIndices(indices, *std::prev(dimsIter), index, box, imageDim);
-          for(auto&& ind : indices)
-          {
-            if(source[ind])
-            {
-              sink[index] = true;
-              break;
-            }
-          }
-        }
-      }
+      return;
     }
-    for(auto&& box : sink)
+    for(size_t k = 1; k <= last; k++)
     {
-      if(box)
-      {
-        (*coverIter)++;
-      }
+      covering[k] = (j == 0) ? counts[k] : std::min(covering[k], counts[k]);
     }
-
-    source = sink;
-  }
-
-  covering.back() = 1;
-
-  std::vector<double> LnNumBoxes(covering.size(), 0);
-  std::vector<double> LnOneOverE(boxDims.size(), 0);
-#if 0
-  std::transform(std::rbegin(covering), std::rend(covering), std::begin(LnNumBoxes), [](size_t& x) -> double {
-    return std::log(x);
-  });
-#else
-  typedef std::vector<size_t>::iterator iter_type;
-  // ? 0 1 2 3 4 5 6 7 8 9 ?
-  iter_type from(covering.begin());                 //   ^
-                                                    //         ------>
-  iter_type until(covering.end());                  //                       ^
-                                                    //
-  std::reverse_iterator<iter_type> rev_until(from); // ^
-                                                    //         <------
-  std::reverse_iterator<iter_type> rev_from(until); //                     ^
-  std::vector<double>::size_type lnIdx = 0;
-  while(rev_from != rev_until)
-  {
-    LnNumBoxes[lnIdx] = static_cast<double>(std::log(*rev_from));
-    lnIdx++;
-    rev_from++;
   }
-#endif
-
-  std::transform(std::begin(boxDims), std::end(boxDims), std::begin(LnOneOverE), [](size_t& x) -> double { return std::log(1.0 / x); });
-
-  auto linear_regression_slope = [&]() -> double {
-    double xmean = std::accumulate(std::begin(LnOneOverE), std::end(LnOneOverE), 0.0);
-    double ymean = std::accumulate(std::begin(LnNumBoxes), std::end(LnNumBoxes), 0.0);
-    xmean /= LnOneOverE.size();
-    ymean /= LnNumBoxes.size();
-
-    std::vector<double> xx;
-    std::transform(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnOneOverE), std::back_inserter(xx), std::multiplies<double>());
-    double sumxx = std::accumulate(std::begin(xx), std::end(xx), 0.0);
-    double ssxx = sumxx - (xx.size() * xmean * xmean);
-
-    std::vector<double> xy;
-    std::transform(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnNumBoxes), std::back_inserter(xy), std::multiplies<double>());
-    double sumxy = std::accumulate(std::begin(xy), std::end(xy), 0.0);
-    double ssxy = sumxy - (xy.size() * xmean * ymean);
-
-    return ssxy / ssxx;
-  };
 
-  m_MinkowskiBouligandDimension[0] = linear_regression_slope();
+  m_MinkowskiBouligandDimension[0] = BoxCounting::fitDimension(covering, first, last);
 
   notifyStatusMessage("Complete");
 }
@@ -473,3 +392,51 @@ QString FindMinkowskiBouligandDimension::getMinkowskiBouligandDimensionArrayName
 {
   return m_MinkowskiBouligandDimensionArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setLimitScaleRange(bool value)
+{
+  m_LimitScaleRange = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindMinkowskiBouligandDimension::getLimitScaleRange() const
+{
+  return m_LimitScaleRange;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setMinimumBoxSize(int value)
+{
+  m_MinimumBoxSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindMinkowskiBouligandDimension::getMinimumBoxSize() const
+{
+  return m_MinimumBoxSize;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setMaximumBoxSize(int value)
+{
+  m_MaximumBoxSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindMinkowskiBouligandDimension::getMaximumBoxSize() const
+{
+  return m_MaximumBoxSize;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setNumberOfGridOffsets(int value)
+{
+  m_NumberOfGridOffsets = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindMinkowskiBouligandDimension::getNumberOfGridOffsets() const
+{
+  return m_NumberOfGridOffsets;
+}
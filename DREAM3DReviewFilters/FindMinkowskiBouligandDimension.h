@@ -82,6 +82,50 @@ public:
   QString getMinkowskiBouligandDimensionArrayName() const;
   Q_PROPERTY(QString MinkowskiBouligandDimensionArrayName READ getMinkowskiBouligandDimensionArrayName WRITE setMinkowskiBouligandDimensionArrayName)
 
+  /**
+   * @brief Setter property for LimitScaleRange
+   */
+  void setLimitScaleRange(bool value);
+  /**
+   * @brief Getter property for LimitScaleRange
+   * @return Value of LimitScaleRange
+   */
+  bool getLimitScaleRange() const;
+  Q_PROPERTY(bool LimitScaleRange READ getLimitScaleRange WRITE setLimitScaleRange)
+
+  /**
+   * @brief Setter property for MinimumBoxSize
+   */
+  void setMinimumBoxSize(int value);
+  /**
+   * @brief Getter property for MinimumBoxSize
+   * @return Value of MinimumBoxSize
+   */
+  int getMinimumBoxSize() const;
+  Q_PROPERTY(int MinimumBoxSize READ getMinimumBoxSize WRITE setMinimumBoxSize)
+
+  /**
+   * @brief Setter property for MaximumBoxSize
+   */
+  void setMaximumBoxSize(int value);
+  /**
+   * @brief Getter property for MaximumBoxSize
+   * @return Value of MaximumBoxSize
+   */
+  int getMaximumBoxSize() const;
+  Q_PROPERTY(int MaximumBoxSize READ getMaximumBoxSize WRITE setMaximumBoxSize)
+
+  /**
+   * @brief Setter property for NumberOfGridOffsets
+   */
+  void setNumberOfGridOffsets(int value);
+  /**
+   * @brief Getter property for NumberOfGridOffsets
+   * @return Value of NumberOfGridOffsets
+   */
+  int getNumberOfGridOffsets() const;
+  Q_PROPERTY(int NumberOfGridOffsets READ getNumberOfGridOffsets WRITE setNumberOfGridOffsets)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -150,6 +194,16 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Returns the finest level used in the fit; level k has boxes of edge 2^k voxels
+   */
+  size_t firstLevel() const;
+
+  /**
+   * @brief Returns the coarsest level allowed by the scale range, before clamping to the image size
+   */
+  size_t lastLevel() const;
+
 private:
   std::weak_ptr<DataArray<bool>> m_MaskPtr;
   bool* m_Mask = nullptr;
@@ -159,8 +213,10 @@ private:
   DataArrayPath m_MaskArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Mask};
   QString m_AttributeMatrixName = {"FractalData"};
   QString m_MinkowskiBouligandDimensionArrayName = {"MinkowskiBouligandDimension"};
-
-  void findSourceIndices(std::vector<size_t>& indices, size_t sourceDim, size_t index, size_t box[3], size_t imageDim);
+  bool m_LimitScaleRange = {false};
+  int m_MinimumBoxSize = {1};
+  int m_MaximumBoxSize = {64};
+  int m_NumberOfGridOffsets = {1};
 
 public:
   FindMinkowskiBouligandDimension(const FindMinkowskiBouligandDimension&) = delete;            // Copy Constructor Not Implemented
@@ -16,6 +16,7 @@
 
 #include <functional>
 
+#include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -23,8 +24,11 @@
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
@@ -71,6 +75,20 @@ void FindNeighborListStatistics::setupFilterParameters()
   linkedProps.push_back("SummationArrayName");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Summation", FindSummation, FilterParameter::Category::Parameter, FindNeighborListStatistics, linkedProps));
   linkedProps.clear();
+  linkedProps.push_back("Percentiles");
+  linkedProps.push_back("PercentilesArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Percentiles", FindPercentiles, FilterParameter::Category::Parameter, FindNeighborListStatistics, linkedProps));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Percentiles (Comma Delimited)", Percentiles, FilterParameter::Category::Parameter, FindNeighborListStatistics));
+  linkedProps.clear();
+  linkedProps.push_back("InterquartileRangeArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Interquartile Range", FindInterquartileRange, FilterParameter::Category::Parameter, FindNeighborListStatistics, linkedProps));
+  linkedProps.clear();
+
+  parameters.push_back(SeparatorFilterParameter::Create("Algorithm Options", FilterParameter::Category::Parameter));
+  linkedProps.push_back("SketchCompression");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Approximate Median and Percentiles", UseApproximateQuantiles, FilterParameter::Category::Parameter, FindNeighborListStatistics, linkedProps));
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Quantile Sketch Compression", SketchCompression, FilterParameter::Category::Parameter, FindNeighborListStatistics));
+  linkedProps.clear();
 
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to Compute Statistics", SelectedArrayPath, FilterParameter::Category::RequiredArray, FindNeighborListStatistics, dasReq));
@@ -92,6 +110,10 @@ void FindNeighborListStatistics::setupFilterParameters()
                                                       FindNeighborListStatistics));
   parameters.push_back(
       SIMPL_NEW_DA_WITH_LINKED_AM_FP("Summation", SummationArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindNeighborListStatistics));
+  parameters.push_back(
+      SIMPL_NEW_DA_WITH_LINKED_AM_FP("Percentiles", PercentilesArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindNeighborListStatistics));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Interquartile Range", InterquartileRangeArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray,
+                                                      FindNeighborListStatistics));
 
   setFilterParameters(parameters);
 }
@@ -112,7 +134,8 @@ void FindNeighborListStatistics::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
-  if(!getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength())
+  if(!getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength() && !getFindPercentiles() &&
+     !getFindInterquartileRange())
   {
     QString ss = QObject::tr("No statistics have been selected, so this filter will perform no operations");
     setWarningCondition(-11005, ss);
@@ -149,6 +172,12 @@ void FindNeighborListStatistics::dataCheck()
   }
   EXECUTE_FUNCTION_TEMPLATE_NO_BOOL(NeighborList, this, createCompatibleArrays, m_InputArrayPtr.lock(), dataArrayPaths)
 
+  createQuantileArrays(-11007);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
   getDataContainerArray()->validateNumberOfTuples(this, dataArrayPaths);
 }
 
@@ -158,7 +187,7 @@ class FindNeighborListStatisticsImpl
 {
 public:
   FindNeighborListStatisticsImpl(AbstractFilter* filter, IDataArray::Pointer& source, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
-                                 std::vector<IDataArray::Pointer>& arrays)
+                                 std::vector<IDataArray::Pointer>& arrays, const std::vector<double>& percentileFractions, bool approximateQuantiles, double sketchCompression)
   : m_Filter(filter)
   , m_Source(source)
   , m_Length(length)
@@ -169,7 +198,26 @@ public:
   , m_StdDeviation(stdDeviation)
   , m_Summation(summation)
   , m_Arrays(arrays)
+  , m_ApproximateQuantiles(approximateQuantiles)
+  , m_SketchCompression(sketchCompression)
   {
+    // All the quantiles of a list are found together: the percentiles, then the quartiles of the
+    // interquartile range, then the median if it is approximated
+    if(m_Arrays[7])
+    {
+      m_QuantileFractions = percentileFractions;
+    }
+    m_QuartilesIndex = m_QuantileFractions.size();
+    if(m_Arrays[8])
+    {
+      m_QuantileFractions.push_back(0.25);
+      m_QuantileFractions.push_back(0.75);
+    }
+    m_MedianIndex = m_QuantileFractions.size();
+    if(m_Median && m_ApproximateQuantiles && m_Arrays[4])
+    {
+      m_QuantileFractions.push_back(0.5);
+    }
   }
 
   virtual ~FindNeighborListStatisticsImpl() = default;
@@ -179,6 +227,7 @@ public:
     using NeighborListType = NeighborList<T>;
     typename NeighborListType::Pointer inputDataPtr = std::dynamic_pointer_cast<NeighborListType>(m_Source);
 
+    std::vector<float> quantiles;
     for(size_t i = start; i < end; i++)
     {
       if(m_Filter->getCancel())
@@ -186,6 +235,7 @@ public:
         break;
       }
       std::vector<T>& tmpList = (*inputDataPtr)[i];
+      findQuantiles(tmpList, quantiles);
 
       if(m_Length)
       {
@@ -223,7 +273,7 @@ public:
       {
         if(m_Arrays[4])
         {
-          float val = StatisticsHelpers::findMedian(tmpList);
+          float val = m_ApproximateQuantiles ? quantiles[m_MedianIndex] : StatisticsHelpers::findMedian(tmpList);
           m_Arrays[4]->initializeTuple(i, &val);
         }
       }
@@ -243,6 +293,46 @@ public:
           m_Arrays[6]->initializeTuple(i, &val);
         }
       }
+      if(m_Arrays[7])
+      {
+        m_Arrays[7]->initializeTuple(i, quantiles.data());
+      }
+      if(m_Arrays[8])
+      {
+        float val = quantiles[m_QuartilesIndex + 1] - quantiles[m_QuartilesIndex];
+        m_Arrays[8]->initializeTuple(i, &val);
+      }
+    }
+  }
+
+  /**
+   * @brief Finds the quantiles of a list, exactly from a copy of the list or approximately
+   * from a quantile sketch
+   */
+  void findQuantiles(const std::vector<T>& list, std::vector<float>& quantiles) const
+  {
+    quantiles.resize(m_QuantileFractions.size());
+    if(m_QuantileFractions.empty())
+    {
+      return;
+    }
+    if(m_ApproximateQuantiles)
+    {
+      StatisticsHelpers::QuantileSketch sketch(m_SketchCompression);
+      for(const T& value : list)
+      {
+        sketch.add(static_cast<double>(value));
+      }
+      for(size_t q = 0; q < m_QuantileFractions.size(); q++)
+      {
+        quantiles[q] = static_cast<float>(sketch.quantile(m_QuantileFractions[q]));
+      }
+      return;
+    }
+    std::vector<T> values(list);
+    for(size_t q = 0; q < m_QuantileFractions.size(); q++)
+    {
+      quantiles[q] = static_cast<float>(StatisticsHelpers::findPercentileInPlace(values.data(), values.size(), m_QuantileFractions[q]));
     }
   }
 
@@ -263,18 +353,23 @@ private:
   bool m_Summation = false;
 
   std::vector<IDataArray::Pointer>& m_Arrays;
+  bool m_ApproximateQuantiles = false;
+  double m_SketchCompression = 100.0;
+  std::vector<double> m_QuantileFractions;
+  size_t m_QuartilesIndex = 0;
+  size_t m_MedianIndex = 0;
 };
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void findStatistics(AbstractFilter* filter, IDataArray::Pointer source, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
-                    std::vector<IDataArray::Pointer>& arrays)
+                    std::vector<IDataArray::Pointer>& arrays, const std::vector<double>& percentileFractions, bool approximateQuantiles, double sketchCompression)
 {
   size_t numTuples = source->getNumberOfTuples();
   // Allow data-based parallelization
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numTuples);
-  dataAlg.execute(FindNeighborListStatisticsImpl<T>(filter, source, length, min, max, mean, median, stdDeviation, summation, arrays));
+  dataAlg.execute(FindNeighborListStatisticsImpl<T>(filter, source, length, min, max, mean, median, stdDeviation, summation, arrays, percentileFractions, approximateQuantiles, sketchCompression));
 }
 
 // -----------------------------------------------------------------------------
@@ -288,12 +383,12 @@ void FindNeighborListStatistics::execute()
     return;
   }
 
-  if(!m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength)
+  if(!m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength && !m_FindPercentiles && !m_FindInterquartileRange)
   {
     return;
   }
 
-  std::vector<IDataArray::Pointer> arrays(7, nullptr);
+  std::vector<IDataArray::Pointer> arrays(9, nullptr);
 
   if(m_FindLength)
   {
@@ -323,9 +418,17 @@ void FindNeighborListStatistics::execute()
   {
     arrays[6] = m_SummationPtr.lock();
   }
+  if(m_FindPercentiles)
+  {
+    arrays[7] = m_PercentilesPtr.lock();
+  }
+  if(m_FindInterquartileRange)
+  {
+    arrays[8] = m_InterquartileRangePtr.lock();
+  }
 
   EXECUTE_FUNCTION_TEMPLATE_NO_BOOL(NeighborList, this, findStatistics, m_InputArrayPtr.lock(), this, m_InputArrayPtr.lock(), m_FindLength, m_FindMin, m_FindMax, m_FindMean, m_FindMedian,
-                                    m_FindStdDeviation, m_FindSummation, arrays)
+                                    m_FindStdDeviation, m_FindSummation, arrays, m_PercentileFractions, m_UseApproximateQuantiles, m_SketchCompression)
 }
 
 // -----------------------------------------------------------------------------
@@ -512,6 +615,66 @@ bool FindNeighborListStatistics::getFindSummation() const
   return m_FindSummation;
 }
 
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setFindPercentiles(bool value)
+{
+  m_FindPercentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindNeighborListStatistics::getFindPercentiles() const
+{
+  return m_FindPercentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setPercentiles(const QString& value)
+{
+  m_Percentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindNeighborListStatistics::getPercentiles() const
+{
+  return m_Percentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setFindInterquartileRange(bool value)
+{
+  m_FindInterquartileRange = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindNeighborListStatistics::getFindInterquartileRange() const
+{
+  return m_FindInterquartileRange;
+}
+
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setUseApproximateQuantiles(bool value)
+{
+  m_UseApproximateQuantiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindNeighborListStatistics::getUseApproximateQuantiles() const
+{
+  return m_UseApproximateQuantiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setSketchCompression(double value)
+{
+  m_SketchCompression = value;
+}
+
+// -----------------------------------------------------------------------------
+double FindNeighborListStatistics::getSketchCompression() const
+{
+  return m_SketchCompression;
+}
+
 // -----------------------------------------------------------------------------
 void FindNeighborListStatistics::setDestinationAttributeMatrix(const DataArrayPath& value)
 {
@@ -608,6 +771,30 @@ QString FindNeighborListStatistics::getSummationArrayName() const
   return m_SummationArrayName;
 }
 
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setPercentilesArrayName(const QString& value)
+{
+  m_PercentilesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindNeighborListStatistics::getPercentilesArrayName() const
+{
+  return m_PercentilesArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindNeighborListStatistics::setInterquartileRangeArrayName(const QString& value)
+{
+  m_InterquartileRangeArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindNeighborListStatistics::getInterquartileRangeArrayName() const
+{
+  return m_InterquartileRangeArrayName;
+}
+
 // -----------------------------------------------------------------------------
 void FindNeighborListStatistics::setSelectedArrayPath(const DataArrayPath& value)
 {
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -45,6 +46,11 @@ class DREAM3DReview_EXPORT FindNeighborListStatistics : public AbstractFilter
   PYB11_PROPERTY(bool FindMedian READ getFindMedian WRITE setFindMedian)
   PYB11_PROPERTY(bool FindStdDeviation READ getFindStdDeviation WRITE setFindStdDeviation)
   PYB11_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
+  PYB11_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+  PYB11_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+  PYB11_PROPERTY(bool FindInterquartileRange READ getFindInterquartileRange WRITE setFindInterquartileRange)
+  PYB11_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
+  PYB11_PROPERTY(double SketchCompression READ getSketchCompression WRITE setSketchCompression)
 
   PYB11_PROPERTY(DataArrayPath DestinationAttributeMatrix READ getDestinationAttributeMatrix WRITE setDestinationAttributeMatrix)
 
@@ -55,6 +61,8 @@ class DREAM3DReview_EXPORT FindNeighborListStatistics : public AbstractFilter
   PYB11_PROPERTY(QString MedianArrayName READ getMedianArrayName WRITE setMedianArrayName)
   PYB11_PROPERTY(QString StdDeviationArrayName READ getStdDeviationArrayName WRITE setStdDeviationArrayName)
   PYB11_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
+  PYB11_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
+  PYB11_PROPERTY(QString InterquartileRangeArrayName READ getInterquartileRangeArrayName WRITE setInterquartileRangeArrayName)
 
   PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
 
@@ -159,6 +167,61 @@ public:
   bool getFindSummation() const;
   Q_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
 
+  /**
+   * @brief Setter property for FindPercentiles
+   */
+  void setFindPercentiles(bool value);
+  /**
+   * @brief Getter property for FindPercentiles
+   * @return Value of FindPercentiles
+   */
+  bool getFindPercentiles() const;
+  Q_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+
+  /**
+   * @brief Setter property for Percentiles
+   */
+  void setPercentiles(const QString& value);
+  /**
+   * @brief Getter property for Percentiles
+   * @return Value of Percentiles
+   */
+  QString getPercentiles() const;
+  Q_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+
+  /**
+   * @brief Setter property for FindInterquartileRange
+   */
+  void setFindInterquartileRange(bool value);
+  /**
+   * @brief Getter property for FindInterquartileRange
+   * @return Value of FindInterquartileRange
+   */
+  bool getFindInterquartileRange() const;
+  Q_PROPERTY(bool FindInterquartileRange READ getFindInterquartileRange WRITE setFindInterquartileRange)
+
+  /**
+   * @brief Setter property for UseApproximateQuantiles
+   */
+  void setUseApproximateQuantiles(bool value);
+  /**
+   * @brief Getter property for UseApproximateQuantiles
+   * @return Value of UseApproximateQuantiles
+   */
+  bool getUseApproximateQuantiles() const;
+  Q_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
+
+  /**
+   * @brief Setter property for SketchCompression
+   */
+  void setSketchCompression(double value);
+  /**
+   * @brief Getter property for SketchCompression
+   * @return Value of SketchCompression
+   */
+  double getSketchCompression() const;
+  Q_PROPERTY(double SketchCompression READ getSketchCompression WRITE setSketchCompression)
+
   /**
    * @brief Setter property for DestinationAttributeMatrix
    */
@@ -247,6 +310,28 @@ public:
   QString getSummationArrayName() const;
   Q_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
 
+  /**
+   * @brief Setter property for PercentilesArrayName
+   */
+  void setPercentilesArrayName(const QString& value);
+  /**
+   * @brief Getter property for PercentilesArrayName
+   * @return Value of PercentilesArrayName
+   */
+  QString getPercentilesArrayName() const;
+  Q_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
+
+  /**
+   * @brief Setter property for InterquartileRangeArrayName
+   */
+  void setInterquartileRangeArrayName(const QString& value);
+  /**
+   * @brief Getter property for InterquartileRangeArrayName
+   * @return Value of InterquartileRangeArrayName
+   */
+  QString getInterquartileRangeArrayName() const;
+  Q_PROPERTY(QString InterquartileRangeArrayName READ getInterquartileRangeArrayName WRITE setInterquartileRangeArrayName)
+
   /**
    * @brief Setter property for SelectedArrayPath
    */
@@ -322,6 +407,12 @@ protected:
   template <typename T>
   void createCompatibleArrays(QVector<DataArrayPath>& dataArrayPaths);
 
+  /**
+   * @brief createQuantileArrays Creates the percentile and interquartile range arrays
+   * @param errorCode First of the three error codes used for invalid quantile options
+   */
+  void createQuantileArrays(int32_t errorCode);
+
   FindNeighborListStatistics();
 
   /**
@@ -344,6 +435,8 @@ private:
   std::weak_ptr<FloatArrayType> m_MedianPtr;
   std::weak_ptr<FloatArrayType> m_StandardDeviationPtr;
   std::weak_ptr<FloatArrayType> m_SummationPtr;
+  std::weak_ptr<FloatArrayType> m_PercentilesPtr;
+  std::weak_ptr<FloatArrayType> m_InterquartileRangePtr;
 
   DataArrayPath m_DestinationAttributeMatrix = {"", "", ""};
 
@@ -354,6 +447,12 @@ private:
   bool m_FindMedian = false;
   bool m_FindStdDeviation = false;
   bool m_FindSummation = false;
+  bool m_FindPercentiles = false;
+  QString m_Percentiles = {"5, 25, 75, 95"};
+  std::vector<double> m_PercentileFractions;
+  bool m_FindInterquartileRange = false;
+  bool m_UseApproximateQuantiles = false;
+  double m_SketchCompression = {100.0};
 
   QString m_LengthArrayName = {"Length"};
   QString m_MinimumArrayName = {"Minimum"};
@@ -362,6 +461,8 @@ private:
   QString m_MedianArrayName = {"Median"};
   QString m_StdDeviationArrayName = {"StandardDeviation"};
   QString m_SummationArrayName = {"Summation"};
+  QString m_PercentilesArrayName = {"Percentiles"};
+  QString m_InterquartileRangeArrayName = {"InterquartileRange"};
 
   DataArrayPath m_SelectedArrayPath = {};
 
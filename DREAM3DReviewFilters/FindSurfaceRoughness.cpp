@@ -14,20 +14,24 @@
 
 #include "FindSurfaceRoughness.h"
 
+#include <algorithm>
 #include <cmath>
-#include <cstring>
 
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SurfaceRoughness.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -62,6 +66,17 @@ void FindSurfaceRoughness::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Boundary Cells", BoundaryCellsArrayPath, FilterParameter::Category::RequiredArray, FindSurfaceRoughness, dasReq));
   parameters.push_back(SIMPL_NEW_STRING_FP("Roughness Attribute Matrix", AttributeMatrixName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
   parameters.push_back(SIMPL_NEW_STRING_FP("Roughness Parameters", RoughnessParamsArrayName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
+  std::vector<QString> linkedProps = {"FeatureIdsArrayPath", "FeatureRoughnessArrayPath"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Feature Roughness", ComputeFeatureRoughness, FilterParameter::Category::Parameter, FindSurfaceRoughness, linkedProps));
+  dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::Category::RequiredArray, FindSurfaceRoughness, dasReq));
+  DataArrayCreationFilterParameter::RequirementType dacReq = DataArrayCreationFilterParameter::CreateRequirement(AttributeMatrix::Type::CellFeature, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Feature Roughness", FeatureRoughnessArrayPath, FilterParameter::Category::CreatedArray, FindSurfaceRoughness, dacReq));
+  linkedProps = {"WindowSize", "WindowAttributeMatrixName", "WindowRoughnessArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compute Windowed Roughness", ComputeWindowedRoughness, FilterParameter::Category::Parameter, FindSurfaceRoughness, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Window Size (Planes)", WindowSize, FilterParameter::Category::Parameter, FindSurfaceRoughness));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Window Attribute Matrix", WindowAttributeMatrixName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Window Roughness", WindowRoughnessArrayName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
   setFilterParameters(parameters);
 }
 
@@ -106,6 +121,41 @@ void FindSurfaceRoughness::dataCheck()
   {
     m_RoughnessParams = m_RoughnessParamsPtr.lock()->getPointer(0);
   }
+
+  if(getComputeFeatureRoughness())
+  {
+    std::vector<DataArrayPath> cellPaths = {getBoundaryCellsArrayPath(), getFeatureIdsArrayPath()};
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeatureIdsArrayPath(), std::vector<size_t>(1, 1));
+    if(nullptr != m_FeatureIdsPtr.lock())
+    {
+      m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0);
+    }
+    getDataContainerArray()->validateNumberOfTuples(this, cellPaths);
+
+    m_FeatureRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, getFeatureRoughnessArrayPath(), 0, cDims);
+    if(nullptr != m_FeatureRoughnessPtr.lock())
+    {
+      m_FeatureRoughness = m_FeatureRoughnessPtr.lock()->getPointer(0);
+    }
+  }
+
+  if(getComputeWindowedRoughness())
+  {
+    if(getWindowSize() < 1 || getWindowSize() % 2 == 0)
+    {
+      QString ss = QObject::tr("The window size must be a positive odd number of planes, but it is %1").arg(getWindowSize());
+      setErrorCondition(-11002, ss);
+      return;
+    }
+
+    dc->createNonPrereqAttributeMatrix(this, getWindowAttributeMatrixName(), std::vector<size_t>(1, image->getZPoints()), AttributeMatrix::Type::CellFeature);
+    path.update(getBoundaryCellsArrayPath().getDataContainerName(), getWindowAttributeMatrixName(), getWindowRoughnessArrayName());
+    m_WindowRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+    if(nullptr != m_WindowRoughnessPtr.lock())
+    {
+      m_WindowRoughness = m_WindowRoughnessPtr.lock()->getPointer(0);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -122,69 +172,60 @@ void FindSurfaceRoughness::execute()
 
   ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(m_BoundaryCellsArrayPath.getDataContainerName())->getGeometryAs<ImageGeom>();
   SizeVec3Type dims = image->getDimensions();
-  // FloatVec3Type res = image->getSpacing();
-  std::vector<double> xs;
-  std::vector<double> ys;
-  double coords[3] = {0.0, 0.0, 0.0};
+  FloatVec3Type origin = image->getOrigin();
+  FloatVec3Type spacing = image->getSpacing();
 
-  for(size_t z = 0; z < dims[2]; z++)
+  SurfaceRoughness::Image input;
+  for(size_t a = 0; a < 3; a++)
   {
-    size_t zStride = (z * dims[1] * dims[0]);
-    for(size_t y = 0; y < dims[1]; y++)
+    input.dims[a] = dims[a];
+    input.origin[a] = origin[a];
+    input.spacing[a] = spacing[a];
+  }
+  input.boundaryCells = m_BoundaryCells;
+
+  if(getComputeFeatureRoughness())
+  {
+    input.featureIds = m_FeatureIds;
+    input.numFeatures = m_FeatureRoughnessPtr.lock()->getNumberOfTuples();
+    size_t numCells = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+    int32_t maxFeatureId = numCells > 0 ? *std::max_element(m_FeatureIds, m_FeatureIds + numCells) : 0;
+    if(maxFeatureId >= 0 && static_cast<size_t>(maxFeatureId) >= input.numFeatures)
     {
-      size_t yStride = (y * dims[0]);
-      for(size_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = zStride + yStride + x;
-        if(m_BoundaryCells[index] > 0)
-        {
-          image->getCoords(index, coords);
-          xs.push_back(coords[0]);
-          ys.push_back(coords[1]);
-        }
-      }
+      QString ss = QObject::tr("The largest Feature Id (%1) does not fit the %2 tuples of the Attribute Matrix of the Feature Roughness array").arg(maxFeatureId).arg(input.numFeatures);
+      setErrorCondition(-11003, ss);
+      return;
     }
   }
+  if(getComputeWindowedRoughness())
+  {
+    input.windows = true;
+    input.windowHalfWidth = static_cast<size_t>(getWindowSize() / 2);
+  }
 
-  using LineParams = std::pair<double, double>;
-
-  auto linear_regression_slope = [&]() -> LineParams {
-    double xmean = std::accumulate(std::begin(xs), std::end(xs), 0.0);
-    double ymean = std::accumulate(std::begin(ys), std::end(ys), 0.0);
-    xmean /= xs.size();
-    ymean /= ys.size();
-
-    std::vector<double> xx;
-    std::transform(std::begin(xs), std::end(xs), std::begin(xs), std::back_inserter(xx), std::multiplies<double>());
-    double sumxx = std::accumulate(std::begin(xx), std::end(xx), 0.0);
-    double ssxx = sumxx - (xx.size() * xmean * xmean);
-
-    std::vector<double> xy;
-    std::transform(std::begin(xs), std::end(xs), std::begin(ys), std::back_inserter(xy), std::multiplies<double>());
-    double sumxy = std::accumulate(std::begin(xy), std::end(xy), 0.0);
-    double ssxy = sumxy - (xy.size() * xmean * ymean);
-
-    double b = ssxy / ssxx;
-    double a = ymean - (b * xmean);
-
-    return std::make_pair(a, b);
-  };
-
-  LineParams line = linear_regression_slope();
-  m_RoughnessParams[1] = line.first;
-  m_RoughnessParams[2] = line.second;
-
-  double distance = 0.0;
-  for(auto i = 0; i < xs.size(); i++)
+  // The lines are fitted in one pass and the distances to them measured in a second
+  SurfaceRoughness::GroupSums<SurfaceRoughness::LineFit> fits = SurfaceRoughness::fitLines(input);
+  if(getCancel())
   {
-    double numerator = std::abs(ys[i] - (line.first + (line.second * xs[i])));
-    double denominator = std::sqrt(1 + (line.second * line.second));
-    distance += (numerator / denominator);
+    return;
   }
+  SurfaceRoughness::GroupSums<SurfaceRoughness::Profile> profiles = SurfaceRoughness::measureProfiles(input, fits);
 
-  distance /= static_cast<double>(xs.size());
+  double imageRoughness[3] = {0.0, 0.0, 0.0};
+  profiles.total().write(imageRoughness);
+  SurfaceRoughness::LineFit imageFit = fits.total();
+  m_RoughnessParams[0] = imageRoughness[0];
+  m_RoughnessParams[1] = imageFit.intercept();
+  m_RoughnessParams[2] = imageFit.slope();
 
-  m_RoughnessParams[0] = distance;
+  for(size_t f = 0; f < profiles.features.size(); f++)
+  {
+    profiles.features[f].write(m_FeatureRoughness + 3 * f);
+  }
+  for(size_t w = 0; w < profiles.windows.size(); w++)
+  {
+    profiles.windows[w].write(m_WindowRoughness + 3 * w);
+  }
 
   notifyStatusMessage("Complete");
 }
@@ -325,3 +366,87 @@ QString FindSurfaceRoughness::getRoughnessParamsArrayName() const
 {
   return m_RoughnessParamsArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setComputeFeatureRoughness(bool value)
+{
+  m_ComputeFeatureRoughness = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindSurfaceRoughness::getComputeFeatureRoughness() const
+{
+  return m_ComputeFeatureRoughness;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setFeatureIdsArrayPath(const DataArrayPath& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindSurfaceRoughness::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setFeatureRoughnessArrayPath(const DataArrayPath& value)
+{
+  m_FeatureRoughnessArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindSurfaceRoughness::getFeatureRoughnessArrayPath() const
+{
+  return m_FeatureRoughnessArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setComputeWindowedRoughness(bool value)
+{
+  m_ComputeWindowedRoughness = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindSurfaceRoughness::getComputeWindowedRoughness() const
+{
+  return m_ComputeWindowedRoughness;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setWindowSize(int value)
+{
+  m_WindowSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int FindSurfaceRoughness::getWindowSize() const
+{
+  return m_WindowSize;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setWindowAttributeMatrixName(const QString& value)
+{
+  m_WindowAttributeMatrixName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindSurfaceRoughness::getWindowAttributeMatrixName() const
+{
+  return m_WindowAttributeMatrixName;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setWindowRoughnessArrayName(const QString& value)
+{
+  m_WindowRoughnessArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindSurfaceRoughness::getWindowRoughnessArrayName() const
+{
+  return m_WindowRoughnessArrayName;
+}
@@ -83,6 +83,83 @@ public:
   QString getRoughnessParamsArrayName() const;
   Q_PROPERTY(QString RoughnessParamsArrayName READ getRoughnessParamsArrayName WRITE setRoughnessParamsArrayName)
 
+  /**
+   * @brief Setter property for ComputeFeatureRoughness
+   */
+  void setComputeFeatureRoughness(bool value);
+  /**
+   * @brief Getter property for ComputeFeatureRoughness
+   * @return Value of ComputeFeatureRoughness
+   */
+  bool getComputeFeatureRoughness() const;
+  Q_PROPERTY(bool ComputeFeatureRoughness READ getComputeFeatureRoughness WRITE setComputeFeatureRoughness)
+
+  /**
+   * @brief Setter property for FeatureIdsArrayPath
+   */
+  void setFeatureIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureIdsArrayPath
+   * @return Value of FeatureIdsArrayPath
+   */
+  DataArrayPath getFeatureIdsArrayPath() const;
+  Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+  /**
+   * @brief Setter property for FeatureRoughnessArrayPath
+   */
+  void setFeatureRoughnessArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureRoughnessArrayPath
+   * @return Value of FeatureRoughnessArrayPath
+   */
+  DataArrayPath getFeatureRoughnessArrayPath() const;
+  Q_PROPERTY(DataArrayPath FeatureRoughnessArrayPath READ getFeatureRoughnessArrayPath WRITE setFeatureRoughnessArrayPath)
+
+  /**
+   * @brief Setter property for ComputeWindowedRoughness
+   */
+  void setComputeWindowedRoughness(bool value);
+  /**
+   * @brief Getter property for ComputeWindowedRoughness
+   * @return Value of ComputeWindowedRoughness
+   */
+  bool getComputeWindowedRoughness() const;
+  Q_PROPERTY(bool ComputeWindowedRoughness READ getComputeWindowedRoughness WRITE setComputeWindowedRoughness)
+
+  /**
+   * @brief Setter property for WindowSize
+   */
+  void setWindowSize(int value);
+  /**
+   * @brief Getter property for WindowSize
+   * @return Value of WindowSize
+   */
+  int getWindowSize() const;
+  Q_PROPERTY(int WindowSize READ getWindowSize WRITE setWindowSize)
+
+  /**
+   * @brief Setter property for WindowAttributeMatrixName
+   */
+  void setWindowAttributeMatrixName(const QString& value);
+  /**
+   * @brief Getter property for WindowAttributeMatrixName
+   * @return Value of WindowAttributeMatrixName
+   */
+  QString getWindowAttributeMatrixName() const;
+  Q_PROPERTY(QString WindowAttributeMatrixName READ getWindowAttributeMatrixName WRITE setWindowAttributeMatrixName)
+
+  /**
+   * @brief Setter property for WindowRoughnessArrayName
+   */
+  void setWindowRoughnessArrayName(const QString& value);
+  /**
+   * @brief Getter property for WindowRoughnessArrayName
+   * @return Value of WindowRoughnessArrayName
+   */
+  QString getWindowRoughnessArrayName() const;
+  Q_PROPERTY(QString WindowRoughnessArrayName READ getWindowRoughnessArrayName WRITE setWindowRoughnessArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -156,10 +233,23 @@ private:
   int8_t* m_BoundaryCells = nullptr;
   std::weak_ptr<DataArray<double>> m_RoughnessParamsPtr;
   double* m_RoughnessParams = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
+  int32_t* m_FeatureIds = nullptr;
+  std::weak_ptr<DataArray<double>> m_FeatureRoughnessPtr;
+  double* m_FeatureRoughness = nullptr;
+  std::weak_ptr<DataArray<double>> m_WindowRoughnessPtr;
+  double* m_WindowRoughness = nullptr;
 
   DataArrayPath m_BoundaryCellsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::BoundaryCells};
   QString m_AttributeMatrixName = {"RoughnessData"};
   QString m_RoughnessParamsArrayName = {"RougnessParameters"};
+  bool m_ComputeFeatureRoughness = {false};
+  DataArrayPath m_FeatureIdsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds};
+  DataArrayPath m_FeatureRoughnessArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, "Roughness"};
+  bool m_ComputeWindowedRoughness = {false};
+  int m_WindowSize = {5};
+  QString m_WindowAttributeMatrixName = {"RoughnessWindowData"};
+  QString m_WindowRoughnessArrayName = {"WindowRoughness"};
 
 public:
   FindSurfaceRoughness(const FindSurfaceRoughness&) = delete;            // Copy Constructor Not Implemented
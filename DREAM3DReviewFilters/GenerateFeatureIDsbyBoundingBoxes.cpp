@@ -4,7 +4,10 @@
 
 #include "GenerateFeatureIDsbyBoundingBoxes.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -14,15 +17,19 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ShapeRasterization.hpp"
 
 namespace
 {
 constexpr int32_t k_AttributeMatrixTypeSelectionError = -5555;
+constexpr int32_t k_ElementCountMismatchError = -5556;
 
 }
 
@@ -66,7 +73,7 @@ void GenerateFeatureIDsbyBoundingBoxes::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   DataArrayCreationFilterParameter::RequirementType dacReq;
-  dacReq.amTypes = {AttributeMatrix::Type::Vertex, AttributeMatrix::Type::Cell};
+  dacReq.amTypes = {AttributeMatrix::Type::Vertex, AttributeMatrix::Type::Edge, AttributeMatrix::Type::Cell};
   parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Feature IDs", FeatureIDsArrayPath, FilterParameter::Category::CreatedArray, GenerateFeatureIDsbyBoundingBoxes, dacReq));
   AttributeMatrixCreationFilterParameter::RequirementType amcReq;
   parameters.push_back(SIMPL_NEW_AM_CREATION_FP("Feature Attribute Matrix", FeatureAttributeMatrixArrayPath, FilterParameter::Category::CreatedArray, GenerateFeatureIDsbyBoundingBoxes, amcReq));
@@ -101,26 +108,54 @@ void GenerateFeatureIDsbyBoundingBoxes::dataCheck()
   m_DestAttributeMatrixType = AttributeMatrix::Type::Unknown;
   AttributeMatrix::Type attrMatType = attrMat->getType();
 
+  // The geometry is read unchecked during execute, so it must match the Attribute Matrix type
+  // and have one element per tuple
+  size_t numElements = 0;
   if(attrMatType == AttributeMatrix::Type::Vertex)
   {
     m_DestAttributeMatrixType = AttributeMatrix::Type::VertexFeature;
+    VertexGeom::Pointer vertex = getDataContainerArray()->getPrereqGeometryFromDataContainer<VertexGeom>(this, getFeatureIDsArrayPath().getDataContainerName());
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    numElements = vertex->getNumberOfVertices();
   }
   else if(attrMatType == AttributeMatrix::Type::Cell)
   {
     m_DestAttributeMatrixType = AttributeMatrix::Type::CellFeature;
+    ImageGeom::Pointer image = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom>(this, getFeatureIDsArrayPath().getDataContainerName());
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    numElements = image->getNumberOfElements();
+  }
+  else if(attrMatType == AttributeMatrix::Type::Edge)
+  {
+    m_DestAttributeMatrixType = AttributeMatrix::Type::EdgeFeature;
+    EdgeGeom::Pointer edgeGeom = getDataContainerArray()->getPrereqGeometryFromDataContainer<EdgeGeom>(this, getFeatureIDsArrayPath().getDataContainerName());
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    numElements = edgeGeom->getNumberOfEdges();
   }
-  // else if (attrMatType == AttributeMatrix::Type::Edge)
-  //{
-  //  m_DestAttributeMatrixType = AttributeMatrix::Type::EdgeFeature;
-  //}
   else
   {
     m_DestAttributeMatrixType = AttributeMatrix::Type::Unknown;
-    QString ss = QObject::tr("The Attribute Matrix must have a cell, vertex geometry.");
+    QString ss = QObject::tr("The Attribute Matrix must have a cell, vertex or edge geometry.");
     setErrorCondition(::k_AttributeMatrixTypeSelectionError, ss);
     return;
   }
 
+  if(attrMat->getNumberOfTuples() != numElements)
+  {
+    QString ss = QObject::tr("The Attribute Matrix '%1' has %2 tuples, but its geometry has %3 elements").arg(attrMat->getName()).arg(attrMat->getNumberOfTuples()).arg(numElements);
+    setErrorCondition(::k_ElementCountMismatchError, ss);
+    return;
+  }
+
   std::vector<size_t> cDims = {1};
   m_BoxFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getBoxFeatureIDsArrayPath(), cDims);
   if(nullptr != m_BoxFeatureIdsPtr.lock())
@@ -169,70 +204,333 @@ bool IsPointInBounds(float xmax, float xmin, float ymax, float ymin, float zmax,
   return (x < xmax) && (x > xmin) && (y < ymax) && (y > ymin) && (z < zmax) && (z > zmin);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxImage()
+namespace
 {
-  size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
-  size_t totalNumElementsDest = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
-  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
-  SizeVec3Type udims = image->getDimensions();
-  FloatVec3Type uorigin = image->getOrigin();
-  FloatVec3Type uspacing = image->getSpacing();
+/**
+ * @brief Axis aligned boxes given by their centers and dimensions. A point is inside a
+ * box if it lies strictly between the box bounds.
+ */
+class BoundingBoxes
+{
+public:
+  BoundingBoxes(const float* centers, const float* dims, size_t numBoxes)
+  : m_Lo(numBoxes)
+  , m_Hi(numBoxes)
+  {
+    for(size_t k = 0; k < numBoxes; k++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        m_Lo[k][a] = centers[3 * k + a] - dims[3 * k + a] / 2.0;
+        m_Hi[k][a] = centers[3 * k + a] + dims[3 * k + a] / 2.0;
+      }
+    }
+  }
 
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
+  size_t size() const
+  {
+    return m_Lo.size();
+  }
 
-  std::array<float, 3> origin = {
-      static_cast<float>(uorigin[0]),
-      static_cast<float>(uorigin[1]),
-      static_cast<float>(uorigin[2]),
-  };
+  void bounds(size_t k, std::array<float, 3>& lo, std::array<float, 3>& hi) const
+  {
+    lo = m_Lo[k];
+    hi = m_Hi[k];
+  }
 
-  std::array<float, 3> spacing = {
-      static_cast<float>(uspacing[0]),
-      static_cast<float>(uspacing[1]),
-      static_cast<float>(uspacing[2]),
-  };
+  bool contains(size_t k, float x, float y, float z) const
+  {
+    return IsPointInBounds(m_Hi[k][0], m_Lo[k][0], m_Hi[k][1], m_Lo[k][1], m_Hi[k][2], m_Lo[k][2], x, y, z);
+  }
+
+private:
+  std::vector<std::array<float, 3>> m_Lo;
+  std::vector<std::array<float, 3>> m_Hi;
+};
+
+/**
+ * @brief Presents the boxes in reverse order. The rasterizer writes every voxel in
+ * ascending shape order, so with the order reversed the lowest numbered box that
+ * contains a voxel is the last to write it.
+ */
+class ReversedBoxes
+{
+public:
+  explicit ReversedBoxes(const BoundingBoxes& boxes)
+  : m_Boxes(boxes)
+  {
+  }
+
+  size_t boxOf(size_t shape) const
+  {
+    return m_Boxes.size() - 1 - shape;
+  }
+
+  void bounds(size_t shape, std::array<float, 3>& lo, std::array<float, 3>& hi) const
+  {
+    m_Boxes.bounds(boxOf(shape), lo, hi);
+  }
 
-  for(size_t i = 0; i < totalNumElementsDest; i++)
+  bool contains(size_t shape, float x, float y, float z) const
   {
-    int64_t zindex = i / (dims[0] * dims[1]);
-    int64_t tempMod = i % (dims[0] * dims[1]);
-    int64_t yindex = tempMod / (dims[0]);
-    int64_t xindex = tempMod % (dims[0]);
+    return m_Boxes.contains(boxOf(shape), x, y, z);
+  }
+
+private:
+  const BoundingBoxes& m_Boxes;
+};
 
-    float currentx = origin[0] + spacing[0] * xindex;
-    float currenty = origin[1] + spacing[1] * yindex;
-    float currentz = origin[2] + spacing[2] * zindex;
+/**
+ * @brief Bounding volume hierarchy over the boxes for point queries. The boxes are split
+ * at the median of their centers along the widest axis until at most k_MaxLeafSize boxes
+ * remain, and every node keeps the union of its boxes and the lowest box number below it.
+ * A query descends into the child with the lower box number first and skips every node
+ * that cannot hold a box numbered below the best one found, so large and overlapping
+ * boxes do not have to be scanned one by one.
+ */
+class BoxIndex
+{
+public:
+  static constexpr size_t k_MaxLeafSize = 4;
 
-    bool inBounds = false;
-    size_t k = 0;
+  explicit BoxIndex(const BoundingBoxes& boxes)
+  : m_Boxes(boxes)
+  {
+    std::array<float, 3> lo = {0.0f, 0.0f, 0.0f};
+    std::array<float, 3> hi = {0.0f, 0.0f, 0.0f};
+    std::vector<std::array<float, 3>> centers(boxes.size());
+    for(size_t k = 0; k < boxes.size(); k++)
+    {
+      boxes.bounds(k, lo, hi);
+      if(!isValid(lo, hi))
+      {
+        continue;
+      }
+      for(size_t a = 0; a < 3; a++)
+      {
+        centers[k][a] = 0.5f * (lo[a] + hi[a]);
+      }
+      m_Items.push_back(k);
+    }
+    if(m_Items.empty())
+    {
+      return;
+    }
 
-    while(!inBounds && k < totalNumFIDs)
+    // Nodes are built top down; the children of an inner node are stored next to each other
+    struct Pending
     {
-      float xmin = m_BoxCenter[3 * k] - m_BoxDims[3 * k] / 2.0;
-      float xmax = m_BoxCenter[3 * k] + m_BoxDims[3 * k] / 2.0;
-      float ymin = m_BoxCenter[3 * k + 1] - m_BoxDims[3 * k + 1] / 2.0;
-      float ymax = m_BoxCenter[3 * k + 1] + m_BoxDims[3 * k + 1] / 2.0;
-      float zmin = m_BoxCenter[3 * k + 2] - m_BoxDims[3 * k + 2] / 2.0;
-      float zmax = m_BoxCenter[3 * k + 2] + m_BoxDims[3 * k + 2] / 2.0;
+      size_t node;
+      size_t begin;
+      size_t end;
+    };
+    std::vector<Pending> pending = {{0, 0, m_Items.size()}};
+    m_Nodes.reserve(2 * (m_Items.size() / k_MaxLeafSize + 1));
+    m_Nodes.emplace_back();
+    while(!pending.empty())
+    {
+      Pending current = pending.back();
+      pending.pop_back();
+
+      Node node;
+      std::array<float, 3> centerMin = centers[m_Items[current.begin]];
+      std::array<float, 3> centerMax = centerMin;
+      node.minBox = m_Items[current.begin];
+      boxes.bounds(m_Items[current.begin], node.lo, node.hi);
+      for(size_t i = current.begin; i < current.end; i++)
+      {
+        size_t k = m_Items[i];
+        boxes.bounds(k, lo, hi);
+        for(size_t a = 0; a < 3; a++)
+        {
+          node.lo[a] = std::min(node.lo[a], lo[a]);
+          node.hi[a] = std::max(node.hi[a], hi[a]);
+          centerMin[a] = std::min(centerMin[a], centers[k][a]);
+          centerMax[a] = std::max(centerMax[a], centers[k][a]);
+        }
+        node.minBox = std::min(node.minBox, k);
+      }
+
+      if(current.end - current.begin <= k_MaxLeafSize)
+      {
+        // Leaf boxes in ascending order, so a query stops at the first one that contains the point
+        std::sort(m_Items.begin() + current.begin, m_Items.begin() + current.end);
+        node.first = current.begin;
+        node.count = current.end - current.begin;
+        m_Nodes[current.node] = node;
+        continue;
+      }
 
-      inBounds = IsPointInBounds(xmax, xmin, ymax, ymin, zmax, zmin, currentx, currenty, currentz);
+      size_t axis = 0;
+      for(size_t a = 1; a < 3; a++)
+      {
+        if(centerMax[a] - centerMin[a] > centerMax[axis] - centerMin[axis])
+        {
+          axis = a;
+        }
+      }
+      size_t mid = current.begin + (current.end - current.begin) / 2;
+      std::nth_element(m_Items.begin() + current.begin, m_Items.begin() + mid, m_Items.begin() + current.end,
+                       [&](size_t lhs, size_t rhs) { return centers[lhs][axis] < centers[rhs][axis] || (centers[lhs][axis] == centers[rhs][axis] && lhs < rhs); });
+      node.first = m_Nodes.size();
+      node.count = 0;
+      m_Nodes[current.node] = node;
+      m_Nodes.emplace_back();
+      m_Nodes.emplace_back();
+      pending.push_back({node.first, current.begin, mid});
+      pending.push_back({node.first + 1, mid, current.end});
+    }
+  }
 
-      if(inBounds)
+  /**
+   * @brief Returns the lowest numbered box that contains the point, or -1 if there is none
+   */
+  int64_t find(float x, float y, float z) const
+  {
+    if(m_Nodes.empty())
+    {
+      return -1;
+    }
+    // The median splits keep the depth below 64, so the stack never holds more than 65 nodes
+    std::array<size_t, 128> stack = {0};
+    size_t numPending = 1;
+    size_t found = m_Boxes.size();
+    while(numPending > 0)
+    {
+      const Node& node = m_Nodes[stack[--numPending]];
+      if(node.minBox >= found || !(x > node.lo[0] && x < node.hi[0] && y > node.lo[1] && y < node.hi[1] && z > node.lo[2] && z < node.hi[2]))
+      {
+        continue;
+      }
+      if(node.count > 0)
+      {
+        for(size_t i = node.first; i < node.first + node.count && m_Items[i] < found; i++)
+        {
+          if(m_Boxes.contains(m_Items[i], x, y, z))
+          {
+            found = m_Items[i];
+            break;
+          }
+        }
+        continue;
+      }
+      // The child with the lower box number is visited first
+      size_t low = node.first;
+      size_t high = node.first + 1;
+      if(m_Nodes[high].minBox < m_Nodes[low].minBox)
       {
-        m_FeatureIds[i] = m_BoxFeatureIds[k];
+        std::swap(low, high);
       }
+      stack[numPending++] = high;
+      stack[numPending++] = low;
+    }
+    return found < m_Boxes.size() ? static_cast<int64_t>(found) : -1;
+  }
+
+private:
+  /**
+   * @brief Inner nodes have count 0 and their children at first and first + 1; leaves
+   * hold the boxes m_Items[first] ... m_Items[first + count - 1]
+   */
+  struct Node
+  {
+    std::array<float, 3> lo = {0.0f, 0.0f, 0.0f};
+    std::array<float, 3> hi = {0.0f, 0.0f, 0.0f};
+    size_t minBox = 0;
+    size_t first = 0;
+    size_t count = 0;
+  };
+
+  const BoundingBoxes& m_Boxes;
+  std::vector<size_t> m_Items;
+  std::vector<Node> m_Nodes;
+
+  /**
+   * @brief A box that no point can lie strictly inside, including boxes with NaN bounds
+   */
+  static bool isValid(const std::array<float, 3>& lo, const std::array<float, 3>& hi)
+  {
+    return lo[0] < hi[0] && lo[1] < hi[1] && lo[2] < hi[2];
+  }
+};
+
+/**
+ * @brief Assigns every point in a range the feature id of the lowest numbered box that
+ * contains it; points outside all boxes keep their value
+ */
+template <typename PointFunc>
+class LabelPointsImpl
+{
+public:
+  LabelPointsImpl(const PointFunc& points, const BoxIndex& index, const int32_t* boxFeatureIds, int32_t* featureIds)
+  : m_Points(points)
+  , m_Index(index)
+  , m_BoxFeatureIds(boxFeatureIds)
+  , m_FeatureIds(featureIds)
+  {
+  }
 
-      k++;
+  void operator()(const SIMPLRange& range) const
+  {
+    std::array<float, 3> p = {0.0f, 0.0f, 0.0f};
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Points(i, p);
+      int64_t box = m_Index.find(p[0], p[1], p[2]);
+      if(box >= 0)
+      {
+        m_FeatureIds[i] = m_BoxFeatureIds[box];
+      }
     }
   }
+
+private:
+  const PointFunc& m_Points;
+  const BoxIndex& m_Index;
+  const int32_t* m_BoxFeatureIds = nullptr;
+  int32_t* m_FeatureIds = nullptr;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PointFunc>
+void labelPoints(const PointFunc& points, size_t numPoints, const BoundingBoxes& boxes, const int32_t* boxFeatureIds, int32_t* featureIds)
+{
+  BoxIndex index(boxes);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(LabelPointsImpl<PointFunc>(points, index, boxFeatureIds, featureIds));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxImage()
+{
+  size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  SizeVec3Type udims = image->getDimensions();
+  FloatVec3Type uorigin = image->getOrigin();
+  FloatVec3Type uspacing = image->getSpacing();
+
+  ShapeRasterization::Grid grid;
+  for(size_t a = 0; a < 3; a++)
+  {
+    grid.dims[a] = static_cast<int64_t>(udims[a]);
+    grid.origin[a] = static_cast<float>(uorigin[a]);
+    grid.spacing[a] = static_cast<float>(uspacing[a]);
+  }
+
+  // Only the cells inside each box's bounds are visited; overlapping boxes are written
+  // from the highest to the lowest numbered, so the lowest numbered box wins
+  BoundingBoxes boxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
+  ReversedBoxes reversed(boxes);
+  int32_t* featureIds = m_FeatureIds;
+  const int32_t* boxFeatureIds = m_BoxFeatureIds;
+  ShapeRasterization::rasterize(totalNumFIDs, reversed, grid, [&](size_t shape, size_t cell) { featureIds[cell] = boxFeatureIds[reversed.boxOf(shape)]; });
 }
 
 // -----------------------------------------------------------------------------
@@ -242,13 +540,21 @@ void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxEdge()
 {
   size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalNumElementsDest = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
+  EdgeGeom::Pointer edgeGeom = dc->getGeometryAs<EdgeGeom>();
 
-  for(size_t i = 0; i < totalNumElementsDest; i++)
-  {
-    for(size_t k = 0; k < totalNumFIDs; k++)
+  // An edge belongs to the box that contains its midpoint
+  const float* vertices = edgeGeom->getVertexPointer(0);
+  const MeshIndexType* edges = edgeGeom->getEdgePointer(0);
+  const auto midpoint = [vertices, edges](size_t i, std::array<float, 3>& p) {
+    for(size_t a = 0; a < 3; a++)
     {
+      p[a] = 0.5f * (vertices[3 * edges[2 * i] + a] + vertices[3 * edges[2 * i + 1] + a]);
     }
-  }
+  };
+
+  BoundingBoxes boxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
+  labelPoints(midpoint, totalNumElementsDest, boxes, m_BoxFeatureIds, m_FeatureIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -261,34 +567,11 @@ void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxVertex()
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
   VertexGeom::Pointer vertex = dc->getGeometryAs<VertexGeom>();
 
-  float* vertices = vertex->getVertexPointer(0);
-  for(size_t i = 0; i < totalNumElementsDest; i++)
-  {
-    bool inBounds = false;
-    size_t k = 0;
-    float currentx = vertices[3 * i];
-    float currenty = vertices[3 * i + 1];
-    float currentz = vertices[3 * i + 2];
-
-    while(!inBounds && k < totalNumFIDs)
-    {
-      float xmin = m_BoxCenter[3 * k] - m_BoxDims[3 * k] / 2.0;
-      float xmax = m_BoxCenter[3 * k] + m_BoxDims[3 * k] / 2.0;
-      float ymin = m_BoxCenter[3 * k + 1] - m_BoxDims[3 * k + 1] / 2.0;
-      float ymax = m_BoxCenter[3 * k + 1] + m_BoxDims[3 * k + 1] / 2.0;
-      float zmin = m_BoxCenter[3 * k + 2] - m_BoxDims[3 * k + 2] / 2.0;
-      float zmax = m_BoxCenter[3 * k + 2] + m_BoxDims[3 * k + 2] / 2.0;
-
-      inBounds = IsPointInBounds(xmax, xmin, ymax, ymin, zmax, zmin, currentx, currenty, currentz);
-
-      if(inBounds)
-      {
-        m_FeatureIds[i] = m_BoxFeatureIds[k];
-      }
+  const float* vertices = vertex->getVertexPointer(0);
+  const auto position = [vertices](size_t i, std::array<float, 3>& p) { p = {vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2]}; };
 
-      k++;
-    }
-  }
+  BoundingBoxes boxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
+  labelPoints(position, totalNumElementsDest, boxes, m_BoxFeatureIds, m_FeatureIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -316,10 +599,10 @@ void GenerateFeatureIDsbyBoundingBoxes::execute()
   {
     checkBoundingBoxVertex();
   }
-  // else if(m_DestAttributeMatrixType == AttributeMatrix::Type::EdgeFeature)
-  // {
-  //   checkBoundingBoxEdge();
-  // }
+  else if(m_DestAttributeMatrixType == AttributeMatrix::Type::EdgeFeature)
+  {
+    checkBoundingBoxEdge();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -182,17 +182,17 @@ protected:
   void initialize();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief Assigns the cells of the Image Geometry, visiting only the cells inside each box
    */
   void checkBoundingBoxImage();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief Assigns the edges of the Edge Geometry by their midpoints
    */
   void checkBoundingBoxEdge();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief Assigns the vertices of the Vertex Geometry
    */
   void checkBoundingBoxVertex();
 
@@ -13,12 +13,16 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ShapeRasterization.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -80,6 +84,9 @@ void GenerateMaskFromSimpleShapes::setupFilterParameters()
 
   DataArrayCreationFilterParameter::RequirementType dacReq;
   parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Mask", MaskArrayPath, FilterParameter::Category::CreatedArray, GenerateMaskFromSimpleShapes, dacReq));
+  std::vector<QString> linkedProps = {"ShapeIdsArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Create Shape Ids", CreateShapeIds, FilterParameter::Category::Parameter, GenerateMaskFromSimpleShapes, linkedProps));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Shape Ids", ShapeIdsArrayName, FilterParameter::Category::CreatedArray, GenerateMaskFromSimpleShapes));
   DataArraySelectionFilterParameter::RequirementType dasReq;
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Centers", CentersArrayPath, FilterParameter::Category::RequiredArray, GenerateMaskFromSimpleShapes, dasReq));
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Ellipsoid Axes Lengths", AxesLengthArrayPath, FilterParameter::Category::RequiredArray, GenerateMaskFromSimpleShapes, dasReq, 0));
@@ -105,7 +112,7 @@ void GenerateMaskFromSimpleShapes::dataCheck()
 
   AttributeMatrix::Type attrMatType = attrMat->getType();
 
-  if(attrMatType == AttributeMatrix::Type::Vertex || attrMatType == AttributeMatrix::Type::Cell)
+  if(attrMatType != AttributeMatrix::Type::Vertex && attrMatType != AttributeMatrix::Type::Cell)
   {
     QString ss = QObject::tr("The Attribute Matrix must have a cell or vertex geometry.");
     setErrorCondition(-5555, ss);
@@ -120,6 +127,20 @@ void GenerateMaskFromSimpleShapes::dataCheck()
     m_Mask = m_MaskPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
+  if(m_CreateShapeIds)
+  {
+    DataArrayPath path(getMaskArrayPath().getDataContainerName(), getMaskArrayPath().getAttributeMatrixName(), getShapeIdsArrayName());
+    m_ShapeIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, path, -1, cDims);
+    if(nullptr != m_ShapeIdsPtr.lock())
+    {
+      m_ShapeIds = m_ShapeIdsPtr.lock()->getPointer(0);
+    }
+  }
+  else
+  {
+    m_ShapeIds = nullptr;
+  }
+
   cDims[0] = 3;
   m_CentersPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getCentersArrayPath(), cDims);
   if(nullptr != m_CentersPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
@@ -195,142 +216,191 @@ bool IsPointInEllipsoidBounds(float xcenter, float ycenter, float zcenter, float
 {
   return ((xcenter - x) * (xcenter - x) / (a * a) + (ycenter - y) * (ycenter - y) / (b * b) + (zcenter - z) * (zcenter - z) / (c * c)) < 1;
 }
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void GenerateMaskFromSimpleShapes::createImageMask()
-{
-  size_t totalNumFIDs = m_CentersPtr.lock()->getNumberOfTuples();
-  size_t totalNumElementsDest = m_MaskPtr.lock()->getNumberOfTuples();
-  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getMaskArrayPath().getDataContainerName());
-  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
-  SizeVec3Type udims = image->getDimensions();
-  FloatVec3Type uorigin = image->getOrigin();
-  FloatVec3Type uspacing = image->getSpacing();
-
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
 
-  std::array<float, 3> origin = {
-      static_cast<float>(uorigin[0]),
-      static_cast<float>(uorigin[1]),
-      static_cast<float>(uorigin[2]),
-  };
-
-  std::array<float, 3> spacing = {
-      static_cast<float>(uspacing[0]),
-      static_cast<float>(uspacing[1]),
-      static_cast<float>(uspacing[2]),
-  };
-
-  bool inBounds = false;
+namespace
+{
+/**
+ * @brief Axis aligned ellipsoids with per shape semi-axis lengths
+ */
+struct EllipsoidShapes
+{
+  const float* centers = nullptr;
+  const float* axisLengths = nullptr;
 
-  float currentx = 0;
-  float currenty = 0;
-  float currentz = 0;
+  void bounds(size_t k, std::array<float, 3>& lo, std::array<float, 3>& hi) const
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      lo[a] = centers[3 * k + a] - std::abs(axisLengths[3 * k + a]);
+      hi[a] = centers[3 * k + a] + std::abs(axisLengths[3 * k + a]);
+    }
+  }
 
-  int64_t xindex = 0;
-  int64_t yindex = 0;
-  int64_t zindex = 0;
-  int64_t tempMod = 0;
+  bool contains(size_t k, float x, float y, float z) const
+  {
+    return IsPointInEllipsoidBounds(centers[3 * k], centers[3 * k + 1], centers[3 * k + 2], axisLengths[3 * k], axisLengths[3 * k + 1], axisLengths[3 * k + 2], x, y, z);
+  }
+};
 
-  size_t k = 0;
+/**
+ * @brief Axis aligned boxes with per shape edge lengths
+ */
+struct BoxShapes
+{
+  const float* centers = nullptr;
+  const float* boxDims = nullptr;
 
-  if(m_MaskShape == 0)
+  void bounds(size_t k, std::array<float, 3>& lo, std::array<float, 3>& hi) const
   {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
+    for(size_t a = 0; a < 3; a++)
     {
+      lo[a] = centers[3 * k + a] - boxDims[3 * k + a] / 2.0f;
+      hi[a] = centers[3 * k + a] + boxDims[3 * k + a] / 2.0f;
+    }
+  }
 
-      zindex = i / (dims[0] * dims[1]);
-      tempMod = i % (dims[0] * dims[1]);
-      yindex = tempMod / (dims[0]);
-      xindex = tempMod % (dims[0]);
-
-      currentx = origin[0] + spacing[0] * xindex;
-      currenty = origin[1] + spacing[1] * yindex;
-      currentz = origin[2] + spacing[2] * zindex;
+  bool contains(size_t k, float x, float y, float z) const
+  {
+    return IsPointInBoxBounds(centers[3 * k], centers[3 * k + 1], centers[3 * k + 2], boxDims[3 * k], boxDims[3 * k + 1], boxDims[3 * k + 2], x, y, z);
+  }
+};
 
-      inBounds = false;
-      k = 0;
+/**
+ * @brief Cylinders with their axis along Z and per shape radius and height
+ */
+struct CylinderShapes
+{
+  const float* centers = nullptr;
+  const float* radii = nullptr;
+  const float* heights = nullptr;
 
-      while(!inBounds && k < totalNumFIDs)
-      {
-        inBounds = IsPointInEllipsoidBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_AxisLengths[3 * k], m_AxisLengths[3 * k + 1], m_AxisLengths[3 * k + 2], currentx, currenty,
-                                            currentz);
+  void bounds(size_t k, std::array<float, 3>& lo, std::array<float, 3>& hi) const
+  {
+    float r = std::abs(radii[k]);
+    lo = {centers[3 * k] - r, centers[3 * k + 1] - r, centers[3 * k + 2] - heights[k] / 2.0f};
+    hi = {centers[3 * k] + r, centers[3 * k + 1] + r, centers[3 * k + 2] + heights[k] / 2.0f};
+  }
 
-        if(inBounds)
-        {
-          m_Mask[i] = true;
-        }
+  bool contains(size_t k, float x, float y, float z) const
+  {
+    return IsPointInCylinderBounds(centers[3 * k], centers[3 * k + 1], centers[3 * k + 2], radii[k], heights[k], x, y, z);
+  }
+};
 
-        k++;
-      }
-    }
+/**
+ * @brief Marks a point as inside a shape. Points keep the id of the first (lowest
+ * numbered) shape that contains them.
+ */
+class MarkPoint
+{
+public:
+  MarkPoint(bool* mask, int32_t* shapeIds)
+  : m_Mask(mask)
+  , m_ShapeIds(shapeIds)
+  {
   }
 
-  if(m_MaskShape == 1)
+  void operator()(size_t shape, size_t point) const
   {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
+    if(!m_Mask[point])
     {
+      m_Mask[point] = true;
+      if(nullptr != m_ShapeIds)
+      {
+        m_ShapeIds[point] = static_cast<int32_t>(shape);
+      }
+    }
+  }
 
-      zindex = i / (dims[0] * dims[1]);
-      tempMod = i % (dims[0] * dims[1]);
-      yindex = tempMod / (dims[0]);
-      xindex = tempMod % (dims[0]);
-
-      currentx = origin[0] + spacing[0] * xindex;
-      currenty = origin[1] + spacing[1] * yindex;
-      currentz = origin[2] + spacing[2] * zindex;
+private:
+  bool* m_Mask = nullptr;
+  int32_t* m_ShapeIds = nullptr;
+};
 
-      inBounds = false;
-      k = 0;
+/**
+ * @brief Tests a range of vertices against the shapes in order until one contains it
+ */
+template <typename ShapeFunc>
+class MaskVerticesImpl
+{
+public:
+  MaskVerticesImpl(const ShapeFunc& shapes, size_t numShapes, const float* vertices, const MarkPoint& mark)
+  : m_Shapes(shapes)
+  , m_NumShapes(numShapes)
+  , m_Vertices(vertices)
+  , m_Mark(mark)
+  {
+  }
 
-      while(!inBounds && k < totalNumFIDs)
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      for(size_t k = 0; k < m_NumShapes; k++)
       {
-        inBounds = IsPointInBoxBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_BoxDims[0], m_BoxDims[1], m_BoxDims[2], currentx, currenty, currentz);
-
-        if(inBounds)
+        if(m_Shapes.contains(k, m_Vertices[3 * i], m_Vertices[3 * i + 1], m_Vertices[3 * i + 2]))
         {
-          m_Mask[i] = true;
+          m_Mark(k, i);
+          break;
         }
-
-        k++;
       }
     }
   }
 
-  if(m_MaskShape == 2)
-  {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
-    {
+private:
+  const ShapeFunc& m_Shapes;
+  size_t m_NumShapes = 0;
+  const float* m_Vertices = nullptr;
+  const MarkPoint& m_Mark;
+};
 
-      zindex = i / (dims[0] * dims[1]);
-      tempMod = i % (dims[0] * dims[1]);
-      yindex = tempMod / (dims[0]);
-      xindex = tempMod % (dims[0]);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename ShapeFunc>
+void maskVertices(const ShapeFunc& shapes, size_t numShapes, const float* vertices, size_t numVertices, const MarkPoint& mark)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numVertices);
+  dataAlg.execute(MaskVerticesImpl<ShapeFunc>(shapes, numShapes, vertices, mark));
+}
+} // namespace
 
-      currentx = origin[0] + spacing[0] * xindex;
-      currenty = origin[1] + spacing[1] * yindex;
-      currentz = origin[2] + spacing[2] * zindex;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateMaskFromSimpleShapes::createImageMask()
+{
+  size_t numShapes = m_CentersPtr.lock()->getNumberOfTuples();
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getMaskArrayPath().getDataContainerName());
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  SizeVec3Type udims = image->getDimensions();
+  FloatVec3Type uorigin = image->getOrigin();
+  FloatVec3Type uspacing = image->getSpacing();
 
-      inBounds = false;
-      k = 0;
+  ShapeRasterization::Grid grid;
+  for(size_t a = 0; a < 3; a++)
+  {
+    grid.dims[a] = static_cast<int64_t>(udims[a]);
+    grid.origin[a] = static_cast<float>(uorigin[a]);
+    grid.spacing[a] = static_cast<float>(uspacing[a]);
+  }
 
-      while(!inBounds && k < totalNumFIDs)
-      {
-        inBounds = IsPointInCylinderBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_CylinderRad[k], m_CylinderHeight[k], currentx, currenty, currentz);
+  MarkPoint mark(m_Mask, m_ShapeIds);
 
-        if(inBounds)
-        {
-          m_Mask[i] = true;
-        }
+  if(m_MaskShape == 0)
+  {
+    ShapeRasterization::rasterize(numShapes, EllipsoidShapes{m_Centers, m_AxisLengths}, grid, mark);
+  }
 
-        k++;
-      }
-    }
+  if(m_MaskShape == 1)
+  {
+    ShapeRasterization::rasterize(numShapes, BoxShapes{m_Centers, m_BoxDims}, grid, mark);
+  }
+
+  if(m_MaskShape == 2)
+  {
+    ShapeRasterization::rasterize(numShapes, CylinderShapes{m_Centers, m_CylinderRad, m_CylinderHeight}, grid, mark);
   }
 }
 // -----------------------------------------------------------------------------
@@ -338,91 +408,28 @@ void GenerateMaskFromSimpleShapes::createImageMask()
 // -----------------------------------------------------------------------------
 void GenerateMaskFromSimpleShapes::createVertexMask()
 {
-  size_t totalNumCenters = m_CentersPtr.lock()->getNumberOfTuples();
-  size_t totalNumElementsDest = m_MaskPtr.lock()->getNumberOfTuples();
+  size_t numShapes = m_CentersPtr.lock()->getNumberOfTuples();
+  size_t numVertices = m_MaskPtr.lock()->getNumberOfTuples();
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getMaskArrayPath().getDataContainerName());
   VertexGeom::Pointer vertex = dc->getGeometryAs<VertexGeom>();
 
-  bool inBounds = false;
-
-  float currentx = 0;
-  float currenty = 0;
-  float currentz = 0;
-
   float* vertices = vertex->getVertexPointer(0);
-  size_t k = 0;
+
+  MarkPoint mark(m_Mask, m_ShapeIds);
 
   if(m_MaskShape == 0)
   {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
-    {
-      inBounds = false;
-      k = 0;
-      currentx = vertices[3 * i];
-      currenty = vertices[3 * i + 1];
-      currentz = vertices[3 * i + 2];
-
-      while(!inBounds && k < totalNumCenters)
-      {
-        inBounds = IsPointInEllipsoidBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_AxisLengths[3 * k], m_AxisLengths[3 * k + 1], m_AxisLengths[3 * k + 2], currentx, currenty,
-                                            currentz);
-
-        if(inBounds)
-        {
-          m_Mask[i] = true;
-        }
-
-        k++;
-      }
-    }
+    maskVertices(EllipsoidShapes{m_Centers, m_AxisLengths}, numShapes, vertices, numVertices, mark);
   }
 
   if(m_MaskShape == 1)
   {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
-    {
-      inBounds = false;
-      k = 0;
-      currentx = vertices[3 * i];
-      currenty = vertices[3 * i + 1];
-      currentz = vertices[3 * i + 2];
-
-      while(!inBounds && k < totalNumCenters)
-      {
-        inBounds = IsPointInBoxBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_BoxDims[3 * k], m_BoxDims[3 * k + 1], m_BoxDims[3 * k + 2], currentx, currenty, currentz);
-
-        if(inBounds)
-        {
-          m_Mask[i] = true;
-        }
-
-        k++;
-      }
-    }
+    maskVertices(BoxShapes{m_Centers, m_BoxDims}, numShapes, vertices, numVertices, mark);
   }
 
   if(m_MaskShape == 2)
   {
-    for(size_t i = 0; i < totalNumElementsDest; i++)
-    {
-      inBounds = false;
-      k = 0;
-      currentx = vertices[3 * i];
-      currenty = vertices[3 * i + 1];
-      currentz = vertices[3 * i + 2];
-
-      while(!inBounds && k < totalNumCenters)
-      {
-        inBounds = IsPointInCylinderBounds(m_Centers[3 * k], m_Centers[3 * k + 1], m_Centers[3 * k + 2], m_CylinderRad[k], m_CylinderHeight[k], currentx, currenty, currentz);
-
-        if(inBounds)
-        {
-          m_Mask[i] = true;
-        }
-
-        k++;
-      }
-    }
+    maskVertices(CylinderShapes{m_Centers, m_CylinderRad, m_CylinderHeight}, numShapes, vertices, numVertices, mark);
   }
 }
 
@@ -637,3 +644,27 @@ int GenerateMaskFromSimpleShapes::getMaskShape() const
 {
   return m_MaskShape;
 }
+
+// -----------------------------------------------------------------------------
+void GenerateMaskFromSimpleShapes::setCreateShapeIds(bool value)
+{
+  m_CreateShapeIds = value;
+}
+
+// -----------------------------------------------------------------------------
+bool GenerateMaskFromSimpleShapes::getCreateShapeIds() const
+{
+  return m_CreateShapeIds;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateMaskFromSimpleShapes::setShapeIdsArrayName(const QString& value)
+{
+  m_ShapeIdsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString GenerateMaskFromSimpleShapes::getShapeIdsArrayName() const
+{
+  return m_ShapeIdsArrayName;
+}
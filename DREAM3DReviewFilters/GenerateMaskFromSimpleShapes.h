@@ -30,6 +30,8 @@ class DREAM3DReview_EXPORT GenerateMaskFromSimpleShapes : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath CylinderRadiusArrayPath READ getCylinderRadiusArrayPath WRITE setCylinderRadiusArrayPath)
   PYB11_PROPERTY(DataArrayPath CylinderHeightArrayPath READ getCylinderHeightArrayPath WRITE setCylinderHeightArrayPath)
   PYB11_PROPERTY(int MaskShape READ getMaskShape WRITE setMaskShape)
+  PYB11_PROPERTY(bool CreateShapeIds READ getCreateShapeIds WRITE setCreateShapeIds)
+  PYB11_PROPERTY(QString ShapeIdsArrayName READ getShapeIdsArrayName WRITE setShapeIdsArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -138,6 +140,28 @@ public:
   int getMaskShape() const;
   Q_PROPERTY(int MaskShape READ getMaskShape WRITE setMaskShape)
 
+  /**
+   * @brief Setter property for CreateShapeIds
+   */
+  void setCreateShapeIds(bool value);
+  /**
+   * @brief Getter property for CreateShapeIds
+   * @return Value of CreateShapeIds
+   */
+  bool getCreateShapeIds() const;
+  Q_PROPERTY(bool CreateShapeIds READ getCreateShapeIds WRITE setCreateShapeIds)
+
+  /**
+   * @brief Setter property for ShapeIdsArrayName
+   */
+  void setShapeIdsArrayName(const QString& value);
+  /**
+   * @brief Getter property for ShapeIdsArrayName
+   * @return Value of ShapeIdsArrayName
+   */
+  QString getShapeIdsArrayName() const;
+  Q_PROPERTY(QString ShapeIdsArrayName READ getShapeIdsArrayName WRITE setShapeIdsArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -207,12 +231,13 @@ protected:
   void initialize();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief Rasterizes the shapes onto the Image Geometry, visiting only the voxels
+   * inside each shape's bounding box
    */
   void createImageMask();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief Tests every vertex of the Vertex Geometry against the shapes
    */
   void createVertexMask();
 
@@ -220,6 +245,9 @@ private:
   std::weak_ptr<DataArray<bool>> m_MaskPtr;
   bool* m_Mask = nullptr;
 
+  std::weak_ptr<DataArray<int32_t>> m_ShapeIdsPtr;
+  int32_t* m_ShapeIds = nullptr;
+
   std::weak_ptr<DataArray<float>> m_CentersPtr;
   float* m_Centers = nullptr;
 
@@ -245,6 +273,8 @@ private:
   AttributeMatrix::Type m_DestAttributeMatrixType;
 
   int m_MaskShape = {0};
+  bool m_CreateShapeIds = {false};
+  QString m_ShapeIdsArrayName = {"ShapeIds"};
 
 public:
   GenerateMaskFromSimpleShapes(const GenerateMaskFromSimpleShapes&) = delete;            // Copy Constructor Not Implemented
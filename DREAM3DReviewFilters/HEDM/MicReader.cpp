@@ -36,6 +36,7 @@
 #include "MicReader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -45,6 +46,10 @@
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsingHelpers.hpp"
+
 #include "MicConstants.h"
 
 #ifdef _MSC_VER
@@ -426,13 +431,192 @@ int MicReader::readFile()
   return err;
 }
 
+namespace
+{
+/**
+ * @brief Column storage for the rows of a .mic file. Each column is sized once to
+ * the final number of rows so the parser threads can write straight into it.
+ */
+struct MicRowData
+{
+  explicit MicRowData(size_t numRows)
+  : euler1(numRows, 0.0f)
+  , euler2(numRows, 0.0f)
+  , euler3(numRows, 0.0f)
+  , conf(numRows, 0.0f)
+  , x(numRows, 0.0f)
+  , y(numRows, 0.0f)
+  , phase(numRows, 0)
+  , level(numRows, 0)
+  , up(numRows, 0)
+  {
+  }
+
+  std::vector<float> euler1;
+  std::vector<float> euler2;
+  std::vector<float> euler3;
+  std::vector<float> conf;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<int> phase;
+  std::vector<int> level;
+  std::vector<int> up;
+};
+
+constexpr size_t k_NumMicColumns = 19;
+
+/**
+ * @brief Parses a single data row of a .mic file. The columns are
+ * x y z up level good phi1 phi phi2 confidence followed by 9 columns that are
+ * not used by DREAM.3D.
+ * @return false if fewer than 19 columns could be read from the row
+ */
+bool parseMicRow(const char* line, const char* lineEnd, MicRowData& rows, size_t i)
+{
+  float x = -1.0f;
+  float y = -1.0f;
+  float z = -1.0f;
+  int up = 0;
+  int level = 0;
+  int good = 0;
+  float p1 = 0.0f;
+  float p = 0.0f;
+  float p2 = 0.0f;
+  float conf = -1.0f;
+
+  size_t columnsRead = 0;
+  const char* cur = line;
+  const auto readValue = [&](auto& value) {
+    if(nullptr == cur)
+    {
+      return;
+    }
+    cur = TextParsingHelpers::parseNumber(cur, lineEnd, value);
+    if(nullptr != cur)
+    {
+      columnsRead++;
+    }
+  };
+  readValue(x);
+  readValue(y);
+  readValue(z);
+  readValue(up);
+  readValue(level);
+  readValue(good);
+  readValue(p1);
+  readValue(p);
+  readValue(p2);
+  readValue(conf);
+  // The remaining columns are only counted, never converted
+  while(nullptr != cur && columnsRead < k_NumMicColumns)
+  {
+    cur = TextParsingHelpers::skipBlanks(cur, lineEnd);
+    if(cur == lineEnd)
+    {
+      break;
+    }
+    cur = TextParsingHelpers::skipToken(cur, lineEnd);
+    columnsRead++;
+  }
+
+  rows.euler1[i] = p1;
+  rows.euler2[i] = p;
+  rows.euler3[i] = p2;
+  rows.conf[i] = conf;
+  rows.phase[i] = good > 0 ? 1 : 0;
+  rows.level[i] = level;
+  rows.up[i] = up;
+  rows.x[i] = x;
+  rows.y[i] = y;
+
+  return columnsRead == k_NumMicColumns;
+}
+
+/**
+ * @brief Counts the data rows in each line aligned chunk of the file
+ */
+class CountMicRowsImpl
+{
+public:
+  CountMicRowsImpl(const std::vector<const char*>& bounds, std::vector<size_t>& rowsPerChunk)
+  : m_Bounds(bounds)
+  , m_RowsPerChunk(rowsPerChunk)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      m_RowsPerChunk[chunk] = TextParsingHelpers::countDataLines(m_Bounds[chunk], m_Bounds[chunk + 1]);
+    }
+  }
+
+private:
+  const std::vector<const char*>& m_Bounds;
+  std::vector<size_t>& m_RowsPerChunk;
+};
+
+/**
+ * @brief Parses each line aligned chunk of the file, writing the rows starting at
+ * the precomputed offset of that chunk.
+ */
+class ParseMicRowsImpl
+{
+public:
+  ParseMicRowsImpl(const std::vector<const char*>& bounds, const std::vector<size_t>& chunkOffsets, MicRowData& rows, size_t numRows, std::atomic<size_t>& badRows)
+  : m_Bounds(bounds)
+  , m_ChunkOffsets(chunkOffsets)
+  , m_Rows(rows)
+  , m_NumRows(numRows)
+  , m_BadRows(badRows)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t row = m_ChunkOffsets[chunk];
+      size_t badRows = 0;
+      const char* p = m_Bounds[chunk];
+      const char* end = m_Bounds[chunk + 1];
+      while(p < end && row < m_NumRows)
+      {
+        const char* lineEnd = TextParsingHelpers::findLineEnd(p, end);
+        if(!TextParsingHelpers::isBlankLine(p, lineEnd))
+        {
+          if(!parseMicRow(p, lineEnd, m_Rows, row))
+          {
+            badRows++;
+          }
+          row++;
+        }
+        p = lineEnd == end ? end : lineEnd + 1;
+      }
+      if(badRows > 0)
+      {
+        m_BadRows += badRows;
+      }
+    }
+  }
+
+private:
+  const std::vector<const char*>& m_Bounds;
+  const std::vector<size_t>& m_ChunkOffsets;
+  MicRowData& m_Rows;
+  size_t m_NumRows = 0;
+  std::atomic<size_t>& m_BadRows;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 int MicReader::readMicFile()
 {
-  std::ifstream in(getFileName(), std::ios_base::in);
-  if(!in.is_open())
+  TextParsingHelpers::MappedFile mappedFile(QString::fromStdString(getFileName()));
+  if(!mappedFile.isValid())
   {
     std::stringstream msg;
     msg << "Mic file could not be opened: " << getFileName();
@@ -443,75 +627,94 @@ int MicReader::readMicFile()
 
   // Delete any currently existing pointers
   deletePointers();
-  // Initialize new pointers
-  size_t totalDataRows = 0;
-  size_t totalPossibleDataRows = 0;
-  //  size_t featuresRead = 0;
-  float origEdgeLength;
+
   float xMax = 0.0F;
   float yMax = 0.0F;
   float xMin = 1000000000.0F;
   float yMin = 1000000000.0F;
   float xMinUM = 0.0F;
   float yMinUM = 0.0F;
-  int32_t counter = 0;
-  std::string buf;
 
   // Read the First line in the file which is the edge length
-  std::getline(in, buf);
-  origEdgeLength = std::stof(buf);
+  const char* fileBegin = mappedFile.begin();
+  const char* fileEnd = mappedFile.end();
+  float origEdgeLength = 0.0f;
+  if(nullptr == TextParsingHelpers::parseNumber(fileBegin, TextParsingHelpers::findLineEnd(fileBegin, fileEnd), origEdgeLength))
+  {
+    std::stringstream msg;
+    msg << "Mic file does not start with a valid edge length: " << getFileName();
+    setErrorMessage(msg.str());
+    setErrorCode(-114);
+    return -114;
+  }
+  const char* dataBegin = TextParsingHelpers::nextLine(fileBegin, fileEnd);
 
   // Read the first line of actual data which we then derive the actual number of data rows
-  std::getline(in, buf);
-  parseDataLine(buf, 0);
+  const char* firstRow = dataBegin;
+  while(firstRow < fileEnd && TextParsingHelpers::isBlankLine(firstRow, TextParsingHelpers::findLineEnd(firstRow, fileEnd)))
+  {
+    firstRow = TextParsingHelpers::nextLine(firstRow, fileEnd);
+  }
+  if(firstRow == fileEnd)
+  {
+    std::stringstream msg;
+    msg << "Mic file does not contain any data rows: " << getFileName();
+    setErrorMessage(msg.str());
+    setErrorCode(-115);
+    return -115;
+  }
+  MicRowData firstRowData(1);
+  parseMicRow(firstRow, TextParsingHelpers::findLineEnd(firstRow, fileEnd), firstRowData, 0);
 
-  int level = m_Level[0];
+  int level = firstRowData.level[0];
   float newEdgeLength = origEdgeLength / powf(2.0, float(level));
-  totalPossibleDataRows = static_cast<size_t>(6.0f * powf(4.0f, float(level)));
-
-  // Reinitialize the pointers that hold the data to the proper size
-  initPointers(totalPossibleDataRows);
+  size_t totalPossibleDataRows = static_cast<size_t>(6.0f * powf(4.0f, float(level)));
 
-  // Reparse the first data line to get those values into the new arrays
-  parseDataLine(buf, 0);
-
-  std::getline(in, buf);
-  ++counter;
-  for(size_t i = 1; i < totalPossibleDataRows; ++i)
+  // Split the data section into line aligned chunks and count the rows in each
+  // chunk so every chunk knows where its first row lands in the final columns
+  std::vector<const char*> bounds = TextParsingHelpers::splitIntoLineChunks(dataBegin, fileEnd, TextParsingHelpers::suggestedChunkCount(static_cast<size_t>(fileEnd - dataBegin)));
+  size_t numChunks = bounds.size() - 1;
+  std::vector<size_t> rowsPerChunk(numChunks, 0);
   {
-    parseDataLine(buf, i);
-    std::getline(in, buf);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute(CountMicRowsImpl(bounds, rowsPerChunk));
+  }
+  std::vector<size_t> chunkOffsets(numChunks, 0);
+  size_t totalDataRows = 0;
+  for(size_t chunk = 0; chunk < numChunks; chunk++)
+  {
+    chunkOffsets[chunk] = totalDataRows;
+    totalDataRows += rowsPerChunk[chunk];
+  }
+  totalDataRows = std::min(totalDataRows, totalPossibleDataRows);
 
-    ++counter;
-    if(in.eof())
-    {
-      break;
-    }
+  MicRowData rows(totalDataRows);
+  std::atomic<size_t> badRows(0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute(ParseMicRowsImpl(bounds, chunkOffsets, rows, totalDataRows, badRows));
+  }
+  if(badRows > 0)
+  {
+    std::cout << "MicReader Error: Not enough columns were read for " << badRows << " rows" << std::endl;
   }
-  totalDataRows = counter;
 
-  std::vector<float> EA1(totalDataRows, 0.0);
-  std::vector<float> EA2(totalDataRows, 0.0);
-  std::vector<float> EA3(totalDataRows, 0.0);
-  std::vector<float> confidence(totalDataRows, 0.0);
-  std::vector<int> phase(totalDataRows, 0);
-  std::vector<int> up(totalDataRows, 0);
-  std::vector<float> xVal(totalDataRows, 0.0);
-  std::vector<float> yVal(totalDataRows, 0.0);
   float constant = static_cast<float>(1.0f / (2.0 * sqrt(3.0)));
-  float x;
-  float y;
+  float x = 0.0f;
+  float y = 0.0f;
   for(size_t i = 0; i < totalDataRows; ++i)
   {
-    if(m_Up[i] == 1)
+    if(rows.up[i] == 1)
     {
-      x = m_X[i] + (newEdgeLength / 2.0f);
-      y = m_Y[i] + (constant * newEdgeLength);
+      x = rows.x[i] + (newEdgeLength / 2.0f);
+      y = rows.y[i] + (constant * newEdgeLength);
     }
-    if(m_Up[i] == 2)
+    if(rows.up[i] == 2)
     {
-      x = m_X[i] + (newEdgeLength / 2.0f);
-      y = m_Y[i] - (constant * newEdgeLength);
+      x = rows.x[i] + (newEdgeLength / 2.0f);
+      y = rows.y[i] - (constant * newEdgeLength);
     }
     if(x > xMax)
     {
@@ -529,14 +732,6 @@ int MicReader::readMicFile()
     {
       yMin = y;
     }
-    EA1[i] = m_Euler1[i];
-    EA2[i] = m_Euler2[i];
-    EA3[i] = m_Euler3[i];
-    confidence[i] = m_Conf[i];
-    phase[i] = m_Phase[i];
-    up[i] = m_Up[i];
-    xVal[i] = m_X[i];
-    yVal[i] = m_Y[i];
   }
   xMin = xMin - (2.0 * newEdgeLength);
   xMax = xMax + (2.0 * newEdgeLength);
@@ -561,9 +756,7 @@ int MicReader::readMicFile()
   EbsdHeaderEntry::Pointer yResHeader = MicHeaderEntry<float>::NewEbsdHeaderEntry(Mic::YRes, yRes);
   m_HeaderMap[Mic::YRes] = yResHeader;
 
-  // Delete any currently existing pointers
-  deletePointers();
-  // Resize pointers
+  // Size the output pointers to the final grid
   initPointers(xDim * yDim);
 
   float xA = 0.0f;
@@ -579,18 +772,18 @@ int MicReader::readMicFile()
   int check3 = 0;
   for(size_t i = 0; i < totalDataRows; ++i)
   {
-    xA = xVal[i] - xMin;
+    xA = rows.x[i] - xMin;
     xB = xA + newEdgeLength;
     xC = xA + (newEdgeLength / 2.0f);
-    if(up[i] == 1)
+    if(rows.up[i] == 1)
     {
-      yA = yVal[i] - yMin;
+      yA = rows.y[i] - yMin;
       yB = yA;
       yC = yA + (root3over2 * newEdgeLength);
     }
-    if(up[i] == 2)
+    if(rows.up[i] == 2)
     {
-      yB = yVal[i] - yMin;
+      yB = rows.y[i] - yMin;
       yC = yB;
       yA = yB - (root3over2 * newEdgeLength);
     }
@@ -606,11 +799,11 @@ int MicReader::readMicFile()
         if((check1 <= 0 && check2 <= 0 && check3 <= 0) || (check1 >= 0 && check2 >= 0 && check3 >= 0))
         {
           point = (k * xDim) + j;
-          m_Euler1[point] = EA1[i];
-          m_Euler2[point] = EA2[i];
-          m_Euler3[point] = EA3[i];
-          m_Conf[point] = confidence[i];
-          m_Phase[point] = phase[i];
+          m_Euler1[point] = rows.euler1[i];
+          m_Euler2[point] = rows.euler2[i];
+          m_Euler3[point] = rows.euler3[i];
+          m_Conf[point] = rows.conf[i];
+          m_Phase[point] = rows.phase[i];
           m_X[point] = float(j) * xRes + xMinUM;
           m_Y[point] = float(k) * yRes + yMinUM;
         }
@@ -667,76 +860,6 @@ void MicReader::parseHeaderLine(std::string& line)
 #endif
 }
 
-// -----------------------------------------------------------------------------
-//  Read the data part of the Mic file
-// -----------------------------------------------------------------------------
-void MicReader::parseDataLine(std::string& line, size_t i)
-{
-  /* When reading the data there should be at least 8 cols of data. There may even
-   * be 10 columns of data. The column names should be the following:
-   * phi1
-   * phi
-   * phi2
-   * x pos
-   * y pos
-   * image quality
-   * confidence index
-   * phase
-   * SEM Signal
-   * Fit of Solution
-   *
-   * Some HEDM Mic files do NOT have all 10 columns. Assume these are lacking the last
-   * 2 columns and all the other columns are the same as above.
-   */
-  float p1 = 0.0f;
-  float p = 0.0f;
-  float p2 = 0.0f;
-  float x = -1.0f;
-  float y = -1.0f;
-  float z = -1.0f;
-  float conf = -1.0f;
-  float junk1;
-  float junk2;
-  float junk3;
-  int up = 0;
-  int level = 0;
-  int good = 0;
-  int junk4;
-  int junk5;
-  int junk6;
-  int junk7;
-  int junk8;
-  int junk9;
-  size_t offset = 0;
-  size_t featuresRead = 0;
-  featuresRead = sscanf(line.data(), "%f %f %f %d %d %d %f %f %f %f %f %f %f %d %d %d %d %d %d", &x, &y, &z, &up, &level, &good, &p1, &p, &p2, &conf, &junk1, &junk2, &junk3, &junk4, &junk5, &junk6,
-                        &junk7, &junk8, &junk9);
-  if(featuresRead != 19)
-  {
-    std::cout << "MicReader Error: Not enough columns were read for row " << i;
-  }
-  offset = i;
-
-  if(good > 0)
-  {
-    good = 1;
-  }
-  else
-  {
-    good = 0;
-  }
-
-  m_Euler1[offset] = p1;
-  m_Euler2[offset] = p;
-  m_Euler3[offset] = p2;
-  m_Conf[offset] = conf;
-  m_Phase[offset] = good;
-  m_Level[offset] = level;
-  m_Up[offset] = up;
-  m_X[offset] = x;
-  m_Y[offset] = y;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -188,6 +188,12 @@ private:
   float xRes;
   float yRes;
 
+  /**
+   * @brief Reads the data section of the .mic file. The file is memory mapped and
+   * split into line aligned chunks that are counted and then parsed in parallel
+   * directly into per-row columns before being rasterized onto the square grid.
+   * @return 0 on success
+   */
   int readMicFile();
 
   int readDatFile();
@@ -197,11 +203,6 @@ private:
    */
   void parseHeaderLine(std::string& line);
 
-  /** @brief Parses the data from a line of data from the HEDM .Mic file
-   * @param line The line of data to parse
-   */
-  void parseDataLine(std::string& line, size_t i);
-
   /**
    * @brief initPointers
    * @param numElements
@@ -48,9 +48,8 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
-#include "SIMPLib/Math/GeometryMath.h"
-#include "SIMPLib/Math/SIMPLibMath.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/DislocationSegments.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
@@ -221,87 +220,28 @@ void IdentifyDislocationSegments::execute()
   AttributeMatrix::Pointer edgeFeatureAttrMat = m->getAttributeMatrix(getEdgeFeatureAttributeMatrixName());
   EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
 
-  // float* vertex = edgeGeom->getVertexPointer(0);
   MeshIndexType* edge = edgeGeom->getEdgePointer(0);
   MeshIndexType numEdges = edgeGeom->getNumberOfEdges();
-
-  edgeGeom->findElementsContainingVert();
-
-  DynamicListArray<uint16_t, MeshIndexType>::Pointer edgesContainingVert = edgeGeom->getElementsContainingVert();
-
-  int dnum = 0;
-  qint32 size = 0;
-  std::vector<size_t> tDims(1, dnum);
-  int64_t initialEdgesListSize = 100;
-  QVector<int64_t> edgeslist(initialEdgesListSize, -1);
-  float refBV[3], refSPN[3];
-  float neighBV[3], neighSPN[3];
-  float angleBV, angleSPN;
-  float angleTol = 1.0 * SIMPLib::Constants::k_PiD / 180.0f;
-  for(size_t i = 0; i < numEdges; i++)
+  MeshIndexType numVerts = edgeGeom->getNumberOfVertices();
+
+  // Edges sharing a node with matching Burgers vectors and slip planes are merged into
+  // segments in parallel; the segments are numbered in the order of their lowest edge
+  DislocationSegments::VertexEdges adjacency;
+  adjacency.build(numVerts, edge, numEdges);
+  ConcurrentUnionFind<MeshIndexType> segmentForest;
+  int32_t dnum = DislocationSegments::identify(edge, numEdges, m_BurgersVectors, m_SlipPlaneNormals, adjacency, m_DislocationIds, segmentForest);
+
+  std::vector<size_t> tDims(1, static_cast<size_t>(dnum) + 1);
+  edgeFeatureAttrMat->resizeAttributeArrays(tDims);
+  updateEdgeFeatureInstancePointers();
+  for(int32_t i = 1; i <= dnum; i++)
   {
-    size = 0;
-    if(m_DislocationIds[i] == 0)
-    {
-      dnum++;
-      m_DislocationIds[i] = dnum;
-      edgeslist[size] = i;
-      size++;
-      tDims[0] = dnum + 1;
-      edgeFeatureAttrMat->resizeAttributeArrays(tDims);
-      updateEdgeFeatureInstancePointers();
-      m_Active[dnum] = true;
-      while(size > 0)
-      {
-        int64_t currentEdge = edgeslist[size - 1];
-        refBV[0] = m_BurgersVectors[3 * currentEdge + 0];
-        refBV[1] = m_BurgersVectors[3 * currentEdge + 1];
-        refBV[2] = m_BurgersVectors[3 * currentEdge + 2];
-        refSPN[0] = m_SlipPlaneNormals[3 * currentEdge + 0];
-        refSPN[1] = m_SlipPlaneNormals[3 * currentEdge + 1];
-        refSPN[2] = m_SlipPlaneNormals[3 * currentEdge + 2];
-        size -= 1;
-        for(int iter = 0; iter < 2; iter++)
-        {
-          uint16_t eCount = edgesContainingVert->getNumberOfElements(edge[2 * currentEdge + iter]);
-          MeshIndexType* data = edgesContainingVert->getElementListPointer(edge[2 * currentEdge + iter]);
-          for(uint16_t j = 0; j < eCount; j++)
-          {
-            if(m_DislocationIds[data[j]] == 0)
-            {
-              neighBV[0] = m_BurgersVectors[3 * data[j] + 0];
-              neighBV[1] = m_BurgersVectors[3 * data[j] + 1];
-              neighBV[2] = m_BurgersVectors[3 * data[j] + 2];
-              neighSPN[0] = m_SlipPlaneNormals[3 * data[j] + 0];
-              neighSPN[1] = m_SlipPlaneNormals[3 * data[j] + 1];
-              neighSPN[2] = m_SlipPlaneNormals[3 * data[j] + 2];
-              angleBV = GeometryMath::AngleBetweenVectors(refBV, neighBV);
-              angleSPN = GeometryMath::AngleBetweenVectors(refSPN, neighSPN);
-              if((angleBV < angleTol || (SIMPLib::Constants::k_PiD - angleBV) < angleTol) && (angleSPN < angleTol || (SIMPLib::Constants::k_PiD - angleSPN) < angleTol))
-              {
-                m_DislocationIds[data[j]] = dnum;
-                edgeslist[size] = data[j];
-                size++;
-                if(size >= edgeslist.size())
-                {
-                  size = edgeslist.size();
-                  edgeslist.resize(size + initialEdgesListSize);
-                  for(qint32 jj = size; jj < edgeslist.size(); ++jj)
-                  {
-                    edgeslist[jj] = -1;
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+    m_Active[i] = true;
   }
 
   // Generate all the numbers up front
   const int rangeMin = 1;
-  const int rangeMax = dnum - 1;
+  const int rangeMax = dnum;
 
   std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
   std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
@@ -309,12 +249,12 @@ void IdentifyDislocationSegments::execute()
   generator.seed(seed);
   std::uniform_int_distribution<int32_t> distribution(rangeMin, rangeMax);
 
-  DataArray<int32_t>::Pointer rndNumbers = DataArray<int32_t>::CreateArray(dnum, std::string("New FeatureIds"), true);
+  DataArray<int32_t>::Pointer rndNumbers = DataArray<int32_t>::CreateArray(dnum + 1, std::string("New FeatureIds"), true);
   int32_t* gid = rndNumbers->getPointer(0);
   gid[0] = 0;
   QSet<int32_t> featureIdSet;
   featureIdSet.insert(0);
-  for(int32_t i = 1; i < dnum; ++i)
+  for(int32_t i = 1; i <= dnum; ++i)
   {
     gid[i] = i; // numberGenerator();
     featureIdSet.insert(gid[i]);
@@ -323,10 +263,10 @@ void IdentifyDislocationSegments::execute()
   qint32 r;
   qint32 temp;
   //--- Shuffle elements by randomly exchanging each with one other.
-  for(qint32 i = 1; i < dnum; i++)
+  for(qint32 i = 1; i <= dnum; i++)
   {
     r = distribution(generator); // Random remaining position.
-    if(r >= dnum)
+    if(r > dnum)
     {
       continue;
     }
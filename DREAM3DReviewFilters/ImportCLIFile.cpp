@@ -14,6 +14,7 @@
 
 #include "ImportCLIFile.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include <QtCore/QFileInfo>
@@ -29,6 +30,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsingHelpers.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -126,203 +128,531 @@ void ImportCLIFile::dataCheck()
   getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType>(this, path, 0, cDims);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ImportCLIFile::execute()
+namespace
 {
-  initialize();
-  dataCheck();
-  if(getErrorCode() < 0)
+/**
+ * @brief Accumulates the vertices, edges and per edge ids of a CLI file. Polylines
+ * and hatches are appended directly into the final storage, so no per command
+ * temporaries are needed.
+ */
+class CLIGeometryBuilder
+{
+public:
+  void startLayer(float height)
   {
-    return;
+    m_Layer++;
+    m_LayerHeight = height;
   }
 
-  QFile stream;
-  stream.setFileName(getCLIFile());
-  if(!stream.open(QIODevice::ReadOnly | QIODevice::Text))
+  void startFeature()
   {
-    QString ss = QObject::tr("Input CLI file could not be opened: %1").arg(getCLIFile());
-    setErrorCondition(-100, ss);
-    return;
+    m_Features++;
   }
 
-  QByteArray buf;
-  QList<QByteArray> tokens;
-  bool ok = false;
-  float units = 1.0f;
-  std::vector<float> tmpVertices;
-  std::vector<int64_t> tmpEdges;
-  std::vector<int32_t> tmpLayerIds;
-  std::vector<int32_t> tmpFeatureIds;
-  float layerHeight = 0.0f;
-  int32_t lines = 1;
-  int32_t layer = 0;
-  int32_t features = 0;
-  int64_t vertexCounter = 0;
-
-  while(!stream.atEnd())
-  {
-    buf = stream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    if(buf.startsWith("$$UNITS"))
+  void addPoint(float x, float y)
+  {
+    m_Vertices.push_back(x);
+    m_Vertices.push_back(y);
+    m_Vertices.push_back(m_LayerHeight);
+  }
+
+  /**
+   * @brief Connects the last numPoints points into a closed loop. The repeated end
+   * point of a CLI polyline is not passed in, the loop is closed back to its start.
+   */
+  void closePolyline(size_t numPoints)
+  {
+    if(numPoints == 0)
     {
-      tokens = buf.split('/');
-      if(tokens.size() != 2)
-      {
-        QString ss = QObject::tr("Unable to parse units from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
-      }
-      units = tokens.at(1).toFloat(&ok);
-      if(!ok)
+      return;
+    }
+    MeshIndexType first = m_VertexCounter;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      m_Edges.push_back(first + i);
+      m_Edges.push_back(i + 1 < numPoints ? first + i + 1 : first);
+      m_LayerIds.push_back(m_Layer);
+      m_FeatureIds.push_back(m_Features);
+    }
+    m_VertexCounter += numPoints;
+  }
+
+  /**
+   * @brief Connects the last numHatches pairs of points into separate segments
+   */
+  void closeHatches(size_t numHatches)
+  {
+    for(size_t i = 0; i < numHatches; i++)
+    {
+      m_Edges.push_back(m_VertexCounter);
+      m_Edges.push_back(m_VertexCounter + 1);
+      m_LayerIds.push_back(m_Layer);
+      m_FeatureIds.push_back(m_Features);
+      m_VertexCounter += 2;
+    }
+  }
+
+  std::vector<float>& vertices()
+  {
+    return m_Vertices;
+  }
+
+  const std::vector<MeshIndexType>& edges() const
+  {
+    return m_Edges;
+  }
+
+  const std::vector<int32_t>& layerIds() const
+  {
+    return m_LayerIds;
+  }
+
+  const std::vector<int32_t>& featureIds() const
+  {
+    return m_FeatureIds;
+  }
+
+private:
+  std::vector<float> m_Vertices;
+  std::vector<MeshIndexType> m_Edges;
+  std::vector<int32_t> m_LayerIds;
+  std::vector<int32_t> m_FeatureIds;
+  float m_LayerHeight = 0.0f;
+  int32_t m_Layer = 0;
+  int32_t m_Features = 0;
+  MeshIndexType m_VertexCounter = 0;
+};
+
+/**
+ * @brief Counts the comma separated values in [p, lineEnd)
+ */
+size_t countValues(const char* p, const char* lineEnd)
+{
+  if(TextParsingHelpers::isBlankLine(p, lineEnd))
+  {
+    return 0;
+  }
+  return 1 + static_cast<size_t>(std::count(p, lineEnd, ','));
+}
+
+/**
+ * @brief Moves past the next comma separated value without converting it
+ */
+const char* skipValue(const char* p, const char* lineEnd)
+{
+  const char* comma = std::find(p, lineEnd, ',');
+  return comma == lineEnd ? lineEnd : comma + 1;
+}
+
+/**
+ * @brief Parses the next comma separated value and consumes the trailing comma
+ */
+const char* parseValue(const char* p, const char* lineEnd, float& value)
+{
+  p = TextParsingHelpers::parseNumber(p, lineEnd, value);
+  if(nullptr == p)
+  {
+    return nullptr;
+  }
+  p = TextParsingHelpers::skipBlanks(p, lineEnd);
+  if(p == lineEnd)
+  {
+    return p;
+  }
+  return *p == ',' ? p + 1 : nullptr;
+}
+
+/**
+ * @brief Binary CLI command indices from the Common Layer Interface specification
+ */
+enum class CLIBinaryCommand : uint16_t
+{
+  LayerLong = 127,
+  LayerShort = 128,
+  PolylineShort = 129,
+  PolylineLong = 130,
+  HatchesShort = 131,
+  HatchesLong = 132
+};
+
+/**
+ * @brief Little endian reader over the binary section of a CLI file
+ */
+class CLIBinaryReader
+{
+public:
+  CLIBinaryReader(const char* begin, const char* end)
+  : m_Cursor(begin)
+  , m_End(end)
+  {
+  }
+
+  bool atEnd() const
+  {
+    return m_Cursor >= m_End;
+  }
+
+  bool canRead(size_t numBytes) const
+  {
+    return static_cast<size_t>(m_End - m_Cursor) >= numBytes;
+  }
+
+  /**
+   * @brief Reads a count stored either as an unsigned short or an int
+   * @return false if a negative count was stored
+   */
+  bool readCount(bool longFormat, size_t& count)
+  {
+    if(!longFormat)
+    {
+      count = static_cast<size_t>(read<uint16_t>());
+      return true;
+    }
+    int32_t value = read<int32_t>();
+    count = value < 0 ? 0 : static_cast<size_t>(value);
+    return value >= 0;
+  }
+
+  template <typename T>
+  T read()
+  {
+    T value;
+    std::memcpy(&value, m_Cursor, sizeof(T));
+    m_Cursor += sizeof(T);
+    return value;
+  }
+
+  /**
+   * @brief Reads a coordinate stored either as an unsigned short or a real
+   */
+  float readCoordinate(bool longFormat)
+  {
+    return longFormat ? read<float>() : static_cast<float>(read<uint16_t>());
+  }
+
+private:
+  const char* m_Cursor = nullptr;
+  const char* m_End = nullptr;
+};
+
+
+/**
+ * @brief Reads the ASCII portion of a CLI file. For binary files only the header is
+ * ASCII; binaryStart is then set to the first byte after $$HEADEREND.
+ * @return Negative error code if the file could not be parsed
+ */
+int32_t readASCIIGeometry(ImportCLIFile* filter, TextParsingHelpers::LineScanner& scanner, CLIGeometryBuilder& builder, float& units, const char*& binaryStart)
+{
+  const char* lineBegin = nullptr;
+  const char* lineEnd = nullptr;
+  bool binary = false;
+  binaryStart = nullptr;
+
+  const auto parseError = [&](const QString& what) {
+    QString ss = QObject::tr("Unable to parse %1 from CLI file line %2: %3").arg(what).arg(scanner.lineNumber()).arg(QString::fromLatin1(lineBegin, static_cast<int>(lineEnd - lineBegin)));
+    filter->setErrorCondition(-1, ss);
+    return -1;
+  };
+
+  while(scanner.readLine(lineBegin, lineEnd))
+  {
+    if(filter->getCancel())
+    {
+      return 0;
+    }
+    lineBegin = TextParsingHelpers::skipBlanks(lineBegin, lineEnd);
+    if(lineBegin == lineEnd || *lineBegin != '$')
+    {
+      continue;
+    }
+
+    // Every command has the form $$COMMAND/parameters
+    const char* slash = std::find(lineBegin, lineEnd, '/');
+    const char* params = slash == lineEnd ? lineEnd : slash + 1;
+    bool singleSlash = slash != lineEnd && std::find(params, lineEnd, '/') == lineEnd;
+
+    if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$BINARY"))
+    {
+      binary = true;
+    }
+    else if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$HEADEREND"))
+    {
+      if(binary)
       {
-        QString ss = QObject::tr("Unable to parse units from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
+        // Binary data follows the header keyword directly, without a line break
+        binaryStart = lineBegin + std::strlen("$$HEADEREND");
+        return 0;
       }
     }
-    else if(buf.startsWith("$$LAYER"))
+    else if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$UNITS"))
     {
-      layer++;
-      tokens = buf.split('/');
-      if(tokens.size() != 2)
+      if(!singleSlash || nullptr == TextParsingHelpers::parseNumber(params, lineEnd, units))
       {
-        QString ss = QObject::tr("Unable to parse layer height from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
+        return parseError("units");
       }
-      layerHeight = tokens.at(1).toFloat(&ok);
-      if(!ok)
+    }
+    else if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$LAYER"))
+    {
+      float layerHeight = 0.0f;
+      if(!singleSlash || nullptr == TextParsingHelpers::parseNumber(params, lineEnd, layerHeight))
       {
-        QString ss = QObject::tr("Unable to parse layer height from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
+        return parseError("layer height");
       }
+      builder.startLayer(layerHeight);
     }
-    else if(buf.startsWith("$$POLYLINE") || buf.startsWith("$POLYLINE"))
+    else if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$POLYLINE") || TextParsingHelpers::startsWith(lineBegin, lineEnd, "$POLYLINE"))
     {
-      tokens = buf.split('/');
-      if(tokens.size() != 2)
+      if(!singleSlash)
       {
-        QString ss = QObject::tr("Unable to parse polyline from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
+        return parseError("polyline");
       }
-      tokens = tokens.at(1).split(',');
-      if((tokens.size() - 3) > 0)
+      // id, direction and number of points precede the coordinates
+      size_t numValues = countValues(params, lineEnd);
+      if(numValues > 3)
       {
-        features++;
-        if((tokens.size() - 3) % 2 != 0)
+        builder.startFeature();
+        if((numValues - 3) % 2 != 0)
         {
-          QString ss = QObject::tr("Polyline at line %1 does not contain an even number of elements: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-          setErrorCondition(-1, ss);
-          return;
-        }
-        for(auto i = 3; i < (tokens.size() - 2); i++)
-        {
-          float val = tokens.at(i).toFloat(&ok);
-          if(!ok)
-          {
-            QString ss = QObject::tr("Unable to parse polyline coordinate from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-            setErrorCondition(-1, ss);
-            return;
-          }
-          tmpVertices.push_back(val);
-          if(i % 2 == 0)
-          {
-            tmpVertices.push_back(layerHeight);
-          }
+          QString ss = QObject::tr("Polyline at line %1 does not contain an even number of elements: %2").arg(scanner.lineNumber()).arg(QString::fromLatin1(lineBegin, static_cast<int>(lineEnd - lineBegin)));
+          filter->setErrorCondition(-1, ss);
+          return -1;
         }
-        int64_t numVerts = ((tokens.size() - 3) / 2) - 1;
-        int32_t edgeCounter = 0;
-        for(auto i = vertexCounter; i < (vertexCounter + numVerts); i++)
+        const char* p = params;
+        for(size_t i = 0; i < 3; i++)
         {
-          tmpEdges.push_back(i);
-          tmpEdges.push_back(i + 1);
-          edgeCounter++;
+          p = skipValue(p, lineEnd);
         }
-        tmpEdges.pop_back();
-        tmpEdges.push_back(vertexCounter);
-        vertexCounter += numVerts;
-        for(auto i = 0; i < edgeCounter; i++)
+        // The last point repeats the first one and closes the contour
+        size_t numPoints = (numValues - 3) / 2 - 1;
+        for(size_t i = 0; i < numPoints; i++)
         {
-          tmpLayerIds.push_back(layer);
-          tmpFeatureIds.push_back(features);
+          float x = 0.0f;
+          float y = 0.0f;
+          p = parseValue(p, lineEnd, x);
+          p = nullptr == p ? nullptr : parseValue(p, lineEnd, y);
+          if(nullptr == p)
+          {
+            return parseError("polyline coordinate");
+          }
+          builder.addPoint(x, y);
         }
+        builder.closePolyline(numPoints);
       }
     }
-    else if(buf.startsWith("$$HATCHES") || buf.startsWith("$HATCHES"))
+    else if(TextParsingHelpers::startsWith(lineBegin, lineEnd, "$$HATCHES") || TextParsingHelpers::startsWith(lineBegin, lineEnd, "$HATCHES"))
     {
-      tokens = buf.split('/');
-      if(tokens.size() != 2)
+      if(!singleSlash)
       {
-        QString ss = QObject::tr("Unable to parse hatch from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-        setErrorCondition(-1, ss);
-        return;
+        return parseError("hatch");
       }
-      tokens = tokens.at(1).split(',');
-      if((tokens.size() - 2) > 0)
+      // id and number of hatches precede the coordinates
+      size_t numValues = countValues(params, lineEnd);
+      if(numValues > 2)
       {
-        features++;
-        if((tokens.size() - 2) % 4 != 0)
+        builder.startFeature();
+        if((numValues - 2) % 4 != 0)
         {
-          QString ss = QObject::tr("Hatch at line %1 does not contain an even number of elements: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-          setErrorCondition(-1, ss);
-          return;
+          QString ss = QObject::tr("Hatch at line %1 does not contain an even number of elements: %2").arg(scanner.lineNumber()).arg(QString::fromLatin1(lineBegin, static_cast<int>(lineEnd - lineBegin)));
+          filter->setErrorCondition(-1, ss);
+          return -1;
         }
-        for(auto i = 2; i < tokens.size(); i += 4)
+        const char* p = skipValue(skipValue(params, lineEnd), lineEnd);
+        size_t numHatches = (numValues - 2) / 4;
+        for(size_t i = 0; i < 2 * numHatches; i++)
         {
-          for(auto j = 0; j < 4; j++)
+          float x = 0.0f;
+          float y = 0.0f;
+          p = parseValue(p, lineEnd, x);
+          p = nullptr == p ? nullptr : parseValue(p, lineEnd, y);
+          if(nullptr == p)
           {
-            float val = tokens.at(i + j).toFloat(&ok);
-            if(!ok)
-            {
-              QString ss = QObject::tr("Unable to parse hatch coordinate from CLI file line %1: %2").arg(lines).arg(QString::fromStdString(buf.toStdString()));
-              setErrorCondition(-1, ss);
-              return;
-            }
-            tmpVertices.push_back(val);
-            if(j % 2 != 0)
-            {
-              tmpVertices.push_back(layerHeight);
-            }
+            return parseError("hatch coordinate");
           }
+          builder.addPoint(x, y);
         }
-        int64_t numVerts = ((tokens.size() - 2) / 2);
-        int32_t edgeCounter = 0;
-        for(auto i = vertexCounter; i < (vertexCounter + numVerts); i += 2)
-        {
-          tmpEdges.push_back(i);
-          tmpEdges.push_back(i + 1);
-          edgeCounter++;
-        }
-        vertexCounter += numVerts;
-        for(auto i = 0; i < edgeCounter; i++)
-        {
-          tmpLayerIds.push_back(layer);
-          tmpFeatureIds.push_back(features);
-        }
+        builder.closeHatches(numHatches);
       }
     }
-    lines++;
   }
+  return 0;
+}
 
-  tmpVertices.shrink_to_fit();
-  tmpEdges.shrink_to_fit();
-  tmpLayerIds.shrink_to_fit();
-  tmpFeatureIds.shrink_to_fit();
+/**
+ * @brief Reads the binary layer, polyline and hatch commands of a CLI file
+ * @return Negative error code if the file could not be parsed
+ */
+int32_t readBinaryGeometry(ImportCLIFile* filter, const char* begin, const char* end, CLIGeometryBuilder& builder)
+{
+  CLIBinaryReader reader(begin, end);
+  const auto truncated = [filter]() {
+    QString ss = QObject::tr("The binary section of the CLI file is truncated");
+    filter->setErrorCondition(-2, ss);
+    return -2;
+  };
+  const auto negativeCount = [filter]() {
+    QString ss = QObject::tr("The binary section of the CLI file contains a negative point or hatch count");
+    filter->setErrorCondition(-4, ss);
+    return -4;
+  };
 
+  while(!reader.atEnd())
+  {
+    if(filter->getCancel())
+    {
+      return 0;
+    }
+    if(!reader.canRead(sizeof(uint16_t)))
+    {
+      return truncated();
+    }
+    uint16_t command = reader.read<uint16_t>();
+    switch(static_cast<CLIBinaryCommand>(command))
+    {
+    case CLIBinaryCommand::LayerLong:
+    case CLIBinaryCommand::LayerShort:
+    {
+      bool longFormat = command == static_cast<uint16_t>(CLIBinaryCommand::LayerLong);
+      if(!reader.canRead(longFormat ? sizeof(float) : sizeof(uint16_t)))
+      {
+        return truncated();
+      }
+      builder.startLayer(reader.readCoordinate(longFormat));
+      break;
+    }
+    case CLIBinaryCommand::PolylineLong:
+    case CLIBinaryCommand::PolylineShort:
+    {
+      bool longFormat = command == static_cast<uint16_t>(CLIBinaryCommand::PolylineLong);
+      size_t intSize = longFormat ? sizeof(int32_t) : sizeof(uint16_t);
+      size_t coordSize = longFormat ? sizeof(float) : sizeof(uint16_t);
+      if(!reader.canRead(3 * intSize))
+      {
+        return truncated();
+      }
+      // id and direction are not used
+      size_t numPoints = 0;
+      reader.readCount(longFormat, numPoints);
+      reader.readCount(longFormat, numPoints);
+      if(!reader.readCount(longFormat, numPoints))
+      {
+        return negativeCount();
+      }
+      if(!reader.canRead(2 * numPoints * coordSize))
+      {
+        return truncated();
+      }
+      if(numPoints == 0)
+      {
+        break;
+      }
+      builder.startFeature();
+      // The last point repeats the first one and closes the contour
+      for(size_t i = 0; i < numPoints - 1; i++)
+      {
+        float x = reader.readCoordinate(longFormat);
+        float y = reader.readCoordinate(longFormat);
+        builder.addPoint(x, y);
+      }
+      reader.readCoordinate(longFormat);
+      reader.readCoordinate(longFormat);
+      builder.closePolyline(numPoints - 1);
+      break;
+    }
+    case CLIBinaryCommand::HatchesLong:
+    case CLIBinaryCommand::HatchesShort:
+    {
+      bool longFormat = command == static_cast<uint16_t>(CLIBinaryCommand::HatchesLong);
+      size_t intSize = longFormat ? sizeof(int32_t) : sizeof(uint16_t);
+      size_t coordSize = longFormat ? sizeof(float) : sizeof(uint16_t);
+      if(!reader.canRead(2 * intSize))
+      {
+        return truncated();
+      }
+      // id is not used
+      size_t numHatches = 0;
+      reader.readCount(longFormat, numHatches);
+      if(!reader.readCount(longFormat, numHatches))
+      {
+        return negativeCount();
+      }
+      if(!reader.canRead(4 * numHatches * coordSize))
+      {
+        return truncated();
+      }
+      if(numHatches == 0)
+      {
+        break;
+      }
+      builder.startFeature();
+      for(size_t i = 0; i < 2 * numHatches; i++)
+      {
+        float x = reader.readCoordinate(longFormat);
+        float y = reader.readCoordinate(longFormat);
+        builder.addPoint(x, y);
+      }
+      builder.closeHatches(numHatches);
+      break;
+    }
+    default:
+    {
+      QString ss = QObject::tr("Unknown binary CLI command %1").arg(command);
+      filter->setErrorCondition(-3, ss);
+      return -3;
+    }
+    }
+  }
+  return 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportCLIFile::execute()
+{
+  initialize();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  TextParsingHelpers::MappedFile mappedFile(getCLIFile());
+  if(!mappedFile.isValid())
+  {
+    QString ss = QObject::tr("Input CLI file could not be opened: %1").arg(getCLIFile());
+    setErrorCondition(-100, ss);
+    return;
+  }
+
+  CLIGeometryBuilder builder;
+  float units = 1.0f;
+  const char* binaryStart = nullptr;
+  TextParsingHelpers::LineScanner scanner(mappedFile.begin(), mappedFile.end());
+  if(readASCIIGeometry(this, scanner, builder, units, binaryStart) < 0)
+  {
+    return;
+  }
+  if(nullptr != binaryStart && readBinaryGeometry(this, binaryStart, mappedFile.end(), builder) < 0)
+  {
+    return;
+  }
+  if(getCancel())
+  {
+    return;
+  }
+
+  std::vector<float>& tmpVertices = builder.vertices();
   std::transform(std::begin(tmpVertices), std::end(tmpVertices), std::begin(tmpVertices), [&](float val) { return val * units; });
 
   EdgeGeom::Pointer edge = getDataContainerArray()->getDataContainer(m_EdgeDataContainerName)->getGeometryAs<EdgeGeom>();
   edge->resizeVertexList(tmpVertices.size() / 3);
-  edge->resizeEdgeList(tmpEdges.size() / 2);
+  edge->resizeEdgeList(builder.edges().size() / 2);
   float* verts = edge->getVertexPointer(0);
   MeshIndexType* edges = edge->getEdgePointer(0);
+
   std::memcpy(verts, tmpVertices.data(), 3 * edge->getNumberOfVertices() * sizeof(float));
-  std::memcpy(edges, tmpEdges.data(), 2 * edge->getNumberOfEdges() * sizeof(int64_t));
+  std::memcpy(edges, builder.edges().data(), 2 * edge->getNumberOfEdges() * sizeof(MeshIndexType));
 
   AttributeMatrix::Pointer edgeAttrMat = getDataContainerArray()->getDataContainer(m_EdgeDataContainerName)->getAttributeMatrix(m_EdgeAttributeMatrixName);
   AttributeMatrix::Pointer vertAttrMat = getDataContainerArray()->getDataContainer(m_EdgeDataContainerName)->getAttributeMatrix(m_VertexAttributeMatrixName);
@@ -330,10 +660,12 @@ void ImportCLIFile::execute()
   edgeAttrMat->resizeAttributeArrays(tDims);
   tDims[0] = edge->getNumberOfVertices();
   vertAttrMat->resizeAttributeArrays(tDims);
+
   int32_t* layerIds = edgeAttrMat->getAttributeArrayAs<Int32ArrayType>(m_LayerIdsArrayName)->getPointer(0);
   int32_t* featureIds = edgeAttrMat->getAttributeArrayAs<Int32ArrayType>(m_FeatureIdsArrayName)->getPointer(0);
-  std::memcpy(layerIds, tmpLayerIds.data(), edge->getNumberOfEdges() * sizeof(int32_t));
-  std::memcpy(featureIds, tmpFeatureIds.data(), edge->getNumberOfEdges() * sizeof(int32_t));
+
+  std::memcpy(layerIds, builder.layerIds().data(), edge->getNumberOfEdges() * sizeof(int32_t));
+  std::memcpy(featureIds, builder.featureIds().data(), edge->getNumberOfEdges() * sizeof(int32_t));
 
   notifyStatusMessage("Complete");
 }
@@ -541,9 +541,38 @@ void InsertTransformationPhases::insertTransformationPhases()
   SIMPL_RANDOMNG_NEW()
 
   size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
-  // int64_t totalPoints = static_cast<size_t>(m_FeatureIdsPtr.lock()->getNumberOfTuples());
+  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   std::vector<size_t> tDims(1, 1);
 
+  // Index the cells of every feature once with a counting sort over the feature ids, so that
+  // placing a plate only visits the cells of its parent. Placing a plate or a peninsula only
+  // relabels cells of the current parent, so the index stays valid for the features after it.
+  m_FeatureCellOffsets.assign(totalFeatures + 1, 0);
+  for(size_t i = 0; i < totalPoints; ++i)
+  {
+    int32_t featureId = m_FeatureIds[i];
+    if(featureId > 0 && static_cast<size_t>(featureId) < totalFeatures)
+    {
+      ++m_FeatureCellOffsets[featureId + 1];
+    }
+  }
+  for(size_t i = 0; i < totalFeatures; ++i)
+  {
+    m_FeatureCellOffsets[i + 1] += m_FeatureCellOffsets[i];
+  }
+  m_FeatureCells.resize(m_FeatureCellOffsets[totalFeatures]);
+  {
+    std::vector<size_t> fillPositions(m_FeatureCellOffsets.begin(), m_FeatureCellOffsets.end() - 1);
+    for(size_t i = 0; i < totalPoints; ++i)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      if(featureId > 0 && static_cast<size_t>(featureId) < totalFeatures)
+      {
+        m_FeatureCells[fillPositions[featureId]++] = i;
+      }
+    }
+  }
+
   // find the minimum resolution
   FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
   float minRes = spacing[0];
@@ -684,12 +713,16 @@ void InsertTransformationPhases::insertTransformationPhases()
           minPos = i;
         }
       }
-      // assign our symmetry matrix to that which produced the minimum angle
+      // assign our symmetry matrix to that which produced the minimum angle; the transformation
+      // phase takes the symmetry reduced orientation
       orientOps->getMatSymOp(minPos, symMat);
       MatrixMath::Multiply3x3with3x3(symMat, newMatCopy, newMat);
-      OrientationF eOut = OrientationTransformation::om2eu<OrientationF, OrientationF>(OrientationF(symMat));
+      OrientationF eOut = OrientationTransformation::om2eu<OrientationF, OrientationF>(OrientationF(newMat));
 
       QuatF q2 = OrientationTransformation::eu2qu<OrientationF, QuatF>(eOut);
+      e[0] = eOut[0];
+      e[1] = eOut[1];
+      e[2] = eOut[2];
 
       // define plate = user input fraction of eq dia centered at centroid
       // NOTE: we multiply by 0.5 because the transformation phase thickness will be established by
@@ -774,6 +807,9 @@ void InsertTransformationPhases::insertTransformationPhases()
       }
     }
   }
+
+  m_FeatureCellOffsets = std::vector<size_t>();
+  m_FeatureCells = std::vector<size_t>();
 }
 
 // -----------------------------------------------------------------------------
@@ -782,118 +818,44 @@ void InsertTransformationPhases::insertTransformationPhases()
 bool InsertTransformationPhases::placeTransformationPhase(int32_t curFeature, float sampleHabitPlane[3], int32_t totalFeatures, float plateThickness, float d, float* euler)
 {
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName());
-  SIMPL_RANDOMNG_NEW()
 
-  // size_t totalPoints = static_cast<size_t>(m_FeatureIdsPtr.lock()->getNumberOfTuples());
-  int xPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getXPoints());
-  int yPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getYPoints());
-  int zPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getZPoints());
+  size_t xPoints = m->getGeometryAs<ImageGeom>()->getXPoints();
+  size_t yPoints = m->getGeometryAs<ImageGeom>()->getYPoints();
   FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
+  int32_t transformationPhase = static_cast<int32_t>(m_PhaseTypesPtr.lock()->getNumberOfTuples() - 1);
   bool flag = false;
-  float x, y, z, D;
-  bool firstVoxel = true;
 
-  // loop through all cells to find matching grain IDs
-  int zStride, yStride;
-  for(int i = 0; i < zPoints; i++)
+  // scale the plane once so the cell-plane distance is a single dot product per cell
+  float denom = 1 / sqrtf(sampleHabitPlane[0] * sampleHabitPlane[0] + sampleHabitPlane[1] * sampleHabitPlane[1] + sampleHabitPlane[2] * sampleHabitPlane[2]);
+  float planeX = sampleHabitPlane[0] * spacing[0] * denom;
+  float planeY = sampleHabitPlane[1] * spacing[1] * denom;
+  float planeZ = sampleHabitPlane[2] * spacing[2] * denom;
+  float planeOffset = d * denom;
+
+  // loop through the cells of the current feature that have not been taken by a transformation phase
+  for(size_t n = m_FeatureCellOffsets[curFeature]; n < m_FeatureCellOffsets[curFeature + 1]; ++n)
   {
-    zStride = i * xPoints * yPoints;
-    for(int j = 0; j < yPoints; j++)
+    size_t cellIndex = m_FeatureCells[n];
+    if(m_FeatureIds[cellIndex] != curFeature)
     {
-      yStride = j * xPoints;
-      for(int k = 0; k < xPoints; k++)
-      {
-        int32_t gnum = m_FeatureIds[zStride + yStride + k];
-        x = float(k) * spacing[0];
-        y = float(j) * spacing[1];
-        z = float(i) * spacing[2];
+      continue;
+    }
+    float x = static_cast<float>(cellIndex % xPoints);
+    float y = static_cast<float>((cellIndex / xPoints) % yPoints);
+    float z = static_cast<float>(cellIndex / (xPoints * yPoints));
 
-        // if the grain IDs match...
-        if(gnum == curFeature)
-        {
-          // calculate the distance between the cell and the plane
-          float denom = 1 / sqrtf(sampleHabitPlane[0] * sampleHabitPlane[0] + sampleHabitPlane[1] * sampleHabitPlane[1] + sampleHabitPlane[2] * sampleHabitPlane[2]);
-
-          D = sampleHabitPlane[0] * x * denom + sampleHabitPlane[1] * y * denom + sampleHabitPlane[2] * z * denom + d * denom;
-
-          // if the cell-plane distance is less than the plate thickness then place a transformation phase voxel
-          // and that a neighboring cell is not a transformation phase cell
-          if(std::fabs(D) < plateThickness)
-          ////      && (k == 0 || m_FeatureIds[zStride+yStride+k-1] < numFeatures || m_FeatureIds[zStride+yStride+k-1] == totalFeatures)
-          ////      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || m_FeatureIds[zStride+yStride+k+1] < numFeatures || m_FeatureIds[zStride+yStride+k+1] == totalFeatures)
-          ////      && (j == 0 || m_FeatureIds[zStride+yStride+k-xPoints] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints] == totalFeatures)
-          ////      && (j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || m_FeatureIds[zStride+yStride+k+xPoints] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints] == totalFeatures)
-          ////      && (i == 0 || m_FeatureIds[zStride+yStride+k-xPoints*yPoints] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints*yPoints] == totalFeatures)
-          ////      && (i == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1) || m_FeatureIds[zStride+yStride+k+xPoints*yPoints] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints*yPoints] ==
-          /// totalFeatures))
-          //      && (k == 0 || j == 0 || m_FeatureIds[zStride+yStride+k-xPoints-1] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints-1] == totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == 0 || m_FeatureIds[zStride+yStride+k-xPoints+1] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints+1] ==
-          //      totalFeatures)
-          //      && (k == 0 || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || m_FeatureIds[zStride+yStride+k+xPoints-1] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints-1] ==
-          //      totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || m_FeatureIds[zStride+yStride+k+xPoints+1] < numFeatures ||
-          //      m_FeatureIds[zStride+yStride+k+xPoints+1] == totalFeatures)
-          //      && (k == 0 || j == 0 || i == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1) || m_FeatureIds[zStride+yStride+k+xPoints*yPoints-xPoints-1] < numFeatures ||
-          //      m_FeatureIds[zStride+yStride+k+xPoints*yPoints-xPoints-1] == totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == 0 || i == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1) ||
-          //      m_FeatureIds[zStride+yStride+k+xPoints*yPoints-xPoints+1] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints*yPoints-xPoints+1] == totalFeatures)
-          //      && (k == 0 || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || i == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1) ||
-          //      m_FeatureIds[zStride+yStride+k+xPoints*yPoints+xPoints-1] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints*yPoints+xPoints-1] == totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || i == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1) ||
-          //      m_FeatureIds[zStride+yStride+k+xPoints*yPoints+xPoints+1] < numFeatures || m_FeatureIds[zStride+yStride+k+xPoints*yPoints+xPoints+1] == totalFeatures)
-          //      && (k == 0 || j == 0 || i == 0 || m_FeatureIds[zStride+yStride+k-xPoints*yPoints-xPoints-1] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints*yPoints-xPoints-1] ==
-          //      totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == 0 || i == 0 || m_FeatureIds[zStride+yStride+k-xPoints*yPoints-xPoints+1] < numFeatures ||
-          //      m_FeatureIds[zStride+yStride+k-xPoints*yPoints-xPoints+1] == totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || i == 0 ||
-          //      m_FeatureIds[zStride+yStride+k-xPoints*yPoints+xPoints-1] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints*yPoints+xPoints-1] == totalFeatures)
-          //      && (k == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1) || j == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1) || i == 0 ||
-          //      m_FeatureIds[zStride+yStride+k-xPoints*yPoints+xPoints+1] < numFeatures || m_FeatureIds[zStride+yStride+k-xPoints*yPoints+xPoints+1] == totalFeatures))
-          {
-            // check if an "island" transformation phase voxel will be placed (excluding the first voxel placement)
-            /*
-            if ((k == 0 || m_FeatureIds[zStride+yStride+k-1] != totalFeatures)
-            && (k == (xPoints - 1) || m_FeatureIds[zStride+yStride+k+1] != totalFeatures)
-            && (j == 0 || m_FeatureIds[zStride+yStride+k-xPoints] != totalFeatures)
-            && (j == (yPoints - 1) || m_FeatureIds[zStride+yStride+k+xPoints] != totalFeatures)
-            && (i == 0 || m_FeatureIds[zStride+yStride+k-xPoints*yPoints] != totalFeatures)
-            && (i == (zPoints - 1) || m_FeatureIds[zStride+yStride+k+xPoints*yPoints] != totalFeatures)
-            && firstVoxel == false)
-            {
-            // if an "island" transformation phase voxel is inserted flip all the transformation phase voxels back to the grain ID
-            // and this will go in the books as a failed transformation phase insertion attempt
-            for (int64_t l = 0; l < totalPoints; ++l)
-            {
-            if (m_FeatureIds[l] == totalFeatures)
-            {
-            //        int goal = m_FeatureIds[l];
-            m_FeatureIds[l] = curFeature;
-            //        int one = m_FeatureIds[zStride+yStride+k+xPoints*yPoints];
-            //        int two =  m_FeatureIds[zStride+yStride+k-xPoints*yPoints];
-            //        int three = m_FeatureIds[zStride+yStride+k+xPoints];
-            //        int four = m_FeatureIds[zStride+yStride+k-xPoints];
-            //        int five = m_FeatureIds[zStride+yStride+k+1];
-            //        int six = m_FeatureIds[zStride+yStride+k-1];
-            int stop = 0;
-            }
-            }
-            flag = false;
-            }
-            else
-            {
-            */
-            size_t cellIndex = static_cast<size_t>(zStride + yStride + k);
-            m_FeatureIds[cellIndex] = static_cast<int32_t>(totalFeatures);
-            m_CellEulerAngles[cellIndex * 3] = euler[0];
-            m_CellEulerAngles[cellIndex * 3 + 1] = euler[1];
-            m_CellEulerAngles[cellIndex * 3 + 2] = euler[2];
-            m_CellPhases[cellIndex] = static_cast<int32_t>(m_PhaseTypesPtr.lock()->getNumberOfTuples() - 1);
-            flag = true;
-            firstVoxel = false;
-            //    }
-          }
-        }
-      }
+    // calculate the distance between the cell and the plane
+    float D = planeX * x + planeY * y + planeZ * z + planeOffset;
+
+    // if the cell-plane distance is less than the plate thickness then place a transformation phase voxel
+    if(std::fabs(D) < plateThickness)
+    {
+      m_FeatureIds[cellIndex] = totalFeatures;
+      m_CellEulerAngles[cellIndex * 3] = euler[0];
+      m_CellEulerAngles[cellIndex * 3 + 1] = euler[1];
+      m_CellEulerAngles[cellIndex * 3 + 2] = euler[2];
+      m_CellPhases[cellIndex] = transformationPhase;
+      flag = true;
     }
   }
   return flag;
@@ -906,40 +868,39 @@ void InsertTransformationPhases::peninsulaTransformationPhase(int32_t curFeature
 {
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName());
   SIMPL_RANDOMNG_NEW()
-  int32_t xPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getXPoints());
-  int32_t yPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getYPoints());
-  int32_t zPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getZPoints());
+  size_t xPoints = m->getGeometryAs<ImageGeom>()->getXPoints();
+  size_t yPoints = m->getGeometryAs<ImageGeom>()->getYPoints();
 
   int32_t x1 = -1, x2 = -1, y1 = -1, y2 = -1, z1 = -1, z2 = -1;
   float transformationPhaseLength = 0.0f, random = 0.0f, fractionKept = 0.0f, currentDistance = 0.0f;
-  int32_t zStride, yStride;
 
-  // loop through all cells to find matching grain IDs
-  for(int32_t i = 0; i < zPoints; i++)
+  // the transformation phase was cut out of the current feature, so only its cells need to be visited
+  const size_t cellsBegin = m_FeatureCellOffsets[curFeature];
+  const size_t cellsEnd = m_FeatureCellOffsets[curFeature + 1];
+  const auto cellCoordinates = [&](size_t cellIndex, int32_t& i, int32_t& j, int32_t& k) {
+    i = static_cast<int32_t>(cellIndex / (xPoints * yPoints));
+    j = static_cast<int32_t>((cellIndex / xPoints) % yPoints);
+    k = static_cast<int32_t>(cellIndex % xPoints);
+  };
+
+  int32_t i = 0, j = 0, k = 0;
+  for(size_t n = cellsBegin; n < cellsEnd; ++n)
   {
-    zStride = i * xPoints * yPoints;
-    for(int32_t j = 0; j < yPoints; j++)
+    // if the grain IDs match...
+    if(m_FeatureIds[m_FeatureCells[n]] == totalFeatures)
     {
-      yStride = j * xPoints;
-      for(int32_t k = 0; k < xPoints; k++)
+      cellCoordinates(m_FeatureCells[n], i, j, k);
+      if(x1 == -1)
       {
-        int32_t gnum = m_FeatureIds[zStride + yStride + k];
-        // if the grain IDs match...
-        if(gnum == totalFeatures)
-        {
-          if(x1 == -1)
-          {
-            // establish one extremum of the transformation phase
-            x1 = i;
-            y1 = j;
-            z1 = k;
-          }
-          // establish the other extremum of the transformation phase
-          x2 = i;
-          y2 = j;
-          z2 = k;
-        }
+        // establish one extremum of the transformation phase
+        x1 = i;
+        y1 = j;
+        z1 = k;
       }
+      // establish the other extremum of the transformation phase
+      x2 = i;
+      y2 = j;
+      z2 = k;
     }
   }
 
@@ -968,25 +929,18 @@ void InsertTransformationPhases::peninsulaTransformationPhase(int32_t curFeature
   }
 
   // loop through again to decide which transformation phase Ids get flipped back to grain Ids
-  for(int32_t i = 0; i < zPoints; i++)
+  for(size_t n = cellsBegin; n < cellsEnd; ++n)
   {
-    zStride = i * xPoints * yPoints;
-    for(int32_t j = 0; j < yPoints; j++)
+    size_t cellIndex = m_FeatureCells[n];
+    // if the grain IDs match...
+    if(m_FeatureIds[cellIndex] == totalFeatures)
     {
-      yStride = j * xPoints;
-      for(int32_t k = 0; k < xPoints; k++)
+      cellCoordinates(cellIndex, i, j, k);
+      currentDistance = sqrtf((i - x1) * (i - x1) + (j - y1) * (j - y1) + (k - z1) * (k - z1));
+      // if the distance is longer than the transformation phase length, flip back to the parent ID
+      if(currentDistance > transformationPhaseLength * fractionKept)
       {
-        int gnum = m_FeatureIds[zStride + yStride + k];
-        // if the grain IDs match...
-        if(gnum == totalFeatures)
-        {
-          currentDistance = sqrtf((i - x1) * (i - x1) + (j - y1) * (j - y1) + (k - z1) * (k - z1));
-          // if the distance is longer than the transformation phase length, flip back to the parent ID
-          if(currentDistance > transformationPhaseLength * fractionKept)
-          {
-            m_FeatureIds[zStride + yStride + k] = curFeature;
-          }
-        }
+        m_FeatureIds[cellIndex] = curFeature;
       }
     }
   }
@@ -593,6 +593,11 @@ private:
 
   FloatVec3Type m_NormalizedTransformationPhaseHabitPlane;
 
+  // Cells of every parent feature in ascending order while transformation phases are inserted:
+  // the cells of feature i are m_FeatureCells[m_FeatureCellOffsets[i]] ... m_FeatureCells[m_FeatureCellOffsets[i + 1] - 1]
+  std::vector<size_t> m_FeatureCellOffsets;
+  std::vector<size_t> m_FeatureCells;
+
   /**
    * @brief updateFeatureInstancePointers
    */
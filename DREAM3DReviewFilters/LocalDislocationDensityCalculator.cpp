@@ -35,6 +35,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "LocalDislocationDensityCalculator.h"
 
+#include <array>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -49,9 +52,9 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
-#include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SegmentRasterization.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -297,10 +300,6 @@ void LocalDislocationDensityCalculator::execute()
   halfCellSize[0] = (m_CellSize[0] / 2.0f);
   halfCellSize[1] = (m_CellSize[1] / 2.0f);
   halfCellSize[2] = (m_CellSize[2] / 2.0f);
-  FloatVec3Type quarterCellSize;
-  quarterCellSize[0] = (m_CellSize[0] / 4.0f);
-  quarterCellSize[1] = (m_CellSize[1] / 4.0f);
-  quarterCellSize[2] = (m_CellSize[2] / 4.0f);
 
   vdc->getGeometryAs<ImageGeom>()->setOrigin(std::make_tuple(xMin, yMin, zMin));
   size_t dcDims[3];
@@ -322,94 +321,35 @@ void LocalDislocationDensityCalculator::execute()
       FloatArrayType::CreateArray(12 * m_OutputArrayPtr.lock()->getNumberOfTuples(), std::string("INDIVIDUAL_SYSTEM_LENGTHS_INTERNAL_USE_ONLY"), true);
   float* m_IndividualSystemLengths = m_IndividualSystemLengthsPtr->getPointer(0);
 
-  float point1[3], point2[3], corner1[3], corner2[3];
-  size_t xCellMin, xCellMax;
-  size_t yCellMin, yCellMax;
-  size_t zCellMin, zCellMax;
-  float x1, y1, z1, x2, y2, z2;
-  size_t zStride, yStride, point;
-  float length;
-  int32_t system = 0;
+  // The slip system only depends on the edge, so it is classified once per edge
+  std::vector<int32_t> systems(numEdges, 0);
   for(size_t i = 0; i < numEdges; i++)
   {
-    point1[0] = nodes[3 * edge[2 * i + 0] + 0];
-    point1[1] = nodes[3 * edge[2 * i + 0] + 1];
-    point1[2] = nodes[3 * edge[2 * i + 0] + 2];
-    point2[0] = nodes[3 * edge[2 * i + 1] + 0];
-    point2[1] = nodes[3 * edge[2 * i + 1] + 1];
-    point2[2] = nodes[3 * edge[2 * i + 1] + 2];
-    x1 = (point1[0] - xMin);
-    y1 = (point1[1] - yMin);
-    z1 = (point1[2] - zMin);
-    x2 = (point2[0] - xMin);
-    y2 = (point2[1] - yMin);
-    z2 = (point2[2] - zMin);
-    if(x1 > x2)
-    {
-      xCellMin = size_t(x2 / quarterCellSize[0]), xCellMax = size_t(x1 / quarterCellSize[0]);
-    }
-    else
-    {
-      xCellMin = size_t(x1 / quarterCellSize[0]), xCellMax = size_t(x2 / quarterCellSize[0]);
-    }
-    if(y1 > y2)
-    {
-      yCellMin = size_t(y2 / quarterCellSize[1]), yCellMax = size_t(y1 / quarterCellSize[1]);
-    }
-    else
-    {
-      yCellMin = size_t(y1 / quarterCellSize[1]), yCellMax = size_t(y2 / quarterCellSize[1]);
-    }
-    if(z1 > z2)
-    {
-      zCellMin = size_t(z2 / quarterCellSize[2]), zCellMax = size_t(z1 / quarterCellSize[2]);
-    }
-    else
-    {
-      zCellMin = size_t(z1 / quarterCellSize[2]), zCellMax = size_t(z2 / quarterCellSize[2]);
-    }
-    xCellMin = (xCellMin - 1) / 2;
-    yCellMin = (yCellMin - 1) / 2;
-    zCellMin = (zCellMin - 1) / 2;
-    xCellMax = ((xCellMax - 1) / 2) + 1;
-    yCellMax = ((yCellMax - 1) / 2) + 1;
-    zCellMax = ((zCellMax - 1) / 2) + 1;
-    if(xCellMax >= tDims[0])
-    {
-      xCellMax = tDims[0] - 1;
-    }
-    if(yCellMax >= tDims[1])
-    {
-      yCellMax = tDims[1] - 1;
-    }
-    if(zCellMax >= tDims[2])
+    systems[i] = determine_slip_system(static_cast<int>(i));
+  }
+
+  // Accumulate the length of every segment inside the cell sized window around each voxel
+  std::array<double, 3> origin = {xMin, yMin, zMin};
+  std::array<double, 3> spacing = {halfCellSize[0], halfCellSize[1], halfCellSize[2]};
+  std::array<int64_t, 3> dims = {static_cast<int64_t>(tDims[0]), static_cast<int64_t>(tDims[1]), static_cast<int64_t>(tDims[2])};
+  const auto endpoints = [&](size_t i, std::array<double, 3>& point1, std::array<double, 3>& point2) {
+    for(size_t a = 0; a < 3; a++)
     {
-      zCellMax = tDims[2] - 1;
+      point1[a] = nodes[3 * edge[2 * i + 0] + a];
+      point2[a] = nodes[3 * edge[2 * i + 1] + a];
     }
-    for(size_t j = zCellMin; j <= zCellMax; j++)
+  };
+  const auto deposit = [&](size_t i, size_t point, double length) {
+    m_OutputArray[point] += static_cast<float>(length);
+    // Edges that do not belong to one of the 12 systems only count towards the total density
+    if(systems[i] < 12)
     {
-      zStride = j * tDims[0] * tDims[1];
-      corner1[2] = (j * halfCellSize[2]) - halfCellSize[2] + quarterCellSize[2] + zMin;
-      corner2[2] = (j * halfCellSize[2]) + halfCellSize[2] + quarterCellSize[2] + zMin;
-      for(size_t k = yCellMin; k <= yCellMax; k++)
-      {
-        yStride = k * tDims[0];
-        corner1[1] = (k * halfCellSize[1]) - halfCellSize[1] + quarterCellSize[1] + yMin;
-        corner2[1] = (k * halfCellSize[1]) + halfCellSize[1] + quarterCellSize[1] + yMin;
-        for(size_t l = xCellMin; l <= xCellMax; l++)
-        {
-          corner1[0] = (l * halfCellSize[0]) - halfCellSize[0] + quarterCellSize[0] + xMin;
-          corner2[0] = (l * halfCellSize[0]) + halfCellSize[0] + quarterCellSize[0] + xMin;
-          length = GeometryMath::LengthOfRayInBox(point1, point2, corner1, corner2);
-          point = (zStride + yStride + l);
-          m_OutputArray[point] += length;
-          system = determine_slip_system(i);
-          m_IndividualSystemLengths[12 * point + system] += length;
-        }
-      }
+      m_IndividualSystemLengths[12 * point + systems[i]] += static_cast<float>(length);
     }
-  }
+  };
+  SegmentRasterization::rasterizeOverlappingWindows(numEdges, endpoints, origin, spacing, dims, deposit);
 
+  size_t zStride, yStride, point;
   float cellVolume = m_CellSize[0] * m_CellSize[1] * m_CellSize[2];
   for(size_t j = 0; j < tDims[2]; j++)
   {
@@ -36,6 +36,8 @@
 
 #include "ParaDisReader.h"
 
+#include <algorithm>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -48,8 +50,9 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
-#include "SIMPLib/Math/MatrixMath.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ParaDisParsing.hpp"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsingHelpers.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -158,10 +161,6 @@ void ParaDisReader::updateEdgeInstancePointers()
 // -----------------------------------------------------------------------------
 void ParaDisReader::initialize()
 {
-  if(m_InStream.isOpen())
-  {
-    m_InStream.close();
-  }
   m_NumVerts = -1;
   m_NumEdges = -1;
   m_FileVersion = 0;
@@ -246,16 +245,9 @@ void ParaDisReader::dataCheck()
     m_DomainBounds = m_DomainBoundsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
-  if(m_InStream.isOpen())
-  {
-    m_InStream.close();
-  }
-
   if(!getInputFile().isEmpty() && fi.exists())
   {
-    // We need to read the header of the input file to get the dimensions
-    m_InStream.setFileName(getInputFile());
-    if(!m_InStream.open(QIODevice::ReadOnly | QIODevice::Text))
+    if(!fi.isReadable())
     {
       QString ss = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(getInputFile());
       setErrorCondition(-100, ss);
@@ -282,139 +274,77 @@ void ParaDisReader::dataCheck()
 // -----------------------------------------------------------------------------
 void ParaDisReader::execute()
 {
-  int err = 0;
-
   dataCheck();
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  m_InStream.setFileName(getInputFile());
-  if(!m_InStream.open(QIODevice::ReadOnly | QIODevice::Text))
+  readFile();
+}
+
+//-----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParaDisReader::readHeader()
+{
+  TextParsingHelpers::MappedFile mappedFile(getInputFile());
+  if(!mappedFile.isValid())
   {
     QString ss = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(getInputFile());
     setErrorCondition(-100, ss);
-    return;
+    return -100;
   }
 
-  err = readHeader();
-  if(err < 0)
+  TextParsingHelpers::LineScanner scanner(mappedFile.begin(), mappedFile.end());
+  ParaDisParsing::Snapshot snapshot;
+  return parseHeader(scanner, snapshot);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParaDisReader::readFile()
+{
+  TextParsingHelpers::MappedFile mappedFile(getInputFile());
+  if(!mappedFile.isValid())
   {
-    m_InStream.close();
-    return;
+    QString ss = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(getInputFile());
+    setErrorCondition(-100, ss);
+    return -100;
   }
-  err = readFile();
-  m_InStream.close();
+
+  TextParsingHelpers::LineScanner scanner(mappedFile.begin(), mappedFile.end());
+  ParaDisParsing::Snapshot snapshot;
+  int err = parseHeader(scanner, snapshot);
   if(err < 0)
   {
-    return;
+    return err;
   }
+  return parseNodes(scanner, snapshot);
 }
 
 //-----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int ParaDisReader::readHeader()
+int ParaDisReader::parseHeader(TextParsingHelpers::LineScanner& scanner, ParaDisParsing::Snapshot& snapshot)
 {
-  QString ss;
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getEdgeDataContainerName());
   AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
 
   // convert user input Burgers Vector to microns from angstroms
   float burgersVec = m_BurgersVector / 10000.0f;
 
-  int error = 0;
-
-  QByteArray buf;
-  QList<QByteArray> tokens; /* vector to store the split data */
-
-  bool ok = false;
-  // Process the header information
-  // bool done = false;
-  // read Version line
-  buf = m_InStream.readLine();
-  buf = buf.trimmed();
-  buf = buf.simplified();
-  tokens = buf.split(' ');
-  m_FileVersion = tokens[2].toInt(&ok, 10);
-
-  int keepgoing = 1;
-  // read until get to minCoordinates line
-  while(keepgoing == 1)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("minCoordinates") == 0)
-    {
-      for(int32_t i = 0; i < 3; i++)
-      {
-        buf = m_InStream.readLine();
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        m_DomainBounds[i] = tokens[0].toFloat(&ok) * burgersVec;
-      }
-      keepgoing = 0;
-    }
-  }
-  keepgoing = 1;
-  // read until get to maxCoordinates line
-  while(keepgoing == 1)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("maxCoordinates") == 0)
-    {
-      for(int32_t i = 3; i < 6; i++)
-      {
-        buf = m_InStream.readLine();
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        m_DomainBounds[i] = tokens[0].toFloat(&ok) * burgersVec;
-      }
-      keepgoing = 0;
-    }
-  }
-  keepgoing = 1;
-  // read until get to nodeCount line
-  while(keepgoing == 1)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("nodeCount") == 0)
-    {
-      m_NumVerts = tokens[2].toInt(&ok, 10);
-      keepgoing = 0;
-    }
-  }
-  keepgoing = 1;
-  // read until get to nodalData line
-  while(keepgoing == 1)
+  QString ss;
+  int32_t err = ParaDisParsing::readHeader(scanner, burgersVec, getInputFile(), snapshot, ss);
+  if(err < 0)
   {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("nodalData") == 0)
-    {
-      // read nodal Data lines
-      buf = m_InStream.readLine();
-      buf = m_InStream.readLine();
-      keepgoing = 0;
-    }
+    setErrorCondition(err, ss);
+    return err;
   }
+  m_FileVersion = snapshot.fileVersion;
+  m_NumVerts = snapshot.numVerts;
+  std::copy(snapshot.domainBounds.begin(), snapshot.domainBounds.end(), m_DomainBounds);
 
   EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
   edgeGeom->resizeVertexList(m_NumVerts);
@@ -423,139 +353,39 @@ int ParaDisReader::readHeader()
   vertexAttrMat->resizeAttributeArrays(tDims);
   updateVertexInstancePointers();
 
-  return error;
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int ParaDisReader::readFile()
+int ParaDisReader::parseNodes(TextParsingHelpers::LineScanner& scanner, ParaDisParsing::Snapshot& snapshot)
 {
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getEdgeDataContainerName());
   AttributeMatrix::Pointer edgeAttrMat = m->getAttributeMatrix(getEdgeAttributeMatrixName());
 
-  QByteArray buf;
-  QList<QByteArray> tokens;    /* vector to store the split data */
-  QList<QByteArray> subTokens; /* vector to store the split data */
-
-  EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
-  edgeGeom->resizeVertexList(m_NumVerts);
-
-  float* vertex = edgeGeom->getVertexPointer(0);
-  m_NumVerts = edgeGeom->getNumberOfVertices();
-
-  bool ok = false;
-
-  int nodeNum = 0;
-  int neighborNode = 0;
-  m_NumEdges = 0;
-  int nodeCounter = 0;
-  uint64_t* ptr64;
-
-  QMap<int64_t, int32_t> vertNumbers;
-  struct
-  {
-    int32_t n1;
-    int32_t n2;
-  } uniqueNodeId;
-
-  QVector<int> firstNodes;
-  QVector<int> secondNodes;
-  QVector<float> burgerXs;
-  QVector<float> burgerYs;
-  QVector<float> burgerZs;
-  float burgVec[3];
-  QVector<float> spnXs;
-  QVector<float> spnYs;
-  QVector<float> spnZs;
-  float spNorm[3];
-
   // convert user input Burgers Vector to microns from angstroms
   float burgersVec = m_BurgersVector / 10000.0f;
 
-  for(int j = 0; j < m_NumVerts; j++)
+  QString ss;
+  int32_t err = ParaDisParsing::readNodes(scanner, burgersVec, getInputFile(), [this] { return getCancel(); }, snapshot, ss);
+  if(err < 0)
   {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    subTokens = tokens[0].split(',');
-    uniqueNodeId.n1 = subTokens[0].toInt(&ok, 10);
-    uniqueNodeId.n2 = subTokens[1].toInt(&ok, 10);
-    ptr64 = reinterpret_cast<uint64_t*>(&uniqueNodeId);
-    nodeNum = vertNumbers.value(*ptr64, -1);
-    if(nodeNum == -1)
-    {
-      nodeNum = nodeCounter;
-      vertex[3 * nodeNum + 0] = tokens[1].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 1] = tokens[2].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 2] = tokens[3].toFloat(&ok) * burgersVec;
-      m_NumberOfArms[nodeNum] = tokens[4].toInt(&ok, 10);
-      m_NodeConstraints[nodeNum] = tokens[5].toInt(&ok, 10);
-      vertNumbers.insert(*ptr64, nodeNum);
-      nodeCounter++;
-    }
-    else
-    {
-      vertex[3 * nodeNum + 0] = tokens[1].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 1] = tokens[2].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 2] = tokens[3].toFloat(&ok) * burgersVec;
-      m_NumberOfArms[nodeNum] = tokens[4].toInt(&ok, 10);
-      m_NodeConstraints[nodeNum] = tokens[5].toInt(&ok, 10);
-    }
-    if(m_FileVersion >= 5)
-    {
-      buf = m_InStream.readLine();
-    }
-    for(int k = 0; k < m_NumberOfArms[nodeNum]; k++)
-    {
-      buf = m_InStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      subTokens = tokens[0].split(',');
-      uniqueNodeId.n1 = subTokens[0].toInt(&ok, 10);
-      uniqueNodeId.n2 = subTokens[1].toInt(&ok, 10);
-      ptr64 = reinterpret_cast<uint64_t*>(&uniqueNodeId);
-      neighborNode = vertNumbers.value(*ptr64, -1);
-      if(neighborNode == -1)
-      {
-        neighborNode = nodeCounter;
-        vertNumbers.insert(*ptr64, neighborNode);
-        nodeCounter++;
-      }
-      if(neighborNode > nodeNum)
-      {
-        m_NumEdges++;
-        firstNodes.push_back(nodeNum);
-        secondNodes.push_back(neighborNode);
-        burgVec[0] = tokens[1].toFloat(&ok);
-        burgVec[1] = tokens[2].toFloat(&ok);
-        burgVec[2] = tokens[3].toFloat(&ok);
-        // burgVec[0] = tokens[1].toFloat(&ok) * burgersVec;
-        // burgVec[1] = tokens[2].toFloat(&ok) * burgersVec;
-        // burgVec[2] = tokens[3].toFloat(&ok) * burgersVec;
-        burgerXs.push_back(burgVec[0]);
-        burgerYs.push_back(burgVec[1]);
-        burgerZs.push_back(burgVec[2]);
-      }
-      buf = m_InStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      if(neighborNode > nodeNum)
-      {
-        spNorm[0] = tokens[0].toFloat(&ok);
-        spNorm[1] = tokens[1].toFloat(&ok);
-        spNorm[2] = tokens[2].toFloat(&ok);
-        MatrixMath::Normalize3x1(spNorm);
-        spnXs.push_back(spNorm[0]);
-        spnYs.push_back(spNorm[1]);
-        spnZs.push_back(spNorm[2]);
-      }
-    }
+    setErrorCondition(err, ss);
+    return err;
+  }
+  if(getCancel())
+  {
+    return 0;
   }
 
+  EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
+  edgeGeom->resizeVertexList(m_NumVerts);
+  std::copy(snapshot.vertices.begin(), snapshot.vertices.end(), edgeGeom->getVertexPointer(0));
+  std::copy(snapshot.numberOfArms.begin(), snapshot.numberOfArms.end(), m_NumberOfArms);
+  std::copy(snapshot.nodeConstraints.begin(), snapshot.nodeConstraints.end(), m_NodeConstraints);
+
+  m_NumEdges = static_cast<int>(snapshot.numEdges());
   edgeGeom->resizeEdgeList(m_NumEdges);
   MeshIndexType* edge = edgeGeom->getEdgePointer(0);
 
@@ -564,20 +394,9 @@ int ParaDisReader::readFile()
   edgeAttrMat->resizeAttributeArrays(tDims);
   updateEdgeInstancePointers();
 
-  for(int i = 0; i < m_NumEdges; i++)
-  {
-    edge[2 * i + 0] = firstNodes[i];
-    edge[2 * i + 1] = secondNodes[i];
-    m_BurgersVectors[3 * i + 0] = burgerXs[i];
-    m_BurgersVectors[3 * i + 1] = burgerYs[i];
-    m_BurgersVectors[3 * i + 2] = burgerZs[i];
-    m_SlipPlaneNormals[3 * i + 0] = spnXs[i];
-    m_SlipPlaneNormals[3 * i + 1] = spnYs[i];
-    m_SlipPlaneNormals[3 * i + 2] = spnZs[i];
-  }
-
-  tokens.clear();
-  m_InStream.close();
+  std::copy(snapshot.edges.begin(), snapshot.edges.end(), edge);
+  std::copy(snapshot.burgersVectors.begin(), snapshot.burgersVectors.end(), m_BurgersVectors);
+  std::copy(snapshot.slipPlaneNormals.begin(), snapshot.slipPlaneNormals.end(), m_SlipPlaneNormals);
 
   return 0;
 }
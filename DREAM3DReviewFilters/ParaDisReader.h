@@ -38,7 +38,6 @@
 
 #include <memory>
 
-#include <QtCore/QFile>
 #include <QtCore/QString>
 #include <vector>
 
@@ -54,6 +53,15 @@
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewDLLExport.h"
 
+namespace TextParsingHelpers
+{
+class LineScanner;
+}
+namespace ParaDisParsing
+{
+struct Snapshot;
+}
+
 /**
  * @class ParaDisReader ParaDisReader.h DREAM3DLib/IO/ParaDisReader.h
  * @brief
@@ -274,13 +282,13 @@ protected:
   ParaDisReader();
 
   /**
-   * @brief readHeader
+   * @brief readHeader Reads the header of the input file
    * @return
    */
   int readHeader() override;
 
   /**
-   * @brief readFile
+   * @brief readFile Reads the header and the nodes of the input file
    * @return
    */
   int readFile() override;
@@ -305,6 +313,20 @@ protected:
    */
   void updateEdgeInstancePointers();
 
+  /**
+   * @brief parseHeader Parses the header at the scanner position into the snapshot and
+   * sizes the vertex geometry and arrays
+   * @return
+   */
+  int parseHeader(TextParsingHelpers::LineScanner& scanner, ParaDisParsing::Snapshot& snapshot);
+
+  /**
+   * @brief parseNodes Parses the nodes that follow the header and fills the vertex and
+   * edge geometry and arrays
+   * @return
+   */
+  int parseNodes(TextParsingHelpers::LineScanner& scanner, ParaDisParsing::Snapshot& snapshot);
+
 private:
   std::weak_ptr<DataArray<int32_t>> m_NumberOfArmsPtr;
   int32_t* m_NumberOfArms = nullptr;
@@ -328,8 +350,6 @@ private:
   QString m_SlipPlaneNormalsArrayName = {SIMPL::EdgeData::SlipPlaneNormals};
   QString m_DomainBoundsArrayName = {"DomainBounds"};
 
-  QFile m_InStream;
-
   int m_NumVerts;
   int m_NumEdges;
 
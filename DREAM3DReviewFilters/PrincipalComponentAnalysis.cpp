@@ -34,6 +34,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "PrincipalComponentAnalysis.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <Eigen/Core>
 #include <Eigen/Eigen>
 
@@ -54,6 +57,7 @@
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -220,22 +224,186 @@ void PrincipalComponentAnalysis::dataCheck()
   getDataContainerArray()->validateNumberOfTuples(this, paths);
 }
 
+namespace
+{
+// Tuples per block; a block of every selected array is converted to double and
+// centered in a small buffer, so the data are never copied as a whole
+constexpr size_t k_BlockSize = 256;
+// Tuples per accumulation chunk; the chunk layout only depends on the input size,
+// so the results do not depend on the number of threads
+constexpr size_t k_ChunkSize = 65536;
+// Upper bound on the number of doubles held by the per chunk co-moment matrices
+constexpr size_t k_MaxChunkValues = 1ULL << 24;
+
+using ReadColumnFunc = void (*)(const void*, size_t, size_t, double*);
+
+/**
+ * @brief Type erased view of one selected array
+ */
+struct Column
+{
+  const void* data = nullptr;
+  ReadColumnFunc read = nullptr;
+};
+
+/**
+ * @brief Converts count values of a column starting at tuple start to double
+ */
+template <typename T>
+void readColumn(const void* data, size_t start, size_t count, double* values)
+{
+  const T* dPtr = static_cast<const T*>(data) + start;
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = static_cast<double>(dPtr[i]);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataArrays(IDataArray::Pointer dataPtr, std::vector<double>& copy, int32_t arrayIndex)
+void appendColumn(IDataArray::Pointer dataPtr, std::vector<Column>& columns)
 {
   typename DataArray<T>::Pointer inDataPtr = std::dynamic_pointer_cast<DataArray<T>>(dataPtr);
-  T* dPtr = inDataPtr->getPointer(0);
-  size_t numTuples = inDataPtr->getNumberOfTuples();
+  columns.push_back({inDataPtr->getPointer(0), &readColumn<T>});
+}
 
-  for(size_t i = 0; i < numTuples; i++)
+/**
+ * @brief Loads count tuples of every column into a column major count x columns.size() block
+ */
+void loadBlock(const std::vector<Column>& columns, size_t start, size_t count, double* block)
+{
+  for(size_t c = 0; c < columns.size(); c++)
   {
-    copy[numTuples * arrayIndex + i] = static_cast<double>(dPtr[i]);
+    columns[c].read(columns[c].data, start, count, block + c * count);
   }
 }
 
+/**
+ * @brief Count, means and co-moment matrix (the sum of the outer products of the
+ * centered tuples) of a set of tuples. Two sets are merged with the pairwise update
+ * of Chan, Golub & LeVeque, which stays accurate when the means are large compared
+ * to the spread.
+ */
+struct Moments
+{
+  size_t count = 0;
+  Eigen::VectorXd mean;
+  Eigen::MatrixXd comoment;
+
+  explicit Moments(size_t numColumns = 0)
+  : mean(Eigen::VectorXd::Zero(numColumns))
+  , comoment(Eigen::MatrixXd::Zero(numColumns, numColumns))
+  {
+  }
+
+  void merge(const Moments& other)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(count == 0)
+    {
+      *this = other;
+      return;
+    }
+    double total = static_cast<double>(count + other.count);
+    Eigen::VectorXd delta = other.mean - mean;
+    mean += delta * (static_cast<double>(other.count) / total);
+    comoment += other.comoment;
+    comoment.noalias() += delta * delta.transpose() * (static_cast<double>(count) * static_cast<double>(other.count) / total);
+    count += other.count;
+  }
+};
+
+/**
+ * @brief Accumulates the moments of a range of chunks block by block
+ */
+class AccumulateMomentsImpl
+{
+public:
+  AccumulateMomentsImpl(const std::vector<Column>& columns, size_t numTuples, size_t chunkSize, std::vector<Moments>& chunkMoments)
+  : m_Columns(columns)
+  , m_NumTuples(numTuples)
+  , m_ChunkSize(chunkSize)
+  , m_ChunkMoments(chunkMoments)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t numColumns = m_Columns.size();
+    std::vector<double> buffer(k_BlockSize * numColumns);
+    Moments block(numColumns);
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t chunkEnd = std::min(m_NumTuples, (chunk + 1) * m_ChunkSize);
+      Moments& moments = m_ChunkMoments[chunk];
+      for(size_t start = chunk * m_ChunkSize; start < chunkEnd; start += k_BlockSize)
+      {
+        size_t count = std::min(k_BlockSize, chunkEnd - start);
+        loadBlock(m_Columns, start, count, buffer.data());
+        Eigen::Map<Eigen::MatrixXd> blockMat(buffer.data(), count, numColumns);
+        block.count = count;
+        block.mean = blockMat.colwise().mean().transpose();
+        blockMat.rowwise() -= block.mean.transpose();
+        block.comoment.noalias() = blockMat.transpose() * blockMat;
+        moments.merge(block);
+      }
+    }
+  }
+
+private:
+  const std::vector<Column>& m_Columns;
+  size_t m_NumTuples = 0;
+  size_t m_ChunkSize = 0;
+  std::vector<Moments>& m_ChunkMoments;
+};
+
+/**
+ * @brief Projects a range of tuples onto the principal components: every tuple is
+ * centered, divided by the per column scale and multiplied by the transform
+ */
+class ProjectDataImpl
+{
+public:
+  ProjectDataImpl(const std::vector<Column>& columns, const Eigen::VectorXd& mean, const Eigen::VectorXd& scale, const Eigen::MatrixXd& transform, double* projected)
+  : m_Columns(columns)
+  , m_Mean(mean)
+  , m_Scale(scale)
+  , m_Transform(transform)
+  , m_Projected(projected)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    size_t numColumns = m_Columns.size();
+    size_t numDims = static_cast<size_t>(m_Transform.cols());
+    std::vector<double> buffer(k_BlockSize * numColumns);
+    for(size_t start = range.min(); start < range.max(); start += k_BlockSize)
+    {
+      size_t count = std::min(k_BlockSize, range.max() - start);
+      loadBlock(m_Columns, start, count, buffer.data());
+      Eigen::Map<Eigen::MatrixXd> blockMat(buffer.data(), count, numColumns);
+      blockMat = (blockMat.rowwise() - m_Mean.transpose()).array().rowwise() / m_Scale.transpose().array();
+      Eigen::Map<RowMajorMatrix> projected(m_Projected + numDims * start, count, numDims);
+      projected.noalias() = blockMat * m_Transform;
+    }
+  }
+
+private:
+  const std::vector<Column>& m_Columns;
+  const Eigen::VectorXd& m_Mean;
+  const Eigen::VectorXd& m_Scale;
+  const Eigen::MatrixXd& m_Transform;
+  double* m_Projected = nullptr;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -254,58 +422,55 @@ void PrincipalComponentAnalysis::execute()
     return;
   }
 
-  // Set up our Eigen variables ; we use a dynamic double matrix since we don't know
-  // the number of arrays or their tuples at compile time ; could have just used the
-  // MatrixXd typedef instead of our own, but this is explicit about the ordering
-  // being column major
-  auto numArrays = m_SelectedWeakPtrVector.size();
+  size_t numArrays = m_SelectedWeakPtrVector.size();
   size_t numTuples = m_SelectedWeakPtrVector[0].lock()->getNumberOfTuples();
 
-  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> CovarianceMatrix;
-
-  // Copy the incoming data into a contiguous chunk of memory, casting everything to doubles
-  std::vector<double> inDataVector(numTuples * numArrays, 0);
-
-  for(auto i = 0; i < numArrays; i++)
+  // The selected arrays are read in place, one block of tuples at a time
+  std::vector<Column> columns;
+  columns.reserve(numArrays);
+  for(size_t i = 0; i < numArrays; i++)
   {
-    EXECUTE_FUNCTION_TEMPLATE(this, copyDataArrays, m_SelectedWeakPtrVector[i].lock(), m_SelectedWeakPtrVector[i].lock(), inDataVector, i)
+    EXECUTE_FUNCTION_TEMPLATE(this, appendColumn, m_SelectedWeakPtrVector[i].lock(), m_SelectedWeakPtrVector[i].lock(), columns)
   }
 
-  // Interface our CovarianceMatrix typedef with our contiguous array in memory
-  // Using a colum major matrix, so each array is a column, so the arrays should
-  // be layed out end-to-end in memory ; initialization for sizes in Eigen is:
-  // numRows x numColumns
-  Eigen::Map<CovarianceMatrix> dataMat(inDataVector.data(), numTuples, numArrays);
-
-  // If the correlation approach is being used, the data must be standardize to have
-  // mean 0 and unit variance
-  if(m_MatrixApproach == 0)
+  // Accumulate the means and the co-moment matrix in one parallel pass over
+  // fixed chunks, then merge the chunks pairwise
+  size_t maxChunks = std::max<size_t>(1, k_MaxChunkValues / (numArrays * numArrays));
+  size_t numChunks = std::min(std::max<size_t>(1, (numTuples + k_ChunkSize - 1) / k_ChunkSize), maxChunks);
+  size_t chunkSize = (numTuples + numChunks - 1) / numChunks;
+  std::vector<Moments> chunkMoments(numChunks, Moments(numArrays));
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute(AccumulateMomentsImpl(columns, numTuples, chunkSize, chunkMoments));
+  for(size_t stride = 1; stride < numChunks; stride *= 2)
   {
-    // Standardize data to have mean 0 and unit variance
-    dataMat = (dataMat.rowwise() - dataMat.colwise().mean());
-    Eigen::RowVectorXd stdDev = dataMat.colwise().squaredNorm();
-    for(auto i = 0; i < stdDev.cols(); i++)
+    for(size_t i = 0; i + stride < numChunks; i += 2 * stride)
     {
-      stdDev(i) /= dataMat.rows();
-      stdDev(i) = sqrt(stdDev(i));
+      chunkMoments[i].merge(chunkMoments[i + stride]);
     }
-    dataMat = dataMat.array().rowwise() / stdDev.array();
   }
+  const Moments& moments = chunkMoments[0];
 
-  // Calculate the covariance matrix using the matrix formulation, checking if
-  // tuples are 1 to avoid division by zero
-  // If correlation was chosen, then this is technically the correlation matrix,
-  // but since the means are zero in that case the centering operation is trivial
-  Eigen::MatrixXd centeredMat = dataMat.rowwise() - dataMat.colwise().mean();
-  Eigen::MatrixXd covMat;
+  if(getCancel())
+  {
+    return;
+  }
 
-  if(numTuples == 1)
+  // If the correlation approach is being used, the data are standardized to have
+  // mean 0 and unit (population) variance; this only rescales the co-moments
+  Eigen::VectorXd scale = Eigen::VectorXd::Ones(numArrays);
+  if(m_MatrixApproach == 0)
   {
-    covMat = (centeredMat.adjoint() * centeredMat) / (1.0);
+    scale = (moments.comoment.diagonal() / static_cast<double>(numTuples)).cwiseSqrt();
   }
-  else
+
+  // Calculate the covariance matrix from the co-moments, checking if tuples are 1
+  // to avoid division by zero
+  // If correlation was chosen, then this is technically the correlation matrix
+  Eigen::MatrixXd covMat = moments.comoment.array() / (scale * scale.transpose()).array();
+  if(numTuples > 1)
   {
-    covMat = (centeredMat.adjoint() * centeredMat) / (double(numTuples - 1.0));
+    covMat /= static_cast<double>(numTuples - 1);
   }
 
   // Perform the eigen decomposition to get the eigenvectors and eigenvalues
@@ -333,16 +498,9 @@ void PrincipalComponentAnalysis::execute()
     // the rightmost columns equal to the number of projective dimensions
     Eigen::MatrixXd transform = pca.eigenvectors().rightCols(m_NumberOfDimensionsForProjection);
 
-    // Multiply each row in the centered data matrix by transform and copy the projected
-    // points into the DataArray pointer
-    for(auto i = 0; i < centeredMat.rows(); i++)
-    {
-      Eigen::VectorXd tmp = centeredMat.row(i) * transform;
-      for(int32_t j = 0; j < m_NumberOfDimensionsForProjection; j++)
-      {
-        m_ProjectedDataSpace[m_NumberOfDimensionsForProjection * i + j] = tmp(j);
-      }
-    }
+    // Multiply each centered (and standardized) tuple by transform, block by block
+    dataAlg.setRange(0, numTuples);
+    dataAlg.execute(ProjectDataImpl(columns, moments.mean, scale, transform, m_ProjectedDataSpace));
   }
 }
 
@@ -49,6 +49,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/StreamCompaction.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -199,26 +200,14 @@ void RemoveFlaggedVertices::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataToMaskedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t> maskPoints)
+void copyDataToMaskedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const StreamCompaction::IndexMap& maskPoints)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
   typename DataArray<T>::Pointer maskedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
   T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
   T* maskedData = static_cast<T*>(maskedDataPtr->getPointer(0));
 
-  size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
-
-  for(std::vector<int64_t>::size_type i = 0; i < maskPoints.size(); i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
-    {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * maskPoints[i] + d;
-      maskedData[tmpIndex] = inputData[ptrIndex];
-    }
-  }
+  StreamCompaction::copyTuples(maskPoints, inputData, maskedData, inDataPtr->getNumberOfComponents());
 }
 
 // -----------------------------------------------------------------------------
@@ -234,34 +223,17 @@ void RemoveFlaggedVertices::execute()
   }
 
   VertexGeom::Pointer vertex = getDataContainerArray()->getDataContainer(getVertexGeometry())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertex->getNumberOfVertices();
-  std::vector<int64_t> maskPoints;
-  maskPoints.reserve(m_MaskPtr.lock()->getNumberOfTuples());
-
-  for(int64_t i = 0; i < numVerts; i++)
-  {
-    if(!m_Mask[i])
-    {
-      maskPoints.push_back(i);
-    }
-  }
-
-  maskPoints.shrink_to_fit();
+  size_t numVerts = vertex->getNumberOfVertices();
+  StreamCompaction::IndexMap maskPoints = StreamCompaction::compact(numVerts, [this](size_t vert) { return !m_Mask[vert]; });
 
   DataContainer::Pointer reduced = getDataContainerArray()->getDataContainer(getReducedVertexGeometry());
   VertexGeom::Pointer reducedVertex = reduced->getGeometryAs<VertexGeom>();
-  reducedVertex->resizeVertexList(maskPoints.size());
-  float coords[3] = {0.0f, 0.0f, 0.0f};
-
-  for(std::vector<int64_t>::size_type i = 0; i < maskPoints.size(); i++)
-  {
-    vertex->getCoords(maskPoints[i], coords);
-    reducedVertex->setCoords(i, coords);
-  }
+  reducedVertex->resizeVertexList(maskPoints.numKept);
+  StreamCompaction::copyTuples(maskPoints, vertex->getVertexPointer(0), reducedVertex->getVertexPointer(0), 3);
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getVertexGeometry());
   AttributeMatrix::Type tempAttrMatType = AttributeMatrix::Type::Vertex;
-  std::vector<size_t> tDims(1, maskPoints.size());
+  std::vector<size_t> tDims(1, maskPoints.numKept);
 
   for(auto&& attr_mat : m_AttrMatList)
   {
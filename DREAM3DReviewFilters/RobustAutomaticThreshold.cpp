@@ -34,6 +34,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "RobustAutomaticThreshold.h"
 
+#include <array>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -43,9 +46,13 @@
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/RobustThresholding.hpp"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
@@ -54,6 +61,13 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
+namespace
+{
+// A tile whose gradient weight is below this fraction of the mean tile weight has no
+// edge of its own and falls back to the global threshold
+const double k_MinimumTileWeight = 0.1;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -75,8 +89,29 @@ void RobustAutomaticThreshold::setupFilterParameters()
   FilterParameterVectorType parameters;
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to Threshold", InputArrayPath, FilterParameter::Category::RequiredArray, RobustAutomaticThreshold, dasReq));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Gradient Magnitude Source");
+    parameter->setPropertyName("GradientSource");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(RobustAutomaticThreshold, this, GradientSource));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(RobustAutomaticThreshold, this, GradientSource));
+
+    std::vector<QString> choices;
+    choices.push_back("Gradient Magnitude Array");
+    choices.push_back("Compute from Input Array");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps;
+    linkedProps.push_back("GradientMagnitudeArrayPath");
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  std::vector<QString> linkedProps = {"TileSize"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Local Thresholds", UseLocalThresholds, FilterParameter::Category::Parameter, RobustAutomaticThreshold, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Tile Size (Voxels)", TileSize, FilterParameter::Category::Parameter, RobustAutomaticThreshold));
   dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Float, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
-  parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Gradient Magnitude", GradientMagnitudeArrayPath, FilterParameter::Category::RequiredArray, RobustAutomaticThreshold, dasReq));
+  parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Gradient Magnitude", GradientMagnitudeArrayPath, FilterParameter::Category::RequiredArray, RobustAutomaticThreshold, dasReq, 0));
   DataArrayCreationFilterParameter::RequirementType dacReq = DataArrayCreationFilterParameter::CreateRequirement(AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Mask", FeatureIdsArrayPath, FilterParameter::Category::RequiredArray, RobustAutomaticThreshold, dacReq));
   setFilterParameters(parameters);
@@ -91,6 +126,9 @@ void RobustAutomaticThreshold::readFilterParameters(AbstractFilterParametersRead
   setInputArrayPath(reader->readDataArrayPath("InputArrayPath", getInputArrayPath()));
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
   setGradientMagnitudeArrayPath(reader->readDataArrayPath("GradientMagnitudeArrayPath", getGradientMagnitudeArrayPath()));
+  setGradientSource(reader->readValue("GradientSource", getGradientSource()));
+  setUseLocalThresholds(reader->readValue("UseLocalThresholds", getUseLocalThresholds()));
+  setTileSize(reader->readIntVec3("TileSize", getTileSize()));
   reader->closeFilterGroup();
 }
 
@@ -132,14 +170,42 @@ void RobustAutomaticThreshold::dataCheck()
     dataArrayPaths.push_back(getInputArrayPath());
   }
 
-  m_GradientMagnitudePtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getGradientMagnitudeArrayPath(), cDims);
-  if(m_GradientMagnitudePtr.lock())
+  if(getGradientSource() == 0)
   {
-    m_GradientMagnitude = m_GradientMagnitudePtr.lock()->getPointer(0);
+    m_GradientMagnitudePtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getGradientMagnitudeArrayPath(), cDims);
+    if(m_GradientMagnitudePtr.lock())
+    {
+      m_GradientMagnitude = m_GradientMagnitudePtr.lock()->getPointer(0);
+    }
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getGradientMagnitudeArrayPath());
+    }
   }
-  if(getErrorCode() >= 0)
+
+  // Computing the gradient and tiling the volume both need the grid the values live on
+  if(getGradientSource() == 1 || getUseLocalThresholds())
   {
-    dataArrayPaths.push_back(getGradientMagnitudeArrayPath());
+    ImageGeom::Pointer image = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom>(this, getInputArrayPath().getDataContainerName());
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    if(m_InputArrayPtr.lock()->getNumberOfTuples() != image->getNumberOfElements())
+    {
+      QString ss = QObject::tr("Computing the gradient or using local thresholds requires the Attribute Array to threshold to hold one value per cell of the Image Geometry (%1 values, %2 cells)")
+                       .arg(m_InputArrayPtr.lock()->getNumberOfTuples())
+                       .arg(image->getNumberOfElements());
+      setErrorCondition(-11002, ss);
+      return;
+    }
+  }
+
+  if(getUseLocalThresholds() && (m_TileSize[0] <= 0 || m_TileSize[1] <= 0 || m_TileSize[2] <= 0))
+  {
+    QString ss = QObject::tr("The tile size must be positive along every axis");
+    setErrorCondition(-11003, ss);
+    return;
   }
 
   m_FeatureIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>>(this, getFeatureIdsArrayPath(), false, cDims, "", DataArrayID31);
@@ -159,36 +225,32 @@ void RobustAutomaticThreshold::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void findThreshold(IDataArray::Pointer inputPtr, const FloatArrayType::Pointer& gradMagPtr, const BoolArrayType::Pointer& maskPtr)
+void findThreshold(IDataArray::Pointer inputPtr, const float* gradMag, const RobustThresholding::Volume& volume, bool useLocalThresholds, const std::array<size_t, 3>& tileSize, bool* mask)
 {
   typename DataArray<T>::Pointer input = std::dynamic_pointer_cast<DataArray<T>>(inputPtr);
-  T* iPtr = input->getPointer(0);
-  float* gradMag = gradMagPtr->getPointer(0);
-  bool* mask = maskPtr->getPointer(0);
+  const T* iPtr = input->getPointer(0);
 
-  size_t numTuples = input->getNumberOfTuples();
-  float numerator = 0;
-  float denominator = 0;
-
-  for(size_t i = 0; i < numTuples; i++)
+  RobustThresholding::Tiling tiling = useLocalThresholds ? RobustThresholding::Tiling(volume, tileSize) : RobustThresholding::globalTiling(volume);
+  std::vector<RobustThresholding::WeightedSum> sums;
+  if(nullptr != gradMag)
   {
-    numerator += (iPtr[i] * gradMag[i]);
-    denominator += gradMag[i];
+    sums = RobustThresholding::accumulate(iPtr, RobustThresholding::GradientArray(gradMag), volume, tiling);
+  }
+  else
+  {
+    sums = RobustThresholding::accumulate(iPtr, RobustThresholding::CentralDifference<T>(iPtr, volume), volume, tiling);
   }
 
-  float threshold = numerator / denominator;
-
-  for(size_t i = 0; i < numTuples; i++)
+  std::vector<float> thresholds;
+  if(useLocalThresholds)
   {
-    if(iPtr[i] < threshold)
-    {
-      mask[i] = false;
-    }
-    else
-    {
-      mask[i] = true;
-    }
+    thresholds = RobustThresholding::tileThresholds(sums, k_MinimumTileWeight);
+  }
+  else
+  {
+    thresholds.push_back(RobustThresholding::globalThreshold(sums));
   }
+  RobustThresholding::apply(iPtr, volume, tiling, thresholds, mask);
 }
 
 // -----------------------------------------------------------------------------
@@ -203,9 +265,24 @@ void RobustAutomaticThreshold::execute()
     return;
   }
 
-  // float threshold = 0.0f;
+  RobustThresholding::Volume volume;
+  volume.dims = {m_InputArrayPtr.lock()->getNumberOfTuples(), 1, 1};
+  if(getGradientSource() == 1 || getUseLocalThresholds())
+  {
+    ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(getInputArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
+    SizeVec3Type dims = image->getDimensions();
+    FloatVec3Type spacing = image->getSpacing();
+    for(size_t a = 0; a < 3; a++)
+    {
+      volume.dims[a] = dims[a];
+      volume.spacing[a] = spacing[a];
+    }
+  }
 
-  EXECUTE_FUNCTION_TEMPLATE_NO_BOOL(DataArray, this, findThreshold, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), m_GradientMagnitudePtr.lock(), m_FeatureIdsPtr.lock())
+  const float* gradMag = getGradientSource() == 0 ? m_GradientMagnitude : nullptr;
+  std::array<size_t, 3> tileSize = {static_cast<size_t>(m_TileSize[0]), static_cast<size_t>(m_TileSize[1]), static_cast<size_t>(m_TileSize[2])};
+
+  EXECUTE_FUNCTION_TEMPLATE_NO_BOOL(DataArray, this, findThreshold, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), gradMag, volume, getUseLocalThresholds(), tileSize, m_FeatureIds)
 }
 
 // -----------------------------------------------------------------------------
@@ -344,3 +421,39 @@ DataArrayPath RobustAutomaticThreshold::getGradientMagnitudeArrayPath() const
 {
   return m_GradientMagnitudeArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void RobustAutomaticThreshold::setGradientSource(int value)
+{
+  m_GradientSource = value;
+}
+
+// -----------------------------------------------------------------------------
+int RobustAutomaticThreshold::getGradientSource() const
+{
+  return m_GradientSource;
+}
+
+// -----------------------------------------------------------------------------
+void RobustAutomaticThreshold::setUseLocalThresholds(bool value)
+{
+  m_UseLocalThresholds = value;
+}
+
+// -----------------------------------------------------------------------------
+bool RobustAutomaticThreshold::getUseLocalThresholds() const
+{
+  return m_UseLocalThresholds;
+}
+
+// -----------------------------------------------------------------------------
+void RobustAutomaticThreshold::setTileSize(const IntVec3Type& value)
+{
+  m_TileSize = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type RobustAutomaticThreshold::getTileSize() const
+{
+  return m_TileSize;
+}
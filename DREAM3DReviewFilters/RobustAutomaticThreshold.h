@@ -39,6 +39,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IDataArray;
@@ -61,6 +62,9 @@ class DREAM3DReview_EXPORT RobustAutomaticThreshold : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath InputArrayPath READ getInputArrayPath WRITE setInputArrayPath)
   PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
   PYB11_PROPERTY(DataArrayPath GradientMagnitudeArrayPath READ getGradientMagnitudeArrayPath WRITE setGradientMagnitudeArrayPath)
+  PYB11_PROPERTY(int GradientSource READ getGradientSource WRITE setGradientSource)
+  PYB11_PROPERTY(bool UseLocalThresholds READ getUseLocalThresholds WRITE setUseLocalThresholds)
+  PYB11_PROPERTY(IntVec3Type TileSize READ getTileSize WRITE setTileSize)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -118,6 +122,39 @@ public:
   DataArrayPath getGradientMagnitudeArrayPath() const;
   Q_PROPERTY(DataArrayPath GradientMagnitudeArrayPath READ getGradientMagnitudeArrayPath WRITE setGradientMagnitudeArrayPath)
 
+  /**
+   * @brief Setter property for GradientSource
+   */
+  void setGradientSource(int value);
+  /**
+   * @brief Getter property for GradientSource
+   * @return Value of GradientSource
+   */
+  int getGradientSource() const;
+  Q_PROPERTY(int GradientSource READ getGradientSource WRITE setGradientSource)
+
+  /**
+   * @brief Setter property for UseLocalThresholds
+   */
+  void setUseLocalThresholds(bool value);
+  /**
+   * @brief Getter property for UseLocalThresholds
+   * @return Value of UseLocalThresholds
+   */
+  bool getUseLocalThresholds() const;
+  Q_PROPERTY(bool UseLocalThresholds READ getUseLocalThresholds WRITE setUseLocalThresholds)
+
+  /**
+   * @brief Setter property for TileSize
+   */
+  void setTileSize(const IntVec3Type& value);
+  /**
+   * @brief Getter property for TileSize
+   * @return Value of TileSize
+   */
+  IntVec3Type getTileSize() const;
+  Q_PROPERTY(IntVec3Type TileSize READ getTileSize WRITE setTileSize)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -203,6 +240,9 @@ private:
   DataArrayPath m_InputArrayPath = {"", "", ""};
   DataArrayPath m_FeatureIdsArrayPath = {"", "", "Mask"};
   DataArrayPath m_GradientMagnitudeArrayPath = {"", "", ""};
+  int m_GradientSource = {0};
+  bool m_UseLocalThresholds = {false};
+  IntVec3Type m_TileSize = {64, 64, 64};
 
 public:
   RobustAutomaticThreshold(const RobustAutomaticThreshold&) = delete;            // Copy Constructor Not Implemented
@@ -38,6 +38,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
@@ -56,6 +58,7 @@
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/Utilities/FilePathGenerator.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/Orientation.hpp"
@@ -253,6 +256,152 @@ public:
 private:
 };
 
+/**
+ * @brief Ellipsoid of one Feature and its clamped voxel bounding box
+ */
+struct EllipsoidExtent
+{
+  float radCur[3] = {0.0f, 0.0f, 0.0f};
+  float center[3] = {0.0f, 0.0f, 0.0f};
+  float ga[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+  int64_t xmin = 0;
+  int64_t xmax = -1;
+  int64_t ymin = 0;
+  int64_t ymax = -1;
+  int64_t zmin = 0;
+  int64_t zmax = -1;
+};
+
+/**
+ * @brief The AssignVoxelsSlabsImpl class assigns the voxels of a range of Z slabs. A slab only
+ * visits the Features binned into it, in Feature order, and only writes its own planes, so
+ * overlapping ellipsoids never write the same voxel concurrently and the largest ellipsoid
+ * function still wins exactly as in a serial pass over the Features.
+ */
+class AssignVoxelsSlabsImpl
+{
+public:
+  AssignVoxelsSlabsImpl(const int64_t* dims, const float* spacing, const float* size, ShapeOps::Pointer ellipsoidOps, const std::vector<EllipsoidExtent>& extents,
+                        const std::vector<int64_t>& slabBounds, const std::vector<size_t>& binOffsets, const std::vector<int32_t>& binFeatures, Int32ArrayType::Pointer newowners,
+                        FloatArrayType::Pointer ellipfuncs)
+  : m_EllipsoidOps(std::move(ellipsoidOps))
+  , m_Extents(extents)
+  , m_SlabBounds(slabBounds)
+  , m_BinOffsets(binOffsets)
+  , m_BinFeatures(binFeatures)
+  , m_NewOwnersPtr(std::move(newowners))
+  , m_EllipFuncsPtr(std::move(ellipfuncs))
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_Dims[i] = dims[i];
+      m_Spacing[i] = spacing[i];
+      m_Size[i] = size[i];
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int64_t dims[3] = {m_Dims[0], m_Dims[1], m_Dims[2]};
+    float spacing[3] = {m_Spacing[0], m_Spacing[1], m_Spacing[2]};
+    float size[3] = {m_Size[0], m_Size[1], m_Size[2]};
+    for(size_t slab = range.min(); slab < range.max(); slab++)
+    {
+      for(size_t k = m_BinOffsets[slab]; k < m_BinOffsets[slab + 1]; k++)
+      {
+        int32_t feature = m_BinFeatures[k];
+        EllipsoidExtent extent = m_Extents[feature];
+        int64_t zStart = std::max(extent.zmin, m_SlabBounds[slab]);
+        int64_t zEnd = std::min(extent.zmax + 1, m_SlabBounds[slab + 1]);
+        AssignVoxelsImpl assign(dims, spacing, extent.radCur, extent.center, m_EllipsoidOps, extent.ga, size, feature, m_NewOwnersPtr, m_EllipFuncsPtr);
+        assign.convert(zStart, zEnd, extent.ymin, extent.ymax + 1, extent.xmin, extent.xmax + 1);
+      }
+    }
+  }
+
+private:
+  int64_t m_Dims[3] = {0, 0, 0};
+  float m_Spacing[3] = {0.0f, 0.0f, 0.0f};
+  float m_Size[3] = {0.0f, 0.0f, 0.0f};
+  ShapeOps::Pointer m_EllipsoidOps;
+  const std::vector<EllipsoidExtent>& m_Extents;
+  const std::vector<int64_t>& m_SlabBounds;
+  const std::vector<size_t>& m_BinOffsets;
+  const std::vector<int32_t>& m_BinFeatures;
+  Int32ArrayType::Pointer m_NewOwnersPtr;
+  FloatArrayType::Pointer m_EllipFuncsPtr;
+};
+
+/**
+ * @brief The FindGapOwnersImpl class picks, for every unassigned voxel of the current frontier, the
+ * face neighbor whose Feature occurs most often among the 6 face neighbors (the first neighbor to
+ * reach the highest count wins ties). The Feature Ids are only read, so all frontier voxels see
+ * the state at the start of the cycle.
+ */
+class FindGapOwnersImpl
+{
+public:
+  FindGapOwnersImpl(const int32_t* featureIds, int32_t* neighbors, const std::vector<int64_t>& frontier, const int64_t* dims)
+  : m_FeatureIds(featureIds)
+  , m_Neighbors(neighbors)
+  , m_Frontier(frontier)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int64_t neighpoints[6] = {-m_Dims[0] * m_Dims[1], -m_Dims[0], -1, 1, m_Dims[0], m_Dims[0] * m_Dims[1]};
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      int64_t point = m_Frontier[i];
+      int64_t k = point % m_Dims[0];
+      int64_t j = (point / m_Dims[0]) % m_Dims[1];
+      int64_t plane = point / (m_Dims[0] * m_Dims[1]);
+      bool good[6] = {plane > 0, j > 0, k > 0, k < m_Dims[0] - 1, j < m_Dims[1] - 1, plane < m_Dims[2] - 1};
+
+      int32_t features[6] = {0, 0, 0, 0, 0, 0};
+      int32_t most = 0;
+      int32_t neighbor = -1;
+      for(int32_t l = 0; l < 6; l++)
+      {
+        if(!good[l])
+        {
+          continue;
+        }
+        int64_t neighpoint = point + neighpoints[l];
+        features[l] = m_FeatureIds[neighpoint];
+        if(features[l] <= 0)
+        {
+          continue;
+        }
+        int32_t current = 0;
+        for(int32_t m = 0; m <= l; m++)
+        {
+          if(features[m] == features[l])
+          {
+            current++;
+          }
+        }
+        if(current > most)
+        {
+          most = current;
+          neighbor = static_cast<int32_t>(neighpoint);
+        }
+      }
+      m_Neighbors[point] = neighbor;
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  int32_t* m_Neighbors = nullptr;
+  const std::vector<int64_t>& m_Frontier;
+  int64_t m_Dims[3] = {0, 0, 0};
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -886,24 +1035,12 @@ void TesselateFarFieldGrains::assign_voxels()
   ellipfuncsPtr->initializeWithValue(-1);
   float* ellipfuncs = ellipfuncsPtr->getPointer(0);
 
-  float featuresPerTime = 0;
-  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
-  uint64_t currentMillis = millis;
-
   int64_t totalFeatures = m->getAttributeMatrix(m_OutputCellFeatureAttributeMatrixName)->getNumberOfTuples();
+
+  // Compute the ellipsoid and the bounding box of every Feature up front
+  std::vector<EllipsoidExtent> extents(static_cast<size_t>(std::max<int64_t>(totalFeatures, 1)));
   for(int64_t i = 1; i < totalFeatures; i++)
   {
-    featuresPerTime++;
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if(currentMillis - millis > 1000)
-    {
-      float rate = featuresPerTime / ((float)(currentMillis - millis)) * 1000.0f;
-
-      QString ss = QObject::tr("Assign Voxels & Gaps|| Features Checked: %1 || Features/Second: %2").arg(i).arg((int)rate);
-      notifyStatusMessage(ss);
-      featuresPerTime = 0;
-      millis = QDateTime::currentMSecsSinceEpoch();
-    }
     float volcur = m_Volumes[i];
     float bovera = m_AxisLengths[3 * i + 1];
     float covera = m_AxisLengths[3 * i + 2];
@@ -925,58 +1062,82 @@ void TesselateFarFieldGrains::assign_voxels()
 
     radcur1 = m_EllipsoidOps->radcur1(shapeArgMap);
 
-    float radcur2 = (radcur1 * bovera);
-    float radcur3 = (radcur1 * covera);
-    float ga[3][3];
-    OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(&(m_AxisEulerAngles[3 * i]), 3)).toGMatrix(ga);
+    EllipsoidExtent& extent = extents[i];
+    extent.radCur[0] = radcur1;
+    extent.radCur[1] = radcur1 * bovera;
+    extent.radCur[2] = radcur1 * covera;
+    extent.center[0] = xc;
+    extent.center[1] = yc;
+    extent.center[2] = zc;
+    OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(&(m_AxisEulerAngles[3 * i]), 3)).toGMatrix(extent.ga);
     column = static_cast<int64_t>(xc / spacing[0]);
     row = static_cast<int64_t>(yc / spacing[1]);
     plane = static_cast<int64_t>(zc / spacing[2]);
     xmin = int(column - ((radcur1 / spacing[0]) + 1));
     xmax = int(column + ((radcur1 / spacing[0]) + 1));
-    ymin = int(row - ((radcur1 / spacing[1]) + 1));   // <======================
-    ymax = int(row + ((radcur1 / spacing[1]) + 1));   // <======================
-    zmin = int(plane - ((radcur1 / spacing[2]) + 1)); // <======================
-    zmax = int(plane + ((radcur1 / spacing[2]) + 1)); // <======================
+    ymin = int(row - ((radcur1 / spacing[1]) + 1));
+    ymax = int(row + ((radcur1 / spacing[1]) + 1));
+    zmin = int(plane - ((radcur1 / spacing[2]) + 1));
+    zmax = int(plane + ((radcur1 / spacing[2]) + 1));
+    extent.xmin = std::max<int64_t>(xmin, 0);
+    extent.xmax = std::min<int64_t>(xmax, dims[0] - 1);
+    extent.ymin = std::max<int64_t>(ymin, 0);
+    extent.ymax = std::min<int64_t>(ymax, dims[1] - 1);
+    extent.zmin = std::max<int64_t>(zmin, 0);
+    extent.zmax = std::min<int64_t>(zmax, dims[2] - 1);
+  }
 
-    if(xmin < 0)
-    {
-      xmin = 0;
-    }
-    if(xmax > dims[0] - 1)
-    {
-      xmax = dims[0] - 1;
-    }
-    if(ymin < 0)
+  if(getCancel())
+  {
+    return;
+  }
+
+  // Split the volume into Z slabs and bin every Feature into the slabs its bounding box
+  // overlaps. The bins keep the Features in ascending order, which preserves the tie
+  // breaking of the serial assignment.
+  size_t numSlabs = std::min<size_t>(static_cast<size_t>(dims[2]), 4 * std::max(1U, std::thread::hardware_concurrency()));
+  numSlabs = std::max<size_t>(numSlabs, 1);
+  std::vector<int64_t> slabBounds(numSlabs + 1);
+  for(size_t slab = 0; slab <= numSlabs; slab++)
+  {
+    slabBounds[slab] = static_cast<int64_t>((static_cast<size_t>(dims[2]) * slab) / numSlabs);
+  }
+  const auto slabOf = [&](int64_t z) { return static_cast<size_t>(std::upper_bound(slabBounds.begin() + 1, slabBounds.end(), z) - (slabBounds.begin() + 1)); };
+
+  std::vector<size_t> binOffsets(numSlabs + 1, 0);
+  for(int64_t i = 1; i < totalFeatures; i++)
+  {
+    if(extents[i].zmin > extents[i].zmax)
     {
-      ymin = 0;
+      continue;
     }
-    if(ymax > dims[1] - 1)
+    for(size_t slab = slabOf(extents[i].zmin); slab <= slabOf(extents[i].zmax); slab++)
     {
-      ymax = dims[1] - 1;
+      binOffsets[slab + 1]++;
     }
-    if(zmin < 0)
+  }
+  for(size_t slab = 0; slab < numSlabs; slab++)
+  {
+    binOffsets[slab + 1] += binOffsets[slab];
+  }
+  std::vector<int32_t> binFeatures(binOffsets[numSlabs]);
+  std::vector<size_t> binFill(binOffsets.begin(), binOffsets.end() - 1);
+  for(int64_t i = 1; i < totalFeatures; i++)
+  {
+    if(extents[i].zmin > extents[i].zmax)
     {
-      zmin = 0;
+      continue;
     }
-    if(zmax > dims[2] - 1)
+    for(size_t slab = slabOf(extents[i].zmin); slab <= slabOf(extents[i].zmax); slab++)
     {
-      zmax = dims[2] - 1;
+      binFeatures[binFill[slab]++] = static_cast<int32_t>(i);
     }
-
-    float radCur[3] = {radcur1, radcur2, radcur3};
-    float xx[3] = {xc, yc, zc};
-
-//#if 0
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    tbb::parallel_for(tbb::blocked_range3d<int, int, int>(zmin, zmax + 1, ymin, ymax + 1, xmin, xmax + 1),
-                      AssignVoxelsImpl(dims, spacing.data(), radCur, xx, m_EllipsoidOps, ga, size, i, newownersPtr, ellipfuncsPtr), tbb::auto_partitioner());
-#else
-    AssignVoxelsImpl serial(dims, spacing.data(), radCur, xx, m_EllipsoidOps, ga, size, i, newownersPtr, ellipfuncsPtr);
-    serial.convert(zmin, zmax + 1, ymin, ymax + 1, xmin, xmax + 1);
-#endif
   }
 
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute(AssignVoxelsSlabsImpl(dims, spacing.data(), size, m_EllipsoidOps, extents, slabBounds, binOffsets, binFeatures, newownersPtr, ellipfuncsPtr));
+
   QVector<bool> activeObjects(totalFeatures, false);
   int gnum;
   for(size_t i = 0; i < static_cast<size_t>(totalPoints); i++)
@@ -1031,158 +1192,93 @@ void TesselateFarFieldGrains::assign_gaps_only()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixName().getDataContainerName());
 
-  int featurename, feature;
-  int current = 0;
-  int most = 0;
-  int count = 1;
-  int fixedCount = 1;
-  int counter = 0;
-  int neighpoint;
-  int good;
-  int neighbor;
-
-  int xPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getXPoints());
-  int yPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getYPoints());
-  int zPoints = static_cast<int>(m->getGeometryAs<ImageGeom>()->getZPoints());
-  size_t totalPoints = m->getAttributeMatrix(m_OutputCellAttributeMatrixName.getAttributeMatrixName())->getNumberOfTuples();
-  size_t totalFeatures = m->getAttributeMatrix(m_OutputCellFeatureAttributeMatrixName)->getNumberOfTuples();
-
-  int neighpoints[6];
-  neighpoints[0] = -xPoints * yPoints;
-  neighpoints[1] = -xPoints;
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = xPoints;
-  neighpoints[5] = xPoints * yPoints;
+  SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
+  int64_t dims[3] = {static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2])};
+  int64_t totalPoints = static_cast<int64_t>(m->getAttributeMatrix(m_OutputCellAttributeMatrixName.getAttributeMatrixName())->getNumberOfTuples());
 
   Int32ArrayType::Pointer neighborsPtr = Int32ArrayType::CreateArray(m->getGeometryAs<ImageGeom>()->getNumberOfElements(), std::string("Neighbors"), true);
   neighborsPtr->initializeWithValue(-1);
   m_Neighbors = neighborsPtr->getPointer(0);
 
-  QVector<int> n(totalFeatures + 1, 0);
-  // uint64_t millis = QDateTime::currentMSecsSinceEpoch();
-  // uint64_t currentMillis = millis;
-
-  while(count != 0)
-  {
-    counter++;
-    count = 0;
-    fixedCount = 0;
-    int zStride, yStride;
-    for(int i = 0; i < zPoints; i++)
+  // Runs a callback for every face neighbor of a voxel that lies inside the volume
+  int64_t neighpoints[6] = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+  const auto forEachNeighbor = [&](int64_t point, const auto& callback) {
+    int64_t k = point % dims[0];
+    int64_t j = (point / dims[0]) % dims[1];
+    int64_t plane = point / (dims[0] * dims[1]);
+    bool good[6] = {plane > 0, j > 0, k > 0, k < dims[0] - 1, j < dims[1] - 1, plane < dims[2] - 1};
+    for(int32_t l = 0; l < 6; l++)
     {
-      zStride = i * xPoints * yPoints;
-      for(int j = 0; j < yPoints; j++)
+      if(good[l])
       {
-        yStride = j * xPoints;
-        for(int k = 0; k < xPoints; k++)
-        {
-          featurename = m_FeatureIds[zStride + yStride + k];
-          if(featurename < 0)
-          {
-            count++;
-            current = 0;
-            most = 0;
-            for(int l = 0; l < 6; l++)
-            {
-              good = 1;
-              neighpoint = zStride + yStride + k + neighpoints[l];
-              if(l == 0 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && i == (zPoints - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (yPoints - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && k == (xPoints - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = m_FeatureIds[neighpoint];
-                if(feature > 0)
-                {
-                  n[feature]++;
-                  current = n[feature];
-                  if(current > most)
-                  {
-                    most = current;
-                    m_Neighbors[zStride + yStride + k] = neighpoint;
-                  }
-                }
-              }
-            }
-            for(int l = 0; l < 6; l++)
-            {
-              good = 1;
-              neighpoint = zStride + yStride + k + neighpoints[l];
-              if(l == 0 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && i == (zPoints - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (yPoints - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && k == (xPoints - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = m_FeatureIds[neighpoint];
-                if(feature > 0)
-                {
-                  n[feature] = 0;
-                }
-              }
-            }
-          }
-        }
+        callback(point + neighpoints[l]);
       }
     }
-    for(size_t j = 0; j < totalPoints; j++)
+  };
+
+  // The dilation only changes voxels next to an assigned Feature, so each cycle only visits
+  // the frontier: the unassigned voxels that touch a Feature. The winning neighbors of the whole
+  // frontier are found in parallel against the Feature Ids of the previous cycle, then applied.
+  std::vector<int64_t> frontier;
+  int64_t remaining = 0;
+  for(int64_t i = 0; i < totalPoints; i++)
+  {
+    if(m_FeatureIds[i] >= 0)
+    {
+      continue;
+    }
+    remaining++;
+    bool touchesFeature = false;
+    forEachNeighbor(i, [&](int64_t neighpoint) { touchesFeature = touchesFeature || m_FeatureIds[neighpoint] > 0; });
+    if(touchesFeature)
     {
-      featurename = m_FeatureIds[j];
-      neighbor = m_Neighbors[j];
-      if(featurename < 0 && neighbor != -1 && m_FeatureIds[neighbor] > 0)
+      frontier.push_back(i);
+    }
+  }
+
+  // Cycle in which a voxel was last queued, so the next frontier holds every voxel once
+  std::vector<int32_t> queuedCycle(static_cast<size_t>(totalPoints), -1);
+  std::vector<int64_t> nextFrontier;
+  int32_t counter = 0;
+  while(!frontier.empty())
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    counter++;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, frontier.size());
+    dataAlg.execute(FindGapOwnersImpl(m_FeatureIds, m_Neighbors, frontier, dims));
+
+    for(int64_t point : frontier)
+    {
+      int32_t neighbor = m_Neighbors[point];
+      if(neighbor < 0)
       {
-        m_FeatureIds[j] = m_FeatureIds[neighbor];
-        m_CellPhases[j] = m_FeaturePhases[m_FeatureIds[neighbor]];
-        fixedCount++;
+        continue;
       }
+      m_FeatureIds[point] = m_FeatureIds[neighbor];
+      m_CellPhases[point] = m_FeaturePhases[m_FeatureIds[neighbor]];
     }
-    if(counter >= 1)
+    remaining -= static_cast<int64_t>(frontier.size());
+
+    nextFrontier.clear();
+    for(int64_t point : frontier)
     {
-      QString ss = QObject::tr("Assign Gaps|| Cycle#: %1 || Remaining Unassigned Voxel Count: %2").arg(counter).arg(count);
-      notifyStatusMessage(ss);
+      forEachNeighbor(point, [&](int64_t neighpoint) {
+        if(m_FeatureIds[neighpoint] < 0 && queuedCycle[neighpoint] != counter)
+        {
+          queuedCycle[neighpoint] = counter;
+          nextFrontier.push_back(neighpoint);
+        }
+      });
     }
+    frontier.swap(nextFrontier);
+
+    QString ss = QObject::tr("Assign Gaps|| Cycle#: %1 || Remaining Unassigned Voxel Count: %2").arg(counter).arg(remaining);
+    notifyStatusMessage(ss);
   }
 }
 
@@ -36,6 +36,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "TiDwellFatigueCrystallographicAnalysis.h"
 
+#include <array>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -58,10 +61,12 @@
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ConcurrentUnionFind.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
@@ -79,6 +84,322 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID37 = 37,
 };
 
+namespace
+{
+/**
+ * @brief Parameters of the feature classification, gathered once before the parallel pass
+ */
+struct ClassificationSettings
+{
+  std::array<float, 3> xyzScaledDimension = {0.0f, 0.0f, 0.0f};
+  std::array<float, 3> stressAxis = {0.0f, 0.0f, 1.0f};
+  float subsurfaceDistance = 0.0f;
+  int32_t mtrPhase = 0;
+  int32_t alphaGlobPhase = 0;
+  bool doNotAssumeInitiatorPresence = true;
+  std::array<float, 2> initiatorRange = {0.0f, 0.0f};
+  std::array<float, 2> hardFeatureRange = {0.0f, 0.0f};
+  std::array<float, 2> softFeatureRange = {0.0f, 0.0f};
+  float hardfeaturePlaneNormals[12][3] = {};
+};
+
+/**
+ * @brief Returns the angle in degrees between the stress axis and a crystal plane normal
+ * rotated into the sample frame
+ * @param g Orientation matrix of the feature
+ * @param planeNormal Unit plane normal in the crystal frame
+ */
+float findAngle(float g[3][3], const float planeNormal[3], const std::array<float, 3>& stressAxis)
+{
+  float gt[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+  float normal[3] = {planeNormal[0], planeNormal[1], planeNormal[2]};
+  float v[3] = {0};
+  float sampleLoading[3] = {stressAxis[0], stressAxis[1], stressAxis[2]};
+
+  MatrixMath::Transpose3x3(g, gt);
+  MatrixMath::Multiply3x3with3x1(gt, normal, v);
+  // Normalize so that the magnitude is 1
+  MatrixMath::Normalize3x1(v);
+  if(v[2] < 0)
+  {
+    MatrixMath::Multiply3x1withConstant(v, -1.0f);
+  }
+  float w = GeometryMath::CosThetaBetweenVectors(v, sampleLoading);
+  w = acos(w);
+  // Convert from radian to degrees
+  return w *= SIMPLib::Constants::k_180OverPiD;
+}
+
+/**
+ * @brief Flags the hard features, soft features and initiators among the selected subsurface
+ * features. Every feature only writes its own flags, and its orientation matrix is derived
+ * once for all of its checks.
+ */
+class ClassifyFeaturesImpl
+{
+public:
+  ClassifyFeaturesImpl(const ClassificationSettings& settings, const bool* selectedFeatures, const int32_t* featurePhases, const float* centroids, float* featureEulerAngles, bool* hardFeatures,
+                       bool* softFeatures, bool* initiators)
+  : m_Settings(settings)
+  , m_SelectedFeatures(selectedFeatures)
+  , m_FeaturePhases(featurePhases)
+  , m_Centroids(centroids)
+  , m_FeatureEulerAngles(featureEulerAngles)
+  , m_HardFeatures(hardFeatures)
+  , m_SoftFeatures(softFeatures)
+  , m_Initiators(initiators)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const float caxis[3] = {0.0f, 0.0f, 1.0f};
+    float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(!m_SelectedFeatures[i] || !isSubsurface(i))
+      {
+        continue;
+      }
+      bool mtrFeature = m_FeaturePhases[i] == m_Settings.mtrPhase;
+      // Determine if it's an initiator only if we're assuming initiators are not necessarily present
+      bool initiatorCandidate = m_Settings.doNotAssumeInitiatorPresence && m_FeaturePhases[i] == m_Settings.alphaGlobPhase;
+      if(!mtrFeature && !initiatorCandidate)
+      {
+        continue;
+      }
+
+      OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(m_FeatureEulerAngles + 3 * i, 3)).toGMatrix(g);
+      if(mtrFeature)
+      {
+        bool hardfeatureFlag = false;
+        for(size_t j = 0; j < 12 && !hardfeatureFlag; ++j)
+        {
+          hardfeatureFlag = inRange(findAngle(g, m_Settings.hardfeaturePlaneNormals[j], m_Settings.stressAxis), m_Settings.hardFeatureRange);
+        }
+        // Determine if it's a soft feature only if it's not a hard feature
+        if(hardfeatureFlag)
+        {
+          m_HardFeatures[i] = true;
+        }
+        else if(inRange(findAngle(g, caxis, m_Settings.stressAxis), m_Settings.softFeatureRange))
+        {
+          m_SoftFeatures[i] = true;
+        }
+      }
+      if(initiatorCandidate && inRange(findAngle(g, caxis, m_Settings.stressAxis), m_Settings.initiatorRange))
+      {
+        m_Initiators[i] = true;
+      }
+    }
+  }
+
+private:
+  const ClassificationSettings& m_Settings;
+  const bool* m_SelectedFeatures = nullptr;
+  const int32_t* m_FeaturePhases = nullptr;
+  const float* m_Centroids = nullptr;
+  float* m_FeatureEulerAngles = nullptr;
+  bool* m_HardFeatures = nullptr;
+  bool* m_SoftFeatures = nullptr;
+  bool* m_Initiators = nullptr;
+
+  /**
+   * @brief Checks if the feature centroid is within the subsurface defined region
+   */
+  bool isSubsurface(size_t index) const
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      float centroid = m_Centroids[3 * index + a];
+      if(centroid < m_Settings.subsurfaceDistance || centroid > (m_Settings.xyzScaledDimension[a] - m_Settings.subsurfaceDistance))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool inRange(float w, const std::array<float, 2>& range)
+  {
+    return w >= range[0] && w <= range[1];
+  }
+};
+
+/**
+ * @brief Unites every hard feature with its hard neighbors and every soft feature with
+ * its soft neighbors
+ */
+class UniteFlaggedNeighborsImpl
+{
+public:
+  UniteFlaggedNeighborsImpl(NeighborList<int>& neighborList, const bool* hardFeatures, const bool* softFeatures, ConcurrentUnionFind<int32_t>& groups)
+  : m_NeighborList(neighborList)
+  , m_HardFeatures(hardFeatures)
+  , m_SoftFeatures(softFeatures)
+  , m_Groups(groups)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(!m_HardFeatures[i] && !m_SoftFeatures[i])
+      {
+        continue;
+      }
+      const auto& neighbors = m_NeighborList[i];
+      for(size_t j = 0; j < neighbors.size(); ++j)
+      {
+        int32_t neighbor = neighbors[j];
+        if((m_HardFeatures[i] && m_HardFeatures[neighbor]) || (m_SoftFeatures[i] && m_SoftFeatures[neighbor]))
+        {
+          m_Groups.unite(static_cast<int32_t>(i), neighbor);
+        }
+      }
+    }
+  }
+
+private:
+  NeighborList<int>& m_NeighborList;
+  const bool* m_HardFeatures = nullptr;
+  const bool* m_SoftFeatures = nullptr;
+  ConcurrentUnionFind<int32_t>& m_Groups;
+};
+
+/**
+ * @brief Finds, for every parent feature, the first hard and soft feature of a neighboring
+ * initiator - hard feature - soft feature group. The pair of feature i is stored at
+ * pairs[2 * i] and pairs[2 * i + 1]; features without a pair are left untouched.
+ */
+class FindHardSoftPairsImpl
+{
+public:
+  FindHardSoftPairsImpl(NeighborList<int>& parentNeighborList, int32_t mtrPhase, int32_t alphaGlobPhase, bool doNotAssumeInitiatorPresence, const int32_t* featurePhases, const bool* initiators,
+                        const bool* hardFeatures, const bool* softFeatures, std::vector<int32_t>& pairs)
+  : m_ParentNeighborList(parentNeighborList)
+  , m_MTRPhase(mtrPhase)
+  , m_AlphaGlobPhase(alphaGlobPhase)
+  , m_DoNotAssumeInitiatorPresence(doNotAssumeInitiatorPresence)
+  , m_FeaturePhases(featurePhases)
+  , m_Initiators(initiators)
+  , m_HardFeatures(hardFeatures)
+  , m_SoftFeatures(softFeatures)
+  , m_Pairs(pairs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t index = range.min(); index < range.max(); index++)
+    {
+      // only proceed if it's either an MTR or alpha glob
+      bool alphaGlobCandidate = m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase;
+      if(m_FeaturePhases[index] != m_MTRPhase && !alphaGlobCandidate)
+      {
+        continue;
+      }
+      // Determine if it's a hard-soft pair only if there the current ID is either a hardfeature, initiator or soft feature
+      if(!m_Initiators[index] && !m_HardFeatures[index] && !m_SoftFeatures[index])
+      {
+        continue;
+      }
+
+      bool hardfeatureFlag = false;
+      bool initiatorFlag = false;
+      bool softfeatureFlag = false;
+      int32_t hardfeatureIndex = 0;
+      int32_t softfeatureIndex = 0;
+
+      const auto& neighbors = m_ParentNeighborList[index];
+      for(size_t j = 0; j < neighbors.size(); ++j)
+      {
+        int32_t neighbor = neighbors[j];
+        if(!alphaGlobCandidate && m_FeaturePhases[neighbor] != m_MTRPhase)
+        {
+          continue;
+        }
+        if(m_Initiators[index] && alphaGlobCandidate)
+        {
+          initiatorFlag = true;
+        }
+        if(m_Initiators[neighbor] && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[neighbor] == m_AlphaGlobPhase)
+        {
+          initiatorFlag = true;
+        }
+        if(!hardfeatureFlag && m_HardFeatures[index] && m_FeaturePhases[index] == m_MTRPhase)
+        {
+          hardfeatureFlag = true;
+          hardfeatureIndex = static_cast<int32_t>(index);
+        }
+        if(!hardfeatureFlag && m_HardFeatures[neighbor] && m_FeaturePhases[neighbor] == m_MTRPhase)
+        {
+          hardfeatureFlag = true;
+          hardfeatureIndex = neighbor;
+        }
+        if(!softfeatureFlag && m_SoftFeatures[index] && m_FeaturePhases[index] == m_MTRPhase)
+        {
+          softfeatureFlag = true;
+          softfeatureIndex = static_cast<int32_t>(index);
+        }
+        if(!softfeatureFlag && m_SoftFeatures[neighbor] && m_FeaturePhases[neighbor] == m_MTRPhase)
+        {
+          softfeatureFlag = true;
+          softfeatureIndex = neighbor;
+        }
+        // only flag as a hard-soft pair if there's a neighboring group of initiator - hardfeature - soft feature
+        if((!m_DoNotAssumeInitiatorPresence || initiatorFlag) && hardfeatureFlag && softfeatureFlag)
+        {
+          m_Pairs[2 * index + 0] = hardfeatureIndex;
+          m_Pairs[2 * index + 1] = softfeatureIndex;
+          break;
+        }
+      }
+    }
+  }
+
+private:
+  NeighborList<int>& m_ParentNeighborList;
+  int32_t m_MTRPhase = 0;
+  int32_t m_AlphaGlobPhase = 0;
+  bool m_DoNotAssumeInitiatorPresence = true;
+  const int32_t* m_FeaturePhases = nullptr;
+  const bool* m_Initiators = nullptr;
+  const bool* m_HardFeatures = nullptr;
+  const bool* m_SoftFeatures = nullptr;
+  std::vector<int32_t>& m_Pairs;
+};
+
+/**
+ * @brief Maps the parent of every feature to its cells; ungrouped features keep their own id
+ */
+class MapParentIdsImpl
+{
+public:
+  MapParentIdsImpl(const int32_t* featureIds, const int32_t* featureParentIds, int32_t* cellParentIds)
+  : m_FeatureIds(featureIds)
+  , m_FeatureParentIds(featureParentIds)
+  , m_CellParentIds(cellParentIds)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      int32_t fid = m_FeatureParentIds[m_FeatureIds[i]];
+      m_CellParentIds[i] = (fid != -1) ? fid : m_FeatureIds[i];
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds = nullptr;
+  const int32_t* m_FeatureParentIds = nullptr;
+  int32_t* m_CellParentIds = nullptr;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -409,70 +730,28 @@ void TiDwellFatigueCrystallographicAnalysis::execute()
   size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
   size_t totalPoints = static_cast<size_t>(m_FeatureIdsPtr.lock()->getNumberOfTuples());
 
-  bool subsurfaceFlag = false;
-  bool hardfeatureFlag = false;
-  //  bool initiatorFlag = false;
-  //  bool softfeatureFlag = false;
-
-  float random = 0.0f;
-
   // Normalize input stress axis
   MatrixMath::Normalize3x1(m_StressAxis[0], m_StressAxis[1], m_StressAxis[2]);
 
+  // The random draws stay serial so the selection matches a given seed
   for(size_t i = 1; i < totalFeatures; ++i)
   {
-    //  int stop = 0;
-    random = static_cast<float>(rg.genrand_res53());
+    float random = static_cast<float>(rg.genrand_res53());
     if(random < m_ConsiderationFraction)
     {
       m_SelectedFeatures[i] = true;
-      subsurfaceFlag = determine_subsurfacefeatures(i);
-    }
-    if(subsurfaceFlag)
-    {
-      // Determine if it's a hard feature
-      if(m_FeaturePhases[i] == m_MTRPhase)
-      {
-        hardfeatureFlag = determine_hardfeatures(i);
-      }
-      // Determine if it's a soft feature only if it's not a hard feature
-      if(!hardfeatureFlag && m_FeaturePhases[i] == m_MTRPhase)
-      {
-        determine_softfeatures(i);
-      }
-      // Determine if it's an initiator only if we're assuming initiators are not necessarily present
-      if(m_DoNotAssumeInitiatorPresence && m_FeaturePhases[i] == m_AlphaGlobPhase)
-      {
-        determine_initiators(i);
-      }
-      subsurfaceFlag = false;
     }
   }
 
-  for(size_t i = 1; i < totalFeatures; ++i)
-  {
-    // Group neighboring hard features and soft features
-    if(m_HardFeatures[i] || m_SoftFeatures[i])
-    {
-      group_flaggedfeatures(i);
-    }
-  }
+  classifyFeatures(totalFeatures);
 
-  size_t fid = 0;
+  // Group neighboring hard features and soft features
+  groupFlaggedFeatures(totalFeatures);
 
   // map grouped features to the cells
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    fid = m_FeatureParentIds[m_FeatureIds[i]];
-    if(fid != -1)
-    {
-      m_CellParentIds[i] = fid;
-    }
-    else
-    {
-      m_CellParentIds[i] = m_FeatureIds[i];
-    }
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalPoints);
+  dataAlg.execute(MapParentIdsImpl(m_FeatureIds, m_FeatureParentIds, m_CellParentIds));
 
   QString filtName = "FindNeighbors";
   FilterManager* fm = FilterManager::Instance();
@@ -605,163 +884,72 @@ void TiDwellFatigueCrystallographicAnalysis::execute()
   tempPath.update(getFeatureEulerAnglesArrayPath().getDataContainerName(), getFeatureEulerAnglesArrayPath().getAttributeMatrixName(), "ParentNeighborList");
   m_ParentNeighborList = getDataContainerArray()->getPrereqArrayFromPath<NeighborList<int>>(this, tempPath, cDims);
 
-  for(size_t i = 1; i < totalFeatures; ++i)
-  {
-    // only proceed if it's either an MTR or alpha glob
-    if(m_FeaturePhases[i] == m_MTRPhase || (m_FeaturePhases[i] == m_AlphaGlobPhase && m_DoNotAssumeInitiatorPresence))
-    {
-      // Determine if it's a hard-soft pair only if there the current ID is either a hardfeature, initiator or soft feature
-      if(m_Initiators[i] || m_HardFeatures[i] || m_SoftFeatures[i])
-      {
-        assign_HardSoftGroups(i);
-      }
-    }
-  }
+  assignHardSoftGroups(totalFeatures);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool TiDwellFatigueCrystallographicAnalysis::determine_subsurfacefeatures(int index)
+void TiDwellFatigueCrystallographicAnalysis::classifyFeatures(size_t totalFeatures)
 {
   // using feature euler angles simply because it's available
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_FeatureEulerAnglesArrayPath.getDataContainerName());
   FloatVec3Type origin = m->getGeometryAs<ImageGeom>()->getOrigin();
-
-  bool subsurfaceFlag = false;
-
   SizeVec3Type dims = m->getGeometryAs<ImageGeom>()->getDimensions();
   FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
-  FloatVec3Type xyzScaledDimension(origin[0] + dims[0] * spacing[0], origin[1] + dims[1] * spacing[1], origin[2] + dims[2] * spacing[2]);
 
-  // check if current feature centroid is within the subsurface defined centroid
-  if(m_Centroids[3 * index + 0] >= m_SubsurfaceDistance && m_Centroids[3 * index + 0] <= (xyzScaledDimension[0] - m_SubsurfaceDistance) && m_Centroids[3 * index + 1] >= m_SubsurfaceDistance &&
-     m_Centroids[3 * index + 1] <= (xyzScaledDimension[1] - m_SubsurfaceDistance) && m_Centroids[3 * index + 2] >= m_SubsurfaceDistance &&
-     m_Centroids[3 * index + 2] <= (xyzScaledDimension[2] - m_SubsurfaceDistance))
+  ClassificationSettings settings;
+  for(size_t a = 0; a < 3; a++)
   {
-    subsurfaceFlag = true;
+    settings.xyzScaledDimension[a] = origin[a] + dims[a] * spacing[a];
+    settings.stressAxis[a] = m_StressAxis[a];
   }
-  return subsurfaceFlag;
-}
+  settings.subsurfaceDistance = static_cast<float>(m_SubsurfaceDistance);
+  settings.mtrPhase = m_MTRPhase;
+  settings.alphaGlobPhase = m_AlphaGlobPhase;
+  settings.doNotAssumeInitiatorPresence = m_DoNotAssumeInitiatorPresence;
+  settings.initiatorRange = {m_InitiatorLowerThreshold, m_InitiatorUpperThreshold};
+  settings.hardFeatureRange = {m_HardFeatureLowerThreshold, m_HardFeatureUpperThreshold};
+  settings.softFeatureRange = {m_SoftFeatureLowerThreshold, m_SoftFeatureUpperThreshold};
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool TiDwellFatigueCrystallographicAnalysis::determine_hardfeatures(int index)
-{
-  float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float w = 0.0f;
+  // convert Miller-Bravais to unit normal
   const int hardfeaturePlane[12][4] = {{-1, 0, 1, 7},  {-1, 1, 0, -7}, {0, -1, 1, 7},  {1, 0, -1, 7},  {1, -1, 0, -7}, {0, 1, -1, 7},
                                        {0, -1, 1, -7}, {0, 1, -1, -7}, {1, 0, -1, -7}, {-1, 0, 1, -7}, {-1, 1, 0, 7},  {1, -1, 0, 7}};
-  float hardfeaturePlaneNormal[12][3];
-  for(size_t i = 0; i < 12; i++)
+  const float oneOverA = 1 / m_LatticeParameterA;
+  const float oneOverAxSqrtThree = 1 / (m_LatticeParameterA * sqrtf(3.0f));
+  const float oneOverC = 1 / m_LatticeParameterC;
+  for(size_t j = 0; j < 12; ++j)
   {
-    for(size_t j = 0; j < 3; j++)
-    {
-      hardfeaturePlaneNormal[i][j] = 0.0f;
-    }
+    settings.hardfeaturePlaneNormals[j][0] = hardfeaturePlane[j][0] * oneOverA;
+    settings.hardfeaturePlaneNormals[j][1] = (2.0f * hardfeaturePlane[j][1] + hardfeaturePlane[j][0]) * oneOverAxSqrtThree;
+    settings.hardfeaturePlaneNormals[j][2] = hardfeaturePlane[j][3] * oneOverC;
+    MatrixMath::Normalize3x1(settings.hardfeaturePlaneNormals[j]);
   }
-  const float m_OneOverA = 1 / m_LatticeParameterA;
-  const float m_OneOverAxSqrtThree = 1 / (m_LatticeParameterA * sqrtf(3.0f));
-  const float m_OneOverC = 1 / m_LatticeParameterC;
-  bool hardfeatureFlag = false;
 
-  // convert Miller-Bravais to unit normal
-  for(int j = 0; j < 12; ++j)
-  {
-    hardfeaturePlaneNormal[j][0] = hardfeaturePlane[j][0] * m_OneOverA;
-    hardfeaturePlaneNormal[j][1] = (2.0f * hardfeaturePlane[j][1] + hardfeaturePlane[j][0]) * m_OneOverAxSqrtThree;
-    hardfeaturePlaneNormal[j][2] = hardfeaturePlane[j][3] * m_OneOverC;
-  }
-
-  OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(m_FeatureEulerAngles + 3 * index, 3)).toGMatrix(g);
-  if(m_FeaturePhases[index] == m_MTRPhase)
-  {
-    for(int j = 0; j < 12; ++j)
-    {
-      w = find_angle(g, hardfeaturePlaneNormal[j][0], hardfeaturePlaneNormal[j][1], hardfeaturePlaneNormal[j][2]);
-      if(w >= m_HardFeatureLowerThreshold && w <= m_HardFeatureUpperThreshold)
-      {
-        m_HardFeatures[index] = true;
-        hardfeatureFlag = true;
-        break;
-      }
-    }
-  }
-  return hardfeatureFlag;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.execute(ClassifyFeaturesImpl(settings, m_SelectedFeatures, m_FeaturePhases, m_Centroids, m_FeatureEulerAngles, m_HardFeatures, m_SoftFeatures, m_Initiators));
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::determine_initiators(int index)
+void TiDwellFatigueCrystallographicAnalysis::groupFlaggedFeatures(size_t totalFeatures)
 {
-  const float caxis[3] = {0.0f, 0.0f, 1.0f};
-  bool initiatorFlag = false;
-  float w = 0.0f;
-  float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+  ConcurrentUnionFind<int32_t> groups;
+  groups.reset(totalFeatures);
 
-  if(m_FeaturePhases[index] == m_AlphaGlobPhase)
-  {
-    OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(m_FeatureEulerAngles + 3 * index, 3)).toGMatrix(g);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.execute(UniteFlaggedNeighborsImpl(*(m_NeighborList.lock()), m_HardFeatures, m_SoftFeatures, groups));
 
-    w = find_angle(g, caxis[0], caxis[1], caxis[2]);
-    if(w >= m_InitiatorLowerThreshold && w <= m_InitiatorUpperThreshold)
-    {
-      m_Initiators[index] = true;
-      initiatorFlag = true;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::determine_softfeatures(int index)
-{
-  const float caxis[3] = {0.0f, 0.0f, 1.0f};
-  float w = 0.0f;
-  float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  // bool softfeatureFlag = false;
-
-  if(m_FeaturePhases[index] == m_MTRPhase)
-  {
-    OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(m_FeatureEulerAngles + 3 * index, 3)).toGMatrix(g);
-
-    w = find_angle(g, caxis[0], caxis[1], caxis[2]);
-    if(w >= m_SoftFeatureLowerThreshold && w <= m_SoftFeatureUpperThreshold)
-    {
-      m_SoftFeatures[index] = true;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::group_flaggedfeatures(int index)
-{
-  // But since a pointer is difficult to use operators with we will now create a
-  // reference variable to the pointer with the correct variable name that allows
-  // us to use the same syntax as the "vector of vectors"
-  NeighborList<int>& neighborlist = *(m_NeighborList.lock());
-
-  for(int j = 0; j < neighborlist[index].size(); ++j)
+  // The root of every group is its lowest feature, which keeps no parent of its own
+  for(size_t i = 1; i < totalFeatures; ++i)
   {
-    if(m_FeatureParentIds[index] != neighborlist[index][j] && ((m_HardFeatures[index] && m_HardFeatures[neighborlist[index][j]]) || (m_SoftFeatures[index] && m_SoftFeatures[neighborlist[index][j]])))
+    int32_t root = groups.find(static_cast<int32_t>(i));
+    if(root != static_cast<int32_t>(i))
     {
-      if(m_FeatureParentIds[neighborlist[index][j]] == -1)
-      {
-        if(m_FeatureParentIds[index] == -1)
-        {
-          m_FeatureParentIds[neighborlist[index][j]] = index;
-        }
-        if(m_FeatureParentIds[index] != -1)
-        {
-          m_FeatureParentIds[neighborlist[index][j]] = m_FeatureParentIds[index];
-        }
-        group_flaggedfeatures(neighborlist[index][j]);
-      }
+      m_FeatureParentIds[i] = root;
     }
   }
 }
@@ -769,89 +957,27 @@ void TiDwellFatigueCrystallographicAnalysis::group_flaggedfeatures(int index)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::assign_HardSoftGroups(int index)
+void TiDwellFatigueCrystallographicAnalysis::assignHardSoftGroups(size_t totalFeatures)
 {
-  // But since a pointer is difficult to use operators with we will now create a
-  // reference variable to the pointer with the correct variable name that allows
-  // us to use the same syntax as the "vector of vectors"
-  NeighborList<int>& parentneighborlist = *(m_ParentNeighborList.lock());
+  // Every feature looks for its pair independently; the pairs are flagged afterwards
+  // so that no two threads write the same flag
+  std::vector<int32_t> hardSoftPairs(2 * totalFeatures, -1);
 
-  bool hardfeatureFlag = false;
-  bool initiatorFlag = false;
-  bool softfeatureFlag = false;
-  int hardfeatureIndex = 0;
-  int softfeatureIndex = 0;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.execute(FindHardSoftPairsImpl(*(m_ParentNeighborList.lock()), m_MTRPhase, m_AlphaGlobPhase, m_DoNotAssumeInitiatorPresence, m_FeaturePhases, m_Initiators, m_HardFeatures,
+                                        m_SoftFeatures, hardSoftPairs));
 
-  for(int j = 0; j < parentneighborlist[index].size(); ++j)
+  for(size_t i = 1; i < totalFeatures; ++i)
   {
-    if((m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase) || m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
+    if(hardSoftPairs[2 * i] >= 0)
     {
-      if(m_Initiators[index] && !initiatorFlag && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase)
-      {
-        initiatorFlag = true;
-      }
-      if(m_Initiators[parentneighborlist[index][j]] && !initiatorFlag && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[parentneighborlist[index][j]] == m_AlphaGlobPhase)
-      {
-        initiatorFlag = true;
-      }
-      if(m_HardFeatures[index] && !hardfeatureFlag && m_FeaturePhases[index] == m_MTRPhase)
-      {
-        hardfeatureFlag = true;
-        hardfeatureIndex = index;
-      }
-      if(m_HardFeatures[parentneighborlist[index][j]] && !hardfeatureFlag && m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
-      {
-        hardfeatureFlag = true;
-        hardfeatureIndex = parentneighborlist[index][j];
-      }
-      if(m_SoftFeatures[index] && !softfeatureFlag && m_FeaturePhases[index] == m_MTRPhase)
-      {
-        softfeatureFlag = true;
-        softfeatureIndex = index;
-      }
-      if(m_SoftFeatures[parentneighborlist[index][j]] && !softfeatureFlag && m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
-      {
-        softfeatureFlag = true;
-        softfeatureIndex = parentneighborlist[index][j];
-      }
-      // only flag as a hard-soft pair if there's a neighboring group of initiator - hardfeature - soft feature and either the current index of the hardfeature or
-      // soft feature have not already been flagged as a bad acting pair
-      if((!m_DoNotAssumeInitiatorPresence || initiatorFlag) && hardfeatureFlag && softfeatureFlag && (!m_HardSoftGroups[hardfeatureIndex] || !m_HardSoftGroups[softfeatureIndex]))
-      {
-        m_HardSoftGroups[hardfeatureIndex] = true;
-        m_HardSoftGroups[softfeatureIndex] = true;
-        break;
-      }
+      m_HardSoftGroups[hardSoftPairs[2 * i + 0]] = true;
+      m_HardSoftGroups[hardSoftPairs[2 * i + 1]] = true;
     }
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-float TiDwellFatigueCrystallographicAnalysis::find_angle(float g[3][3], float planeNormalU, float planeNormalV, float planeNormalW)
-{
-  float gt[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float v[3] = {0};
-  float sampleLoading[3] = {m_StressAxis[0], m_StressAxis[1], m_StressAxis[2]};
-  float w = 0.0f;
-
-  MatrixMath::Normalize3x1(planeNormalU, planeNormalV, planeNormalW);
-  float planeNormal[3] = {planeNormalU, planeNormalV, planeNormalW};
-  MatrixMath::Transpose3x3(g, gt);
-  MatrixMath::Multiply3x3with3x1(gt, planeNormal, v);
-  // Normalize so that the magnitude is 1
-  MatrixMath::Normalize3x1(v);
-  if(v[2] < 0)
-  {
-    MatrixMath::Multiply3x1withConstant(v, -1.0f);
-  }
-  w = GeometryMath::CosThetaBetweenVectors(v, sampleLoading);
-  w = acos(w);
-  // Convert from radian to degrees
-  return w *= SIMPLib::Constants::k_180OverPiD;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -515,13 +515,24 @@ public:
 protected:
   TiDwellFatigueCrystallographicAnalysis();
 
-  bool determine_subsurfacefeatures(int index);
-  bool determine_hardfeatures(int index);
-  void determine_initiators(int index);
-  void determine_softfeatures(int index);
-  void group_flaggedfeatures(int index);
-  void assign_HardSoftGroups(int index);
-  float find_angle(float g[3][3], float planeNormalU, float planeNormalV, float planeNormalW);
+  /**
+   * @brief Flags the hard features, soft features and initiators among the selected subsurface features
+   * @param totalFeatures Number of features
+   */
+  void classifyFeatures(size_t totalFeatures);
+
+  /**
+   * @brief Groups neighboring hard features and neighboring soft features; every member
+   * of a group except its lowest feature gets that feature as its parent
+   * @param totalFeatures Number of features
+   */
+  void groupFlaggedFeatures(size_t totalFeatures);
+
+  /**
+   * @brief Flags the hard and soft features of every neighboring initiator - hard feature - soft feature group
+   * @param totalFeatures Number of features
+   */
+  void assignHardSoftGroups(size_t totalFeatures);
 
   /**
    * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
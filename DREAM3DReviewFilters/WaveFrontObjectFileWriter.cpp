@@ -36,6 +36,7 @@
 #include <QtCore/QFileInfo>
 
 #include <fstream>
+#include <string>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -47,6 +48,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextFormattingHelpers.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -149,29 +151,57 @@ void WaveFrontObjectFileWriter::execute()
     return;
   }
 
+  // Each chunk of vertices or faces is formatted on its own thread; the chunks are
+  // then written in order
+  constexpr size_t k_ChunkSize = 65536;
+  const auto writeBuffer = [&outFile](const std::string& buffer) {
+    outFile.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return outFile.good();
+  };
+
   outFile << "# Vertices\n";
 
   // Dump the vertices
-  for(size_t i = 0; i < numberOfVertices; i++)
-  {
-    float c0 = vertices->getComponent(i, 0);
-    float c1 = vertices->getComponent(i, 1);
-    float c2 = vertices->getComponent(i, 2);
-
-    outFile << "v " << c0 << " " << c1 << " " << c2 << "\n";
-  }
+  float* verts = vertices->getPointer(0);
+  const auto formatVertices = [verts](size_t start, size_t end, std::string& buffer) {
+    for(size_t i = start; i < end; i++)
+    {
+      buffer += "v ";
+      TextFormattingHelpers::appendGeneral(buffer, verts[3 * i + 0]);
+      buffer += ' ';
+      TextFormattingHelpers::appendGeneral(buffer, verts[3 * i + 1]);
+      buffer += ' ';
+      TextFormattingHelpers::appendGeneral(buffer, verts[3 * i + 2]);
+      buffer += '\n';
+    }
+    return true;
+  };
+  bool success = TextFormattingHelpers::writeChunks(numberOfVertices, k_ChunkSize, formatVertices, writeBuffer);
 
   outFile << "\n# Faces\n";
 
   // Dump the triangle faces
-  for(size_t i = 0; i < numberOfTriangles; i++)
-  {
-    size_t c0 = triangles->getComponent(i, 0);
-    size_t c1 = triangles->getComponent(i, 1);
-    size_t c2 = triangles->getComponent(i, 2);
+  MeshIndexType* tris = triangles->getPointer(0);
+  const auto formatFaces = [tris](size_t start, size_t end, std::string& buffer) {
+    for(size_t i = start; i < end; i++)
+    {
+      // These vertex values that make up the face must be 1-based
+      buffer += "f ";
+      TextFormattingHelpers::appendInteger(buffer, tris[3 * i + 0] + 1);
+      buffer += ' ';
+      TextFormattingHelpers::appendInteger(buffer, tris[3 * i + 1] + 1);
+      buffer += ' ';
+      TextFormattingHelpers::appendInteger(buffer, tris[3 * i + 2] + 1);
+      buffer += '\n';
+    }
+    return true;
+  };
+  success = success && TextFormattingHelpers::writeChunks(numberOfTriangles, k_ChunkSize, formatFaces, writeBuffer);
 
-    // These vertex values that make up the face must be 1-based
-    outFile << "f " << c0 + 1 << " " << c1 + 1 << " " << c2 + 1 << "\n";
+  if(!success)
+  {
+    QString ss = QObject::tr("Error writing to output file %1").arg(getOutputWaveFrontFile());
+    setErrorCondition(-2001, ss);
   }
 }
 
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Box counting of a 3D (or 2D) mask at box edges 1, 2, 4, ... voxels. The mask is
+ * shifted by an integer grid offset, and level k covers it with boxes of edge 2^k aligned
+ * to the shifted origin, so each level is an exact 2x2x2 coarsening of the one before.
+ * A level stores one bit per box, packed along x into 64 bit words, and only spans the
+ * boxes that can be occupied, so non-cubic volumes are never padded to a cube.
+ */
+namespace BoxCounting
+{
+/**
+ * @brief Occupancy of the boxes of one level. Box indices are stored relative to lo,
+ * the first box along each axis that overlaps the mask; row (y, z) holds the boxes
+ * along x starting at word (z * extent[1] + y) * wordsPerRow.
+ */
+struct Level
+{
+  std::array<size_t, 3> lo = {0, 0, 0};
+  std::array<size_t, 3> extent = {0, 0, 0};
+  size_t wordsPerRow = 0;
+  std::vector<uint64_t> words;
+
+  void resize(const std::array<size_t, 3>& first, const std::array<size_t, 3>& last)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      lo[a] = first[a];
+      extent[a] = last[a] - first[a] + 1;
+    }
+    wordsPerRow = (extent[0] + 63) / 64;
+    words.assign(wordsPerRow * extent[1] * extent[2], 0);
+  }
+
+  uint64_t* row(size_t y, size_t z)
+  {
+    return words.data() + (z * extent[1] + y) * wordsPerRow;
+  }
+
+  const uint64_t* row(size_t y, size_t z) const
+  {
+    return words.data() + (z * extent[1] + y) * wordsPerRow;
+  }
+};
+
+namespace Detail
+{
+/**
+ * @brief ORs every pair of neighboring bits of a word and packs the 32 results into the
+ * low half of the returned word
+ */
+inline uint64_t compressPairs(uint64_t word)
+{
+  uint64_t x = (word | (word >> 1)) & 0x5555555555555555ULL;
+  x = (x | (x >> 1)) & 0x3333333333333333ULL;
+  x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+  x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+  x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+  x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+  return x;
+}
+
+/**
+ * @brief Builds the first coarse level (edge 2) straight from the mask
+ */
+class FirstLevelImpl
+{
+public:
+  FirstLevelImpl(const bool* mask, const std::array<size_t, 3>& dims, const std::array<size_t, 3>& offset, Level& level, std::atomic<size_t>& count)
+  : m_Mask(mask)
+  , m_Dims(dims)
+  , m_Offset(offset)
+  , m_Level(level)
+  , m_Count(count)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t count = 0;
+    for(size_t r = range.min(); r < range.max(); r++)
+    {
+      size_t y = r % m_Level.extent[1];
+      size_t z = r / m_Level.extent[1];
+      uint64_t* row = m_Level.row(y, z);
+      for(size_t dz = 0; dz < 2; dz++)
+      {
+        // Source plane of this half of the box, skipping planes outside the mask
+        size_t sz = 2 * (m_Level.lo[2] + z) + dz;
+        if(sz < m_Offset[2] || sz - m_Offset[2] >= m_Dims[2])
+        {
+          continue;
+        }
+        sz -= m_Offset[2];
+        for(size_t dy = 0; dy < 2; dy++)
+        {
+          size_t sy = 2 * (m_Level.lo[1] + y) + dy;
+          if(sy < m_Offset[1] || sy - m_Offset[1] >= m_Dims[1])
+          {
+            continue;
+          }
+          sy -= m_Offset[1];
+          const bool* source = m_Mask + (sz * m_Dims[1] + sy) * m_Dims[0];
+          for(size_t x = 0; x < m_Dims[0]; x++)
+          {
+            if(source[x])
+            {
+              size_t bit = ((x + m_Offset[0]) >> 1) - m_Level.lo[0];
+              row[bit >> 6] |= uint64_t(1) << (bit & 63);
+            }
+          }
+        }
+      }
+      for(size_t w = 0; w < m_Level.wordsPerRow; w++)
+      {
+        count += std::bitset<64>(row[w]).count();
+      }
+    }
+    m_Count += count;
+  }
+
+private:
+  const bool* m_Mask = nullptr;
+  std::array<size_t, 3> m_Dims;
+  std::array<size_t, 3> m_Offset;
+  Level& m_Level;
+  std::atomic<size_t>& m_Count;
+};
+
+/**
+ * @brief Builds a level from the one before it: the rows of each 2x2 block are ORed
+ * word by word, and the neighboring bit pairs of the result are ORed and packed
+ */
+class CoarsenLevelImpl
+{
+public:
+  CoarsenLevelImpl(const Level& source, Level& sink, std::atomic<size_t>& count)
+  : m_Source(source)
+  , m_Sink(sink)
+  , m_Count(count)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    // Bit l of a source row is box lo + l; when lo is odd the row is shifted by one bit
+    // so that the pairs that merge start on even bits
+    bool shift = (m_Source.lo[0] & 1) != 0;
+    std::vector<uint64_t> merged(std::max(m_Source.wordsPerRow + 1, 2 * m_Sink.wordsPerRow), 0);
+    size_t count = 0;
+    for(size_t r = range.min(); r < range.max(); r++)
+    {
+      size_t y = r % m_Sink.extent[1];
+      size_t z = r / m_Sink.extent[1];
+      std::fill(merged.begin(), merged.end(), 0);
+      for(size_t dz = 0; dz < 2; dz++)
+      {
+        size_t sz = 2 * (m_Sink.lo[2] + z) + dz;
+        if(sz < m_Source.lo[2] || sz - m_Source.lo[2] >= m_Source.extent[2])
+        {
+          continue;
+        }
+        for(size_t dy = 0; dy < 2; dy++)
+        {
+          size_t sy = 2 * (m_Sink.lo[1] + y) + dy;
+          if(sy < m_Source.lo[1] || sy - m_Source.lo[1] >= m_Source.extent[1])
+          {
+            continue;
+          }
+          const uint64_t* source = m_Source.row(sy - m_Source.lo[1], sz - m_Source.lo[2]);
+          for(size_t w = 0; w < m_Source.wordsPerRow; w++)
+          {
+            merged[w] |= source[w];
+          }
+        }
+      }
+      if(shift)
+      {
+        for(size_t w = m_Source.wordsPerRow; w > 0; w--)
+        {
+          merged[w] = (merged[w] << 1) | (merged[w - 1] >> 63);
+        }
+        merged[0] <<= 1;
+      }
+      uint64_t* row = m_Sink.row(y, z);
+      for(size_t w = 0; w < m_Sink.wordsPerRow; w++)
+      {
+        row[w] = compressPairs(merged[2 * w]) | (compressPairs(merged[2 * w + 1]) << 32);
+        count += std::bitset<64>(row[w]).count();
+      }
+    }
+    m_Count += count;
+  }
+
+private:
+  const Level& m_Source;
+  Level& m_Sink;
+  std::atomic<size_t>& m_Count;
+};
+} // namespace Detail
+
+/**
+ * @brief Number of levels needed for the largest box to span the longest axis: levels
+ * 0 ... K with 2^K >= the largest dimension
+ */
+inline size_t numberOfLevels(const std::array<size_t, 3>& dims)
+{
+  size_t maxDim = std::max({dims[0], dims[1], dims[2]});
+  size_t levels = 1;
+  while((size_t(1) << (levels - 1)) < maxDim)
+  {
+    levels++;
+  }
+  return levels;
+}
+
+/**
+ * @brief Grid offsets for box counting. The first one centers the mask in the cube of
+ * edge 2^(numLevels - 1), which reproduces counting on a cube padded symmetrically; the
+ * others are spread over the cube with an additive recurrence (R3 sequence) so that every
+ * level sees differently aligned grids. Axes of length 1 are never shifted.
+ */
+inline std::vector<std::array<size_t, 3>> gridOffsets(const std::array<size_t, 3>& dims, size_t numLevels, size_t numOffsets)
+{
+  const std::array<double, 3> alpha = {0.8191725133961645, 0.6710436067037893, 0.5497004779019703};
+  size_t edge = size_t(1) << (numLevels - 1);
+  std::vector<std::array<size_t, 3>> offsets(std::max<size_t>(numOffsets, 1));
+  for(size_t j = 0; j < offsets.size(); j++)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(dims[a] <= 1)
+      {
+        offsets[j][a] = 0;
+      }
+      else if(j == 0)
+      {
+        offsets[j][a] = (edge - dims[a]) / 2;
+      }
+      else
+      {
+        double phase = std::fmod(0.5 + alpha[a] * static_cast<double>(j), 1.0);
+        offsets[j][a] = std::min(static_cast<size_t>(phase * static_cast<double>(edge)), edge - 1);
+      }
+    }
+  }
+  return offsets;
+}
+
+/**
+ * @brief Counts the occupied boxes of edge 2^k, k = 1 ... numLevels - 1, for one grid offset
+ * @param mask Mask of dims[0] x dims[1] x dims[2] voxels, x fastest
+ * @param counts Receives the counts; counts[0] is left untouched
+ * @param isCanceled Callable bool() polled once per level
+ */
+template <typename CancelFunc>
+void countCoarseBoxes(const bool* mask, const std::array<size_t, 3>& dims, const std::array<size_t, 3>& offset, size_t numLevels, std::vector<size_t>& counts, const CancelFunc& isCanceled)
+{
+  counts.resize(numLevels, 0);
+  if(numLevels < 2)
+  {
+    return;
+  }
+  std::array<size_t, 3> first = {0, 0, 0};
+  std::array<size_t, 3> last = {0, 0, 0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    first[a] = offset[a] >> 1;
+    last[a] = (offset[a] + dims[a] - 1) >> 1;
+  }
+  Level source;
+  Level sink;
+  source.resize(first, last);
+
+  std::atomic<size_t> count(0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, source.extent[1] * source.extent[2]);
+  dataAlg.execute(Detail::FirstLevelImpl(mask, dims, offset, source, count));
+  counts[1] = count;
+
+  for(size_t k = 2; k < numLevels; k++)
+  {
+    if(isCanceled())
+    {
+      return;
+    }
+    for(size_t a = 0; a < 3; a++)
+    {
+      first[a] = source.lo[a] >> 1;
+      last[a] = (source.lo[a] + source.extent[a] - 1) >> 1;
+    }
+    sink.resize(first, last);
+    count = 0;
+    dataAlg.setRange(0, sink.extent[1] * sink.extent[2]);
+    dataAlg.execute(Detail::CoarsenLevelImpl(source, sink, count));
+    counts[k] = count;
+    std::swap(source, sink);
+  }
+}
+
+/**
+ * @brief Least squares slope of log(count) against log(1 / edge) over the levels
+ * firstLevel ... lastLevel, where level k has boxes of edge 2^k
+ */
+inline double fitDimension(const std::vector<size_t>& counts, size_t firstLevel, size_t lastLevel)
+{
+  size_t n = lastLevel - firstLevel + 1;
+  double xmean = 0.0;
+  double ymean = 0.0;
+  for(size_t k = firstLevel; k <= lastLevel; k++)
+  {
+    xmean += -static_cast<double>(k) * std::log(2.0);
+    ymean += std::log(static_cast<double>(counts[k]));
+  }
+  xmean /= static_cast<double>(n);
+  ymean /= static_cast<double>(n);
+  double ssxx = 0.0;
+  double ssxy = 0.0;
+  for(size_t k = firstLevel; k <= lastLevel; k++)
+  {
+    double dx = -static_cast<double>(k) * std::log(2.0) - xmean;
+    ssxx += dx * dx;
+    ssxy += dx * (std::log(static_cast<double>(counts[k])) - ymean);
+  }
+  return ssxy / ssxx;
+}
+} // namespace BoxCounting
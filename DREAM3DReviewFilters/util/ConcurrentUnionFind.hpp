@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Disjoint set forest over the indices [0, size) whose sets can be merged from
+ * several threads at once without locks. A root is only ever linked below a smaller root,
+ * so every parent index is at most its child's index and the root of a set is its lowest
+ * index. The parent array keeps its allocation when the forest is reset to the same or a
+ * smaller size.
+ */
+template <typename IndexType>
+class ConcurrentUnionFind
+{
+public:
+  ConcurrentUnionFind() = default;
+  ~ConcurrentUnionFind() = default;
+
+  /**
+   * @brief Makes every element of [0, size) a set of its own
+   */
+  void reset(size_t size)
+  {
+    if(size > m_Capacity)
+    {
+      m_Parents.reset(new std::atomic<IndexType>[size]);
+      m_Capacity = size;
+    }
+    for(size_t i = 0; i < size; i++)
+    {
+      m_Parents[i].store(static_cast<IndexType>(i), std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Returns the root of the set containing x, halving the path on the way
+   */
+  IndexType find(IndexType x) const
+  {
+    while(true)
+    {
+      IndexType parent = m_Parents[x].load();
+      if(parent == x)
+      {
+        return x;
+      }
+      IndexType grandParent = m_Parents[parent].load();
+      if(grandParent != parent)
+      {
+        // Losing this race only means the path was shortened by someone else
+        m_Parents[x].compare_exchange_weak(parent, grandParent);
+      }
+      x = grandParent;
+    }
+  }
+
+  /**
+   * @brief Merges the sets containing a and b
+   */
+  void unite(IndexType a, IndexType b)
+  {
+    while(true)
+    {
+      a = find(a);
+      b = find(b);
+      if(a == b)
+      {
+        return;
+      }
+      if(a > b)
+      {
+        std::swap(a, b);
+      }
+      // Link the larger root below the smaller one; retry if b stopped being a root
+      IndexType expected = b;
+      if(m_Parents[b].compare_exchange_strong(expected, a))
+      {
+        return;
+      }
+    }
+  }
+
+  ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;            // Copy Constructor Not Implemented
+  ConcurrentUnionFind(ConcurrentUnionFind&&) = delete;                 // Move Constructor Not Implemented
+  ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete; // Copy Assignment Not Implemented
+  ConcurrentUnionFind& operator=(ConcurrentUnionFind&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  std::unique_ptr<std::atomic<IndexType>[]> m_Parents;
+  size_t m_Capacity = 0;
+};
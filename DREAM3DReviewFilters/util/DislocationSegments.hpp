@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Geometry/MeshStructs.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ConcurrentUnionFind.hpp"
+
+/**
+ * @brief Grouping of dislocation line edges into dislocation segments: edges that share
+ * a node and have (anti)parallel Burgers vectors and slip plane normals belong to the
+ * same segment. The segments are the connected components of that relation and are found
+ * with a union-find over the edges, merged in parallel.
+ */
+namespace DislocationSegments
+{
+/**
+ * @brief Vertex to edge adjacency in compressed sparse row form: the edges that use
+ * vertex v are edges[offsets[v]] ... edges[offsets[v + 1] - 1], in ascending order.
+ * The vectors keep their capacity when the adjacency is rebuilt.
+ */
+struct VertexEdges
+{
+  std::vector<size_t> offsets;
+  std::vector<MeshIndexType> edges;
+
+  void build(size_t numVerts, const MeshIndexType* edgeList, size_t numEdges)
+  {
+    offsets.assign(numVerts + 1, 0);
+    for(size_t i = 0; i < 2 * numEdges; i++)
+    {
+      offsets[edgeList[i] + 1]++;
+    }
+    for(size_t v = 0; v < numVerts; v++)
+    {
+      offsets[v + 1] += offsets[v];
+    }
+    edges.resize(offsets[numVerts]);
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    for(size_t i = 0; i < numEdges; i++)
+    {
+      edges[fill[edgeList[2 * i + 0]]++] = static_cast<MeshIndexType>(i);
+      edges[fill[edgeList[2 * i + 1]]++] = static_cast<MeshIndexType>(i);
+    }
+  }
+};
+
+/**
+ * @brief Returns true if the two edges have (anti)parallel Burgers vectors and
+ * (anti)parallel slip plane normals within 1 degree
+ */
+inline bool sameSegment(const float* burgersVectors, const float* slipPlaneNormals, size_t edge1, size_t edge2)
+{
+  const float angleTol = 1.0 * SIMPLib::Constants::k_PiD / 180.0f;
+  float refBV[3] = {burgersVectors[3 * edge1 + 0], burgersVectors[3 * edge1 + 1], burgersVectors[3 * edge1 + 2]};
+  float neighBV[3] = {burgersVectors[3 * edge2 + 0], burgersVectors[3 * edge2 + 1], burgersVectors[3 * edge2 + 2]};
+  float angleBV = GeometryMath::AngleBetweenVectors(refBV, neighBV);
+  if(!(angleBV < angleTol || (SIMPLib::Constants::k_PiD - angleBV) < angleTol))
+  {
+    return false;
+  }
+  float refSPN[3] = {slipPlaneNormals[3 * edge1 + 0], slipPlaneNormals[3 * edge1 + 1], slipPlaneNormals[3 * edge1 + 2]};
+  float neighSPN[3] = {slipPlaneNormals[3 * edge2 + 0], slipPlaneNormals[3 * edge2 + 1], slipPlaneNormals[3 * edge2 + 2]};
+  float angleSPN = GeometryMath::AngleBetweenVectors(refSPN, neighSPN);
+  return angleSPN < angleTol || (SIMPLib::Constants::k_PiD - angleSPN) < angleTol;
+}
+
+/**
+ * @brief Unites every edge in a range with the higher numbered edges it shares a
+ * vertex with and matches
+ */
+class UniteEdgesImpl
+{
+public:
+  UniteEdgesImpl(const MeshIndexType* edgeList, const float* burgersVectors, const float* slipPlaneNormals, const VertexEdges& adjacency, ConcurrentUnionFind<MeshIndexType>& forest)
+  : m_EdgeList(edgeList)
+  , m_BurgersVectors(burgersVectors)
+  , m_SlipPlaneNormals(slipPlaneNormals)
+  , m_Adjacency(adjacency)
+  , m_Forest(forest)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      for(size_t iter = 0; iter < 2; iter++)
+      {
+        MeshIndexType vert = m_EdgeList[2 * i + iter];
+        for(size_t k = m_Adjacency.offsets[vert]; k < m_Adjacency.offsets[vert + 1]; k++)
+        {
+          MeshIndexType neighbor = m_Adjacency.edges[k];
+          // The match is symmetric, so each pair only needs to be tested from its lower edge
+          if(neighbor > i && sameSegment(m_BurgersVectors, m_SlipPlaneNormals, i, neighbor))
+          {
+            m_Forest.unite(static_cast<MeshIndexType>(i), neighbor);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const MeshIndexType* m_EdgeList = nullptr;
+  const float* m_BurgersVectors = nullptr;
+  const float* m_SlipPlaneNormals = nullptr;
+  const VertexEdges& m_Adjacency;
+  ConcurrentUnionFind<MeshIndexType>& m_Forest;
+};
+
+/**
+ * @brief Labels every edge with the id of its dislocation segment. The matching edge
+ * pairs are united in parallel and the sets are then numbered from 1 in the order of
+ * their lowest edge, so the labels do not depend on the thread schedule.
+ * @param edgeList Two vertex indices per edge
+ * @param adjacency Vertex to edge adjacency of edgeList
+ * @param ids Receives one id per edge
+ * @param forest Work buffer, reused between calls
+ * @return Number of segments
+ */
+inline int32_t identify(const MeshIndexType* edgeList, size_t numEdges, const float* burgersVectors, const float* slipPlaneNormals, const VertexEdges& adjacency, int32_t* ids,
+                        ConcurrentUnionFind<MeshIndexType>& forest)
+{
+  if(numEdges == 0)
+  {
+    return 0;
+  }
+  forest.reset(numEdges);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numEdges);
+  dataAlg.execute(UniteEdgesImpl(edgeList, burgersVectors, slipPlaneNormals, adjacency, forest));
+
+  // A root is the lowest edge of its set, so it is labeled before any other member
+  int32_t dnum = 0;
+  for(size_t i = 0; i < numEdges; i++)
+  {
+    MeshIndexType root = forest.find(static_cast<MeshIndexType>(i));
+    if(root == i)
+    {
+      dnum++;
+      ids[i] = dnum;
+    }
+    else
+    {
+      ids[i] = ids[root];
+    }
+  }
+  return dnum;
+}
+} // namespace DislocationSegments
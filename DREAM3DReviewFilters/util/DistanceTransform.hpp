@@ -0,0 +1,185 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Exact Euclidean distance transform of a regular 3D grid following
+ * Felzenszwalb & Huttenlocher, "Distance Transforms of Sampled Functions". The
+ * squared distance is separable, so three passes of a 1D lower envelope of
+ * parabolas (one per axis) give the exact result in O(N). Within a pass every grid
+ * line is independent, so the lines are processed in parallel. Along with the
+ * distance, the index of the nearest seed point (the feature transform) is tracked.
+ */
+namespace DistanceTransform
+{
+/**
+ * @brief Runs the 1D transform along one axis for a range of grid lines
+ */
+class LinePassImpl
+{
+public:
+  LinePassImpl(const std::array<size_t, 3>& dims, double spacing, size_t axis, std::vector<double>& squaredDistances, std::vector<int64_t>& nearestSeeds)
+  : m_Dims(dims)
+  , m_Spacing(spacing)
+  , m_Axis(axis)
+  , m_SquaredDistances(squaredDistances)
+  , m_NearestSeeds(nearestSeeds)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t length = m_Dims[m_Axis];
+    std::vector<double> values(length);
+    std::vector<int64_t> seeds(length);
+    std::vector<size_t> vertices(length);
+    std::vector<double> boundaries(length + 1);
+    for(size_t line = range.min(); line < range.max(); line++)
+    {
+      size_t first = 0;
+      size_t stride = 0;
+      lineStart(line, first, stride);
+      for(size_t i = 0; i < length; i++)
+      {
+        values[i] = m_SquaredDistances[first + i * stride];
+        seeds[i] = m_NearestSeeds[first + i * stride];
+      }
+      transformLine(values, seeds, vertices, boundaries, first, stride);
+    }
+  }
+
+private:
+  const std::array<size_t, 3>& m_Dims;
+  double m_Spacing = 1.0;
+  size_t m_Axis = 0;
+  std::vector<double>& m_SquaredDistances;
+  std::vector<int64_t>& m_NearestSeeds;
+
+  /**
+   * @brief Finds the first point and the stride of a grid line along m_Axis
+   */
+  void lineStart(size_t line, size_t& first, size_t& stride) const
+  {
+    size_t planeSize = m_Dims[0] * m_Dims[1];
+    if(m_Axis == 0)
+    {
+      first = line * m_Dims[0];
+      stride = 1;
+    }
+    else if(m_Axis == 1)
+    {
+      first = (line / m_Dims[0]) * planeSize + line % m_Dims[0];
+      stride = m_Dims[0];
+    }
+    else
+    {
+      first = line;
+      stride = planeSize;
+    }
+  }
+
+  /**
+   * @brief Computes the lower envelope of the parabolas rooted at the finite values
+   * of the line and samples it back onto the line
+   */
+  void transformLine(const std::vector<double>& values, const std::vector<int64_t>& seeds, std::vector<size_t>& vertices, std::vector<double>& boundaries, size_t first, size_t stride) const
+  {
+    constexpr double k_Infinity = std::numeric_limits<double>::infinity();
+    const double spacingSquared = m_Spacing * m_Spacing;
+    size_t length = values.size();
+
+    // Intersection (in grid units) of the parabolas rooted at p and q, with p < q
+    const auto intersection = [&](size_t p, size_t q) {
+      double dp = static_cast<double>(p);
+      double dq = static_cast<double>(q);
+      return ((values[q] + spacingSquared * dq * dq) - (values[p] + spacingSquared * dp * dp)) / (2.0 * spacingSquared * (dq - dp));
+    };
+
+    int64_t k = -1;
+    for(size_t q = 0; q < length; q++)
+    {
+      if(values[q] == k_Infinity)
+      {
+        continue;
+      }
+      double s = -k_Infinity;
+      while(k >= 0)
+      {
+        s = intersection(vertices[k], q);
+        if(s > boundaries[k])
+        {
+          break;
+        }
+        k--;
+      }
+      k++;
+      vertices[k] = q;
+      boundaries[k] = k < 1 ? -k_Infinity : s;
+      boundaries[k + 1] = k_Infinity;
+    }
+
+    if(k < 0)
+    {
+      // No seed on this line or on any line feeding into it
+      for(size_t q = 0; q < length; q++)
+      {
+        m_SquaredDistances[first + q * stride] = k_Infinity;
+        m_NearestSeeds[first + q * stride] = -1;
+      }
+      return;
+    }
+
+    size_t j = 0;
+    for(size_t q = 0; q < length; q++)
+    {
+      while(boundaries[j + 1] < static_cast<double>(q))
+      {
+        j++;
+      }
+      double delta = m_Spacing * (static_cast<double>(q) - static_cast<double>(vertices[j]));
+      m_SquaredDistances[first + q * stride] = delta * delta + values[vertices[j]];
+      m_NearestSeeds[first + q * stride] = seeds[vertices[j]];
+    }
+  }
+};
+
+/**
+ * @brief Computes the squared Euclidean distance from every grid point to the
+ * nearest seed point, together with the index of that seed
+ * @param dims Number of points along x, y and z
+ * @param spacing Point spacing along x, y and z
+ * @param isSeed Callable bool(size_t index) that marks the seed points
+ * @param squaredDistances Receives the squared distances; infinity if there is no seed
+ * @param nearestSeeds Receives the index of the nearest seed; -1 if there is no seed
+ */
+template <typename SeedFunc>
+void computeSquared(const std::array<size_t, 3>& dims, const std::array<double, 3>& spacing, const SeedFunc& isSeed, std::vector<double>& squaredDistances, std::vector<int64_t>& nearestSeeds)
+{
+  size_t totalPoints = dims[0] * dims[1] * dims[2];
+  squaredDistances.resize(totalPoints);
+  nearestSeeds.resize(totalPoints);
+  for(size_t i = 0; i < totalPoints; i++)
+  {
+    bool seed = isSeed(i);
+    squaredDistances[i] = seed ? 0.0 : std::numeric_limits<double>::infinity();
+    nearestSeeds[i] = seed ? static_cast<int64_t>(i) : -1;
+  }
+  if(totalPoints == 0)
+  {
+    return;
+  }
+
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints / dims[axis]);
+    dataAlg.execute(LinePassImpl(dims, spacing[axis], axis, squaredDistances, nearestSeeds));
+  }
+}
+} // namespace DistanceTransform
@@ -0,0 +1,797 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Geometry/MeshStructs.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/StatisticsHelpers.hpp"
+
+/**
+ * @brief Statistics of a scalar array computed separately for every group (Feature or
+ * Ensemble) of a group id array. Statistics that only need running sums are accumulated
+ * per group while streaming over the array, so the values are never regrouped. Medians
+ * need the values of a group together: the values are then counting sorted by group
+ * into one contiguous buffer, and every group is processed in parallel with a fused pass
+ * over its slice of that buffer and nth_element for the median and percentiles. The
+ * results are the same as the StatisticsHelpers functions applied to the values of each
+ * group in order, except for the streamed standard deviation, which is merged from chunk
+ * moments in double precision. Alternatively the median and percentiles can be approximated with one
+ * StatisticsHelpers::QuantileSketch per group, which needs a bounded amount of memory per
+ * group instead of a copy of the array.
+ */
+namespace GroupedStatistics
+{
+/**
+ * @brief Accumulator type of StatisticsHelpers::computeSum for values of type T
+ */
+template <typename T>
+using SumType = decltype(StatisticsHelpers::computeSum(std::vector<T>()));
+
+/**
+ * @brief Buffer element type for values of type T. Bytes are used for bool so groups
+ * can be written by different threads.
+ */
+template <typename T>
+using StorageType = std::conditional_t<std::is_same<T, bool>::value, uint8_t, T>;
+
+/**
+ * @brief Per group output arrays. A nullptr array is not computed. The histogram
+ * holds numBins values per group and the percentiles one value per entry of
+ * percentileFractions.
+ */
+template <typename T>
+struct Outputs
+{
+  MeshIndexType* length = nullptr;
+  T* minimum = nullptr;
+  T* maximum = nullptr;
+  float* mean = nullptr;
+  float* median = nullptr;
+  float* stdDeviation = nullptr;
+  float* summation = nullptr;
+  float* histogram = nullptr;
+  int32_t numBins = 0;
+  bool histogramFullRange = false;
+  float histogramMin = 0.0f;
+  float histogramMax = 0.0f;
+  float* percentiles = nullptr;
+  std::vector<double> percentileFractions;
+  float* interquartileRange = nullptr;
+  bool approximateQuantiles = false;
+  double sketchCompression = 100.0;
+
+  bool needsQuantiles() const
+  {
+    return nullptr != median || nullptr != percentiles || nullptr != interquartileRange;
+  }
+
+  bool needsSecondPass() const
+  {
+    return nullptr != stdDeviation || nullptr != histogram;
+  }
+};
+
+namespace Detail
+{
+/**
+ * @brief Group of value i, or -1 if the value is masked out or its group id is outside
+ * [0, numGroups). A nullptr groupIds puts every value in group 0.
+ */
+inline int64_t groupOf(size_t i, const int32_t* groupIds, const bool* mask, size_t numGroups)
+{
+  if(nullptr != mask && !mask[i])
+  {
+    return -1;
+  }
+  int64_t group = nullptr == groupIds ? 0 : groupIds[i];
+  return group < static_cast<int64_t>(numGroups) ? group : -1;
+}
+
+/**
+ * @brief Mean of a group from its sum, matching StatisticsHelpers::findMean. For bool
+ * the "mean" is the majority value.
+ */
+template <typename T>
+float mean(SumType<T> sum, size_t count)
+{
+  if(count == 0)
+  {
+    return 0.0f;
+  }
+  if constexpr(std::is_same<T, bool>::value)
+  {
+    return sum >= (count - sum) ? 1.0f : 0.0f;
+  }
+  else
+  {
+    return static_cast<float>(sum) / static_cast<float>(count);
+  }
+}
+
+/**
+ * @brief Mean used for the deviations, computed as in StatisticsHelpers::findStdDeviation
+ */
+template <typename T>
+float deviationMean(SumType<T> sum, size_t count)
+{
+  return static_cast<float>(sum) / count;
+}
+
+/**
+ * @brief Adds one squared deviation to the float accumulator used by
+ * StatisticsHelpers::findStdDeviation
+ */
+inline void addSquaredDeviation(float& squaredSum, float value, float mean)
+{
+  double difference = value - mean;
+  squaredSum = static_cast<float>(squaredSum + difference * difference);
+}
+
+/**
+ * @brief Standard deviation of a group from its accumulated squared deviations. For bool
+ * it is the majority value, as in StatisticsHelpers::findStdDeviation.
+ */
+template <typename T>
+float stdDeviation(float squaredSum, SumType<T> sum, size_t count)
+{
+  if(count == 0)
+  {
+    return 0.0f;
+  }
+  if constexpr(std::is_same<T, bool>::value)
+  {
+    return sum >= (count - sum) ? 1.0f : 0.0f;
+  }
+  else
+  {
+    return std::sqrt(squaredSum / count);
+  }
+}
+
+/**
+ * @brief Histogram binning of one group
+ */
+struct HistogramBins
+{
+  float min = 0.0f;
+  float max = 0.0f;
+  float increment = 0.0f;
+  int32_t numBins = 0;
+
+  /**
+   * @brief Sets up the bins of a group with the given value range; a single bin is used
+   * when the range is degenerate
+   */
+  HistogramBins(float rangeMin, float rangeMax, int32_t bins)
+  : min(rangeMin)
+  , max(rangeMax)
+  , increment((rangeMax - rangeMin) / bins)
+  , numBins(bins)
+  {
+    if(std::abs(increment) < 1E-10)
+    {
+      numBins = 1;
+    }
+  }
+
+  /**
+   * @brief Counts a value into the bins. Values that fall outside the range are dropped,
+   * except for the range maximum, which goes into the last bin.
+   */
+  void add(float* bins, float value) const
+  {
+    if(numBins == 1)
+    {
+      bins[0]++;
+      return;
+    }
+    float position = (value - min) / increment;
+    if(position > -1.0f && position < static_cast<float>(numBins))
+    {
+      bins[static_cast<size_t>(position)]++;
+    }
+    else if(value == max)
+    {
+      bins[numBins - 1]++;
+    }
+  }
+};
+
+/**
+ * @brief Histogram range of a group
+ */
+template <typename T>
+HistogramBins histogramBins(const Outputs<T>& outputs, StorageType<T> groupMin, StorageType<T> groupMax)
+{
+  if(outputs.histogramFullRange)
+  {
+    return HistogramBins(static_cast<float>(static_cast<T>(groupMin)), static_cast<float>(static_cast<T>(groupMax)), outputs.numBins);
+  }
+  return HistogramBins(outputs.histogramMin, outputs.histogramMax, outputs.numBins);
+}
+
+/**
+ * @brief Median of a slice, reordering the slice; matches StatisticsHelpers::findMedian
+ */
+template <typename T>
+float median(StorageType<T>* values, size_t count)
+{
+  if(count == 0)
+  {
+    return 0.0f;
+  }
+  size_t half = count / 2;
+  std::nth_element(values, values + half, values + count);
+  T high = static_cast<T>(values[half]);
+  if(count % 2 == 1)
+  {
+    return high;
+  }
+  T low = static_cast<T>(*std::max_element(values, values + half));
+  return (low + high) * 0.5f;
+}
+
+/**
+ * @brief Writes the statistics that only depend on the count, the sum and the extrema
+ */
+template <typename T>
+void writeRunningStatistics(const Outputs<T>& out, size_t group, size_t count, SumType<T> sum, StorageType<T> groupMin, StorageType<T> groupMax)
+{
+  if(nullptr != out.length)
+  {
+    out.length[group] = static_cast<MeshIndexType>(count);
+  }
+  if(nullptr != out.minimum)
+  {
+    out.minimum[group] = static_cast<T>(groupMin);
+  }
+  if(nullptr != out.maximum)
+  {
+    out.maximum[group] = static_cast<T>(groupMax);
+  }
+  if(nullptr != out.mean)
+  {
+    out.mean[group] = Detail::mean<T>(sum, count);
+  }
+  if(nullptr != out.summation)
+  {
+    out.summation[group] = static_cast<float>(sum);
+  }
+}
+
+/**
+ * @brief Writes the percentiles and the interquartile range of a group
+ * @param quantile Callable double(double fraction)
+ */
+template <typename T, typename QuantileFunc>
+void writeQuantiles(const Outputs<T>& out, size_t group, const QuantileFunc& quantile)
+{
+  if(nullptr != out.percentiles)
+  {
+    size_t numPercentiles = out.percentileFractions.size();
+    for(size_t p = 0; p < numPercentiles; p++)
+    {
+      out.percentiles[group * numPercentiles + p] = static_cast<float>(quantile(out.percentileFractions[p]));
+    }
+  }
+  if(nullptr != out.interquartileRange)
+  {
+    out.interquartileRange[group] = static_cast<float>(quantile(0.75) - quantile(0.25));
+  }
+}
+
+/**
+ * @brief Computes all the requested statistics of a range of groups from their slices of
+ * the grouped buffer
+ */
+template <typename T>
+class GroupSliceImpl
+{
+public:
+  GroupSliceImpl(std::vector<StorageType<T>>& values, const std::vector<size_t>& offsets, const Outputs<T>& outputs)
+  : m_Values(values)
+  , m_Offsets(offsets)
+  , m_Outputs(outputs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t group = range.min(); group < range.max(); group++)
+    {
+      compute(group, m_Values.data() + m_Offsets[group], m_Offsets[group + 1] - m_Offsets[group]);
+    }
+  }
+
+private:
+  std::vector<StorageType<T>>& m_Values;
+  const std::vector<size_t>& m_Offsets;
+  const Outputs<T>& m_Outputs;
+
+  void compute(size_t group, StorageType<T>* values, size_t count) const
+  {
+    const Outputs<T>& out = m_Outputs;
+
+    // Fused pass: count, sum and extrema
+    SumType<T> sum = 0;
+    StorageType<T> groupMin = count > 0 ? values[0] : StorageType<T>(0);
+    StorageType<T> groupMax = groupMin;
+    for(size_t i = 0; i < count; i++)
+    {
+      sum += values[i];
+      groupMin = std::min(groupMin, values[i]);
+      groupMax = std::max(groupMax, values[i]);
+    }
+    writeRunningStatistics<T>(out, group, count, sum, groupMin, groupMax);
+
+    // Second pass over the (cache resident) slice: deviations and histogram
+    if(out.needsSecondPass())
+    {
+      float deviationMean = count > 0 ? Detail::deviationMean<T>(sum, count) : 0.0f;
+      float squaredSum = 0.0f;
+      float* bins = nullptr;
+      HistogramBins binning(0.0f, 0.0f, 1);
+      if(nullptr != out.histogram)
+      {
+        bins = out.histogram + group * out.numBins;
+        std::fill(bins, bins + out.numBins, 0.0f);
+        binning = histogramBins(out, groupMin, groupMax);
+      }
+      for(size_t i = 0; i < count; i++)
+      {
+        float value = static_cast<float>(values[i]);
+        if(nullptr != out.stdDeviation)
+        {
+          addSquaredDeviation(squaredSum, value, deviationMean);
+        }
+        if(nullptr != bins)
+        {
+          binning.add(bins, value);
+        }
+      }
+      if(nullptr != out.stdDeviation)
+      {
+        out.stdDeviation[group] = Detail::stdDeviation<T>(squaredSum, sum, count);
+      }
+    }
+
+    // Last, since they reorder the slice
+    if(nullptr != out.median)
+    {
+      out.median[group] = Detail::median<T>(values, count);
+    }
+    writeQuantiles(out, group, [&](double fraction) { return StatisticsHelpers::findPercentileInPlace(values, count, fraction); });
+  }
+};
+
+/**
+ * @brief Sketches the values of one chunk of the array, with one sketch per group
+ */
+template <typename T>
+class SketchChunksImpl
+{
+public:
+  SketchChunksImpl(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups, double compression,
+                   std::vector<std::vector<StatisticsHelpers::QuantileSketch>>& sketches)
+  : m_Data(data)
+  , m_GroupIds(groupIds)
+  , m_Mask(mask)
+  , m_NumTuples(numTuples)
+  , m_NumGroups(numGroups)
+  , m_Compression(compression)
+  , m_Sketches(sketches)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t numChunks = m_Sketches.size();
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<StatisticsHelpers::QuantileSketch>& sketches = m_Sketches[chunk];
+      sketches.assign(m_NumGroups, StatisticsHelpers::QuantileSketch(m_Compression));
+      for(size_t i = m_NumTuples * chunk / numChunks; i < m_NumTuples * (chunk + 1) / numChunks; i++)
+      {
+        int64_t group = groupOf(i, m_GroupIds, m_Mask, m_NumGroups);
+        if(group >= 0)
+        {
+          sketches[group].add(static_cast<double>(m_Data[i]));
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Data = nullptr;
+  const int32_t* m_GroupIds = nullptr;
+  const bool* m_Mask = nullptr;
+  size_t m_NumTuples = 0;
+  size_t m_NumGroups = 0;
+  double m_Compression = 100.0;
+  std::vector<std::vector<StatisticsHelpers::QuantileSketch>>& m_Sketches;
+};
+
+/**
+ * @brief Merges the chunk sketches of a range of groups, in chunk order, and writes their
+ * quantiles
+ */
+template <typename T>
+class MergeSketchesImpl
+{
+public:
+  MergeSketchesImpl(std::vector<std::vector<StatisticsHelpers::QuantileSketch>>& sketches, const Outputs<T>& outputs)
+  : m_Sketches(sketches)
+  , m_Outputs(outputs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t group = range.min(); group < range.max(); group++)
+    {
+      StatisticsHelpers::QuantileSketch& sketch = m_Sketches[0][group];
+      for(size_t chunk = 1; chunk < m_Sketches.size(); chunk++)
+      {
+        sketch.merge(m_Sketches[chunk][group]);
+        m_Sketches[chunk][group] = StatisticsHelpers::QuantileSketch();
+      }
+      if(nullptr != m_Outputs.median)
+      {
+        m_Outputs.median[group] = static_cast<float>(sketch.quantile(0.5));
+      }
+      writeQuantiles(m_Outputs, group, [&](double fraction) { return sketch.quantile(fraction); });
+    }
+  }
+
+private:
+  std::vector<std::vector<StatisticsHelpers::QuantileSketch>>& m_Sketches;
+  const Outputs<T>& m_Outputs;
+};
+/**
+ * @brief Running statistics of the values of one group in one chunk of the array. The
+ * centered moments are merged as in Chan et al., so partials of consecutive chunks can be
+ * combined without a second pass over the values.
+ */
+template <typename T>
+struct RunningPartial
+{
+  size_t count = 0;
+  SumType<T> sum = 0;
+  StorageType<T> min = StorageType<T>(0);
+  StorageType<T> max = StorageType<T>(0);
+  double mean = 0.0;
+  double squaredDeviations = 0.0;
+
+  void add(StorageType<T> value, bool moments)
+  {
+    sum += value;
+    min = count == 0 ? value : std::min(min, value);
+    max = count == 0 ? value : std::max(max, value);
+    count++;
+    if(moments)
+    {
+      double delta = static_cast<double>(value) - mean;
+      mean += delta / static_cast<double>(count);
+      squaredDeviations += delta * (static_cast<double>(value) - mean);
+    }
+  }
+
+  void merge(const RunningPartial& other)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(count == 0)
+    {
+      *this = other;
+      return;
+    }
+    double total = static_cast<double>(count + other.count);
+    double delta = other.mean - mean;
+    mean += delta * static_cast<double>(other.count) / total;
+    squaredDeviations += other.squaredDeviations + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / total;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    count += other.count;
+  }
+};
+
+/**
+ * @brief Streams over one chunk of the array, accumulating the running partials of every
+ * group and, when the bins are given, the histogram of every group
+ */
+template <typename T>
+class StreamChunksImpl
+{
+public:
+  StreamChunksImpl(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups, bool running, bool moments, const std::vector<HistogramBins>* binnings,
+                   int32_t numBins, std::vector<std::vector<RunningPartial<T>>>& partials, std::vector<std::vector<float>>& histograms)
+  : m_Data(data)
+  , m_GroupIds(groupIds)
+  , m_Mask(mask)
+  , m_NumTuples(numTuples)
+  , m_NumGroups(numGroups)
+  , m_Running(running)
+  , m_Moments(moments)
+  , m_Binnings(binnings)
+  , m_NumBins(numBins)
+  , m_Partials(partials)
+  , m_Histograms(histograms)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t numChunks = m_Partials.size();
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<RunningPartial<T>>& partials = m_Partials[chunk];
+      float* bins = nullptr;
+      if(m_Running)
+      {
+        partials.assign(m_NumGroups, RunningPartial<T>());
+      }
+      if(nullptr != m_Binnings)
+      {
+        m_Histograms[chunk].assign(m_NumGroups * m_NumBins, 0.0f);
+        bins = m_Histograms[chunk].data();
+      }
+      for(size_t i = m_NumTuples * chunk / numChunks; i < m_NumTuples * (chunk + 1) / numChunks; i++)
+      {
+        int64_t group = groupOf(i, m_GroupIds, m_Mask, m_NumGroups);
+        if(group < 0)
+        {
+          continue;
+        }
+        if(m_Running)
+        {
+          partials[group].add(static_cast<StorageType<T>>(m_Data[i]), m_Moments);
+        }
+        if(nullptr != bins)
+        {
+          (*m_Binnings)[group].add(bins + group * m_NumBins, static_cast<float>(m_Data[i]));
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Data = nullptr;
+  const int32_t* m_GroupIds = nullptr;
+  const bool* m_Mask = nullptr;
+  size_t m_NumTuples = 0;
+  size_t m_NumGroups = 0;
+  bool m_Running = true;
+  bool m_Moments = false;
+  const std::vector<HistogramBins>* m_Binnings = nullptr;
+  int32_t m_NumBins = 0;
+  std::vector<std::vector<RunningPartial<T>>>& m_Partials;
+  std::vector<std::vector<float>>& m_Histograms;
+};
+
+/**
+ * @brief Merges the chunk partials of a range of groups, in chunk order, into the partials
+ * of chunk 0 and writes their running statistics and standard deviations
+ */
+template <typename T>
+class MergePartialsImpl
+{
+public:
+  MergePartialsImpl(std::vector<std::vector<RunningPartial<T>>>& partials, const Outputs<T>& outputs)
+  : m_Partials(partials)
+  , m_Outputs(outputs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t group = range.min(); group < range.max(); group++)
+    {
+      RunningPartial<T>& partial = m_Partials[0][group];
+      for(size_t chunk = 1; chunk < m_Partials.size(); chunk++)
+      {
+        partial.merge(m_Partials[chunk][group]);
+      }
+      writeRunningStatistics<T>(m_Outputs, group, partial.count, partial.sum, partial.min, partial.max);
+      if(nullptr != m_Outputs.stdDeviation)
+      {
+        m_Outputs.stdDeviation[group] = Detail::stdDeviation<T>(static_cast<float>(partial.squaredDeviations), partial.sum, partial.count);
+      }
+    }
+  }
+
+private:
+  std::vector<std::vector<RunningPartial<T>>>& m_Partials;
+  const Outputs<T>& m_Outputs;
+};
+} // namespace Detail
+
+/**
+ * @brief Values of an array counting sorted by group id into one contiguous buffer: the
+ * values of group g are values[offsets[g]] ... values[offsets[g + 1] - 1], in array order.
+ */
+template <typename T>
+struct GroupedValues
+{
+  std::vector<size_t> offsets;
+  std::vector<StorageType<T>> values;
+
+  /**
+   * @brief Groups the values whose mask is set (or all values if mask is nullptr). Values
+   * whose group id is outside [0, numGroups) are skipped; a nullptr groupIds puts every
+   * value in group 0.
+   */
+  void build(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups)
+  {
+    offsets.assign(numGroups + 1, 0);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int64_t group = Detail::groupOf(i, groupIds, mask, numGroups);
+      if(group >= 0)
+      {
+        offsets[group + 1]++;
+      }
+    }
+    for(size_t g = 0; g < numGroups; g++)
+    {
+      offsets[g + 1] += offsets[g];
+    }
+    values.resize(offsets[numGroups]);
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int64_t group = Detail::groupOf(i, groupIds, mask, numGroups);
+      if(group >= 0)
+      {
+        values[fill[group]++] = static_cast<StorageType<T>>(data[i]);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Computes the requested statistics by streaming over the array with one set of
+ * running sums per group. The median, percentiles and interquartile range are not
+ * computed. The array is split into chunks that are accumulated in parallel, and the
+ * chunk partials of every group are then merged in order; as for computeSketched the
+ * chunking only depends on the number of values and groups, so the result is
+ * reproducible. The array is read once, or twice if a histogram over the full range of
+ * every group is requested, since its bins depend on the group extrema.
+ * @param data Values
+ * @param groupIds Group of every value; nullptr puts every value in group 0
+ * @param mask Values to include; nullptr includes all values
+ */
+template <typename T>
+void computeStreaming(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups, const Outputs<T>& outputs)
+{
+  constexpr size_t k_MinChunkSize = 1 << 16;
+  constexpr size_t k_MaxChunks = 64;
+  constexpr size_t k_MaxPartials = 1 << 22;
+  const bool histogram = nullptr != outputs.histogram;
+  size_t partialsPerChunk = std::max<size_t>(1, numGroups * (1 + (histogram ? static_cast<size_t>(outputs.numBins) : 0)));
+  size_t numChunks = std::min(numTuples / k_MinChunkSize, k_MaxChunks);
+  numChunks = std::max<size_t>(1, std::min(numChunks, k_MaxPartials / partialsPerChunk));
+
+  // A fixed histogram range is binned in the same pass as the running sums
+  std::vector<Detail::HistogramBins> binnings;
+  if(histogram && !outputs.histogramFullRange)
+  {
+    binnings.assign(numGroups, Detail::histogramBins(outputs, StorageType<T>(0), StorageType<T>(0)));
+  }
+
+  std::vector<std::vector<Detail::RunningPartial<T>>> partials(numChunks);
+  std::vector<std::vector<float>> histograms(numChunks);
+  ParallelDataAlgorithm chunkAlg;
+  chunkAlg.setRange(0, numChunks);
+  chunkAlg.execute(Detail::StreamChunksImpl<T>(data, groupIds, mask, numTuples, numGroups, true, nullptr != outputs.stdDeviation, binnings.empty() ? nullptr : &binnings, outputs.numBins,
+                                               partials, histograms));
+
+  ParallelDataAlgorithm groupAlg;
+  groupAlg.setRange(0, numGroups);
+  groupAlg.execute(Detail::MergePartialsImpl<T>(partials, outputs));
+
+  if(!histogram)
+  {
+    return;
+  }
+
+  if(outputs.histogramFullRange)
+  {
+    binnings.reserve(numGroups);
+    for(size_t g = 0; g < numGroups; g++)
+    {
+      binnings.push_back(Detail::histogramBins(outputs, partials[0][g].min, partials[0][g].max));
+    }
+    ParallelDataAlgorithm binAlg;
+    binAlg.setRange(0, numChunks);
+    binAlg.execute(Detail::StreamChunksImpl<T>(data, groupIds, mask, numTuples, numGroups, false, false, &binnings, outputs.numBins, partials, histograms));
+  }
+
+  // Merge the chunk histograms in chunk order
+  std::fill(outputs.histogram, outputs.histogram + numGroups * outputs.numBins, 0.0f);
+  for(const std::vector<float>& chunkHistogram : histograms)
+  {
+    for(size_t b = 0; b < chunkHistogram.size(); b++)
+    {
+      outputs.histogram[b] += chunkHistogram[b];
+    }
+  }
+}
+
+/**
+ * @brief Approximates the median, percentiles and interquartile range of every group.
+ * The array is split into chunks that are sketched in parallel, and the chunk sketches of
+ * every group are then merged in order. The chunking depends only on the number of values
+ * and groups, never on the machine, so the result is reproducible; the number of chunks is
+ * limited so the sketches of all the chunks stay within a fixed budget.
+ * @param data Values
+ * @param groupIds Group of every value; nullptr puts every value in group 0
+ * @param mask Values to include; nullptr includes all values
+ */
+template <typename T>
+void computeSketched(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups, const Outputs<T>& outputs)
+{
+  constexpr size_t k_MinChunkSize = 1 << 16;
+  constexpr size_t k_MaxChunks = 64;
+  constexpr size_t k_MaxSketches = 1 << 22;
+  size_t numChunks = std::min(numTuples / k_MinChunkSize, k_MaxChunks);
+  numChunks = std::max<size_t>(1, std::min(numChunks, k_MaxSketches / std::max<size_t>(numGroups, 1)));
+
+  std::vector<std::vector<StatisticsHelpers::QuantileSketch>> sketches(numChunks);
+  ParallelDataAlgorithm chunkAlg;
+  chunkAlg.setRange(0, numChunks);
+  chunkAlg.execute(Detail::SketchChunksImpl<T>(data, groupIds, mask, numTuples, numGroups, outputs.sketchCompression, sketches));
+
+  ParallelDataAlgorithm groupAlg;
+  groupAlg.setRange(0, numGroups);
+  groupAlg.execute(Detail::MergeSketchesImpl<T>(sketches, outputs));
+}
+
+/**
+ * @brief Computes the requested statistics, including the median, from values already
+ * grouped. The groups are processed in parallel and the buffer is reordered within each
+ * group.
+ */
+template <typename T>
+void computeGrouped(GroupedValues<T>& grouped, const Outputs<T>& outputs)
+{
+  size_t numGroups = grouped.offsets.empty() ? 0 : grouped.offsets.size() - 1;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numGroups);
+  dataAlg.execute(Detail::GroupSliceImpl<T>(grouped.values, grouped.offsets, outputs));
+}
+
+/**
+ * @brief Computes the requested statistics of every group. The values are only regrouped
+ * (one extra copy of the masked array) if exact quantiles are requested; otherwise the
+ * array is streamed, and approximate quantiles are sketched.
+ * @param data Values
+ * @param groupIds Group of every value; nullptr puts every value in group 0
+ * @param mask Values to include; nullptr includes all values
+ */
+template <typename T>
+void compute(const T* data, const int32_t* groupIds, const bool* mask, size_t numTuples, size_t numGroups, const Outputs<T>& outputs)
+{
+  if(!outputs.needsQuantiles())
+  {
+    computeStreaming(data, groupIds, mask, numTuples, numGroups, outputs);
+    return;
+  }
+  if(outputs.approximateQuantiles)
+  {
+    computeStreaming(data, groupIds, mask, numTuples, numGroups, outputs);
+    computeSketched(data, groupIds, mask, numTuples, numGroups, outputs);
+    return;
+  }
+  GroupedValues<T> grouped;
+  grouped.build(data, groupIds, mask, numTuples, numGroups);
+  computeGrouped(grouped, outputs);
+}
+} // namespace GroupedStatistics
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Per layer statistics of the positive values of a volume, for layers normal to
+ * z (XY), y (XZ) or x (YZ). The volume is read once in storage order, whatever the
+ * layer orientation. Each slab of z planes accumulates its own partial moments in a single
+ * pass (Welford's update), and the partials are combined in slab order with the pairwise
+ * update of Chan, Golub & LeVeque. Planes can also be added as they arrive, for example
+ * while a volume is being imported, without keeping the volume.
+ */
+namespace LayerStatistics
+{
+/**
+ * @brief Orientation of the layers; the values match the filter's plane choices
+ */
+enum class Plane : unsigned int
+{
+  XY = 0,
+  XZ = 1,
+  YZ = 2
+};
+
+/**
+ * @brief Count, mean, sum of squared deviations and extrema of a set of values
+ */
+struct Moments
+{
+  uint64_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+  double min = std::numeric_limits<double>::max();
+  double max = std::numeric_limits<double>::lowest();
+
+  void add(double value)
+  {
+    count++;
+    double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+
+  void merge(const Moments& other)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(count == 0)
+    {
+      *this = other;
+      return;
+    }
+    double n = static_cast<double>(count + other.count);
+    double delta = other.mean - mean;
+    mean += delta * static_cast<double>(other.count) / n;
+    m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / n;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+
+  /**
+   * @brief Population variance
+   */
+  double variance() const
+  {
+    return count > 0 ? m2 / static_cast<double>(count) : 0.0;
+  }
+};
+
+/**
+ * @brief Number of layers of a volume for a plane orientation
+ */
+inline size_t numberOfLayers(const std::array<size_t, 3>& dims, Plane plane)
+{
+  switch(plane)
+  {
+  case Plane::XZ:
+    return dims[1];
+  case Plane::YZ:
+    return dims[0];
+  default:
+    return dims[2];
+  }
+}
+
+namespace Detail
+{
+/**
+ * @brief Accumulates a range of slabs of z planes into the partial moments of each slab.
+ * A slab only reads its own planes and only writes its own partials, and its layer ids.
+ * The planes are numbered from 0; zOffset is the number of the first one in the volume.
+ */
+template <typename T>
+class AccumulateSlabsImpl
+{
+public:
+  AccumulateSlabsImpl(const T* data, const std::array<size_t, 3>& dims, Plane plane, const std::vector<size_t>& slabBounds, std::vector<std::vector<Moments>>& partials, int32_t* layerIds,
+                      size_t zOffset)
+  : m_Data(data)
+  , m_Dims(dims)
+  , m_Plane(plane)
+  , m_SlabBounds(slabBounds)
+  , m_Partials(partials)
+  , m_LayerIds(layerIds)
+  , m_ZOffset(zOffset)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t slab = range.min(); slab < range.max(); slab++)
+    {
+      std::vector<Moments>& layers = m_Partials[slab];
+      layers.assign(numberOfLayers(m_Dims, m_Plane), Moments());
+      for(size_t z = m_SlabBounds[slab]; z < m_SlabBounds[slab + 1]; z++)
+      {
+        for(size_t y = 0; y < m_Dims[1]; y++)
+        {
+          size_t rowStart = (z * m_Dims[1] + y) * m_Dims[0];
+          for(size_t x = 0; x < m_Dims[0]; x++)
+          {
+            size_t layer = m_Plane == Plane::XY ? z : (m_Plane == Plane::XZ ? y : x);
+            if(nullptr != m_LayerIds)
+            {
+              m_LayerIds[rowStart + x] = static_cast<int32_t>(m_Plane == Plane::XY ? layer + m_ZOffset : layer);
+            }
+            T value = m_Data[rowStart + x];
+            if(value > 0)
+            {
+              layers[layer].add(static_cast<double>(value));
+            }
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Data = nullptr;
+  std::array<size_t, 3> m_Dims;
+  Plane m_Plane;
+  const std::vector<size_t>& m_SlabBounds;
+  std::vector<std::vector<Moments>>& m_Partials;
+  int32_t* m_LayerIds = nullptr;
+  size_t m_ZOffset = 0;
+};
+} // namespace Detail
+
+/**
+ * @brief Running layer statistics of a volume whose z planes are added in any order and in
+ * any grouping; every plane must be added exactly once
+ */
+class Accumulator
+{
+public:
+  static constexpr size_t k_MaxSlabs = 64;
+
+  Accumulator(const std::array<size_t, 3>& dims, Plane plane)
+  : m_Dims(dims)
+  , m_Plane(plane)
+  , m_Layers(numberOfLayers(dims, plane))
+  {
+  }
+
+  /**
+   * @brief Adds the z planes zBegin ... zEnd - 1, in parallel over at most k_MaxSlabs slabs
+   * of planes. The slabs only depend on the number of planes added, so the partials are
+   * merged in the same order on every machine.
+   * @param planes Values of the added planes only, x fastest
+   * @param layerIds Optional; receives the layer of every added value
+   */
+  template <typename T>
+  void addPlanes(const T* planes, size_t zBegin, size_t zEnd, int32_t* layerIds = nullptr)
+  {
+    if(zEnd <= zBegin)
+    {
+      return;
+    }
+    size_t numPlanes = zEnd - zBegin;
+    size_t numSlabs = std::min(numPlanes, k_MaxSlabs);
+    std::vector<size_t> slabBounds(numSlabs + 1);
+    for(size_t slab = 0; slab <= numSlabs; slab++)
+    {
+      slabBounds[slab] = (numPlanes * slab) / numSlabs;
+    }
+
+    // The slabs see the added planes as a volume of numPlanes planes
+    std::array<size_t, 3> dims = {m_Dims[0], m_Dims[1], numPlanes};
+    std::vector<std::vector<Moments>> partials(numSlabs);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    dataAlg.execute(Detail::AccumulateSlabsImpl<T>(planes, dims, m_Plane, slabBounds, partials, layerIds, zBegin));
+
+    size_t layerOffset = m_Plane == Plane::XY ? zBegin : 0;
+    for(size_t slab = 0; slab < numSlabs; slab++)
+    {
+      for(size_t layer = 0; layer < partials[slab].size(); layer++)
+      {
+        m_Layers[layer + layerOffset].merge(partials[slab][layer]);
+      }
+    }
+  }
+
+  const std::vector<Moments>& layers() const
+  {
+    return m_Layers;
+  }
+
+private:
+  std::array<size_t, 3> m_Dims;
+  Plane m_Plane;
+  std::vector<Moments> m_Layers;
+};
+} // namespace LayerStatistics
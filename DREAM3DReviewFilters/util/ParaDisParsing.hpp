@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/Geometry/MeshStructs.h"
+#include "SIMPLib/Math/MatrixMath.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsingHelpers.hpp"
+
+/**
+ * @brief Parser for ParaDis restart files. The parsed nodes and segments are stored in
+ * a Snapshot whose buffers keep their capacity, so a series of snapshots can be parsed
+ * into the same Snapshot without reallocating.
+ */
+namespace ParaDisParsing
+{
+/**
+ * @brief Contents of one ParaDis restart file. Positions and domain bounds are in microns.
+ */
+struct Snapshot
+{
+  int32_t fileVersion = 0;
+  int32_t numVerts = 0;
+  std::array<float, 6> domainBounds = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  std::vector<float> vertices;
+  std::vector<int32_t> numberOfArms;
+  std::vector<int32_t> nodeConstraints;
+  std::vector<MeshIndexType> edges;
+  std::vector<float> burgersVectors;
+  std::vector<float> slipPlaneNormals;
+  std::unordered_map<uint64_t, int32_t> nodeNumbers;
+
+  size_t numEdges() const
+  {
+    return edges.size() / 2;
+  }
+};
+
+namespace Detail
+{
+/**
+ * @brief Advances the scanner to the first line whose first token is keyword
+ * @return false if the keyword was not found before the end of the file
+ */
+inline bool seekKeyword(TextParsingHelpers::LineScanner& scanner, const char* keyword, const char*& lineBegin, const char*& lineEnd)
+{
+  while(scanner.readLine(lineBegin, lineEnd))
+  {
+    if(TextParsingHelpers::firstTokenEquals(lineBegin, lineEnd, keyword))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Parses the n-th white space delimited token of the line as a number
+ */
+template <typename T>
+bool parseToken(const char* lineBegin, const char* lineEnd, size_t n, T& value)
+{
+  const char* token = TextParsingHelpers::nthToken(lineBegin, lineEnd, n);
+  return nullptr != token && nullptr != TextParsingHelpers::parseNumber(token, lineEnd, value);
+}
+
+/**
+ * @brief Parses a ParaDis "domain,index" node tag into a single 64 bit key
+ * @return Pointer one past the tag, or nullptr if the tag is malformed
+ */
+inline const char* parseNodeTag(const char* p, const char* lineEnd, uint64_t& key)
+{
+  int32_t domain = 0;
+  int32_t index = 0;
+  p = TextParsingHelpers::parseNumber(p, lineEnd, domain);
+  if(nullptr != p)
+  {
+    p = TextParsingHelpers::expectChar(p, lineEnd, ',');
+  }
+  if(nullptr != p)
+  {
+    p = TextParsingHelpers::parseNumber(p, lineEnd, index);
+  }
+  key = (static_cast<uint64_t>(static_cast<uint32_t>(index)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(domain));
+  return p;
+}
+
+/**
+ * @brief Parses count consecutive floats starting at p
+ */
+inline const char* parseFloats(const char* p, const char* lineEnd, float* values, size_t count)
+{
+  for(size_t i = 0; i < count && nullptr != p; i++)
+  {
+    p = TextParsingHelpers::parseNumber(p, lineEnd, values[i]);
+  }
+  return p;
+}
+
+/**
+ * @brief Returns the local number of a node tag, numbering unseen tags consecutively
+ */
+inline int32_t nodeNumber(Snapshot& snapshot, uint64_t key, int32_t& nodeCounter)
+{
+  auto iter = snapshot.nodeNumbers.find(key);
+  if(iter != snapshot.nodeNumbers.end())
+  {
+    return iter->second;
+  }
+  int32_t number = nodeCounter;
+  snapshot.nodeNumbers.emplace(key, number);
+  nodeCounter++;
+  return number;
+}
+} // namespace Detail
+
+/**
+ * @brief Reads the header up to and including the nodal data description: the file
+ * version, the domain bounds and the node count
+ * @param scanner Scanner positioned at the start of the file
+ * @param burgersVector Burgers vector length in microns; positions are scaled by it
+ * @param filePath File name used in error messages
+ * @param message Receives the error message
+ * @return 0 on success, otherwise a negative error code
+ */
+inline int32_t readHeader(TextParsingHelpers::LineScanner& scanner, float burgersVector, const QString& filePath, Snapshot& snapshot, QString& message)
+{
+  const char* lineBegin = nullptr;
+  const char* lineEnd = nullptr;
+
+  // read Version line
+  if(!scanner.readLine(lineBegin, lineEnd) || !Detail::parseToken(lineBegin, lineEnd, 2, snapshot.fileVersion))
+  {
+    message = QObject::tr("Unable to parse the data file version from the first line of %1").arg(filePath);
+    return -101;
+  }
+
+  // read until get to minCoordinates line, then maxCoordinates line
+  const char* boundsKeywords[2] = {"minCoordinates", "maxCoordinates"};
+  for(int32_t b = 0; b < 2; b++)
+  {
+    if(!Detail::seekKeyword(scanner, boundsKeywords[b], lineBegin, lineEnd))
+    {
+      message = QObject::tr("Unable to find the '%1' section in %2").arg(boundsKeywords[b]).arg(filePath);
+      return -102;
+    }
+    for(int32_t i = 3 * b; i < 3 * b + 3; i++)
+    {
+      float value = 0.0f;
+      if(!scanner.readLine(lineBegin, lineEnd) || !Detail::parseToken(lineBegin, lineEnd, 0, value))
+      {
+        message = QObject::tr("Unable to parse the domain bounds at line %1 of %2").arg(scanner.lineNumber()).arg(filePath);
+        return -103;
+      }
+      snapshot.domainBounds[i] = value * burgersVector;
+    }
+  }
+
+  // read until get to nodeCount line
+  if(!Detail::seekKeyword(scanner, "nodeCount", lineBegin, lineEnd) || !Detail::parseToken(lineBegin, lineEnd, 2, snapshot.numVerts))
+  {
+    message = QObject::tr("Unable to find or parse the 'nodeCount' entry in %1").arg(filePath);
+    return -104;
+  }
+
+  // read until get to nodalData line
+  if(!Detail::seekKeyword(scanner, "nodalData", lineBegin, lineEnd))
+  {
+    message = QObject::tr("Unable to find the 'nodalData' section in %1").arg(filePath);
+    return -105;
+  }
+  // skip the nodal Data description lines
+  scanner.skipLines(2);
+  return 0;
+}
+
+/**
+ * @brief Reads the nodal data that follows the header. Every segment is listed by both
+ * of its nodes but only stored once.
+ * @param scanner Scanner positioned after the header
+ * @param burgersVector Burgers vector length in microns; positions are scaled by it
+ * @param filePath File name used in error messages
+ * @param isCanceled Callable bool() polled once per node; parsing stops early when it returns true
+ * @param message Receives the error message
+ * @return 0 on success or cancel, otherwise a negative error code
+ */
+template <typename CancelFunc>
+int32_t readNodes(TextParsingHelpers::LineScanner& scanner, float burgersVector, const QString& filePath, const CancelFunc& isCanceled, Snapshot& snapshot, QString& message)
+{
+  int32_t numVerts = std::max(snapshot.numVerts, 0);
+  snapshot.vertices.assign(3 * static_cast<size_t>(numVerts), 0.0f);
+  snapshot.numberOfArms.assign(static_cast<size_t>(numVerts), 0);
+  snapshot.nodeConstraints.assign(static_cast<size_t>(numVerts), 0);
+  snapshot.nodeNumbers.clear();
+  snapshot.nodeNumbers.reserve(static_cast<size_t>(numVerts));
+
+  // Each node lists all of its arms, but every segment is only stored once, so
+  // the number of segments is close to the number of nodes for typical networks
+  snapshot.edges.clear();
+  snapshot.burgersVectors.clear();
+  snapshot.slipPlaneNormals.clear();
+  snapshot.edges.reserve(2 * static_cast<size_t>(numVerts));
+  snapshot.burgersVectors.reserve(3 * static_cast<size_t>(numVerts));
+  snapshot.slipPlaneNormals.reserve(3 * static_cast<size_t>(numVerts));
+
+  int32_t nodeCounter = 0;
+  uint64_t nodeKey = 0;
+  float coords[3] = {0.0f, 0.0f, 0.0f};
+  float burgVec[3] = {0.0f, 0.0f, 0.0f};
+  float spNorm[3] = {0.0f, 0.0f, 0.0f};
+  int32_t numArms = 0;
+  int32_t constraint = 0;
+
+  const char* lineBegin = nullptr;
+  const char* lineEnd = nullptr;
+
+  for(int32_t j = 0; j < numVerts; j++)
+  {
+    if(isCanceled())
+    {
+      return 0;
+    }
+
+    const char* p = nullptr;
+    if(scanner.readLine(lineBegin, lineEnd))
+    {
+      p = Detail::parseNodeTag(lineBegin, lineEnd, nodeKey);
+      p = Detail::parseFloats(p, lineEnd, coords, 3);
+    }
+    if(nullptr != p)
+    {
+      p = TextParsingHelpers::parseNumber(p, lineEnd, numArms);
+    }
+    if(nullptr != p)
+    {
+      p = TextParsingHelpers::parseNumber(p, lineEnd, constraint);
+    }
+    if(nullptr == p)
+    {
+      message = QObject::tr("Unable to parse the node at line %1 of %2").arg(scanner.lineNumber()).arg(filePath);
+      return -106;
+    }
+
+    int32_t nodeNum = Detail::nodeNumber(snapshot, nodeKey, nodeCounter);
+    if(nodeNum >= numVerts)
+    {
+      message = QObject::tr("The file references more nodes than the %1 declared by 'nodeCount'").arg(numVerts);
+      return -107;
+    }
+    snapshot.vertices[3 * nodeNum + 0] = coords[0] * burgersVector;
+    snapshot.vertices[3 * nodeNum + 1] = coords[1] * burgersVector;
+    snapshot.vertices[3 * nodeNum + 2] = coords[2] * burgersVector;
+    snapshot.numberOfArms[nodeNum] = numArms;
+    snapshot.nodeConstraints[nodeNum] = constraint;
+
+    if(snapshot.fileVersion >= 5)
+    {
+      scanner.skipLines(1);
+    }
+    for(int32_t k = 0; k < numArms; k++)
+    {
+      p = nullptr;
+      if(scanner.readLine(lineBegin, lineEnd))
+      {
+        p = Detail::parseNodeTag(lineBegin, lineEnd, nodeKey);
+        p = Detail::parseFloats(p, lineEnd, burgVec, 3);
+      }
+      if(nullptr == p)
+      {
+        message = QObject::tr("Unable to parse the arm at line %1 of %2").arg(scanner.lineNumber()).arg(filePath);
+        return -108;
+      }
+      int32_t neighborNode = Detail::nodeNumber(snapshot, nodeKey, nodeCounter);
+
+      if(!scanner.readLine(lineBegin, lineEnd))
+      {
+        message = QObject::tr("Unexpected end of file while reading the slip plane of an arm in %1").arg(filePath);
+        return -109;
+      }
+      if(neighborNode > nodeNum)
+      {
+        if(neighborNode >= numVerts)
+        {
+          message = QObject::tr("The file references more nodes than the %1 declared by 'nodeCount'").arg(numVerts);
+          return -107;
+        }
+        if(nullptr == Detail::parseFloats(lineBegin, lineEnd, spNorm, 3))
+        {
+          message = QObject::tr("Unable to parse the slip plane normal at line %1 of %2").arg(scanner.lineNumber()).arg(filePath);
+          return -110;
+        }
+        MatrixMath::Normalize3x1(spNorm);
+        snapshot.edges.push_back(static_cast<MeshIndexType>(nodeNum));
+        snapshot.edges.push_back(static_cast<MeshIndexType>(neighborNode));
+        snapshot.burgersVectors.insert(snapshot.burgersVectors.end(), burgVec, burgVec + 3);
+        snapshot.slipPlaneNormals.insert(snapshot.slipPlaneNormals.end(), spNorm, spNorm + 3);
+      }
+    }
+  }
+  return 0;
+}
+} // namespace ParaDisParsing
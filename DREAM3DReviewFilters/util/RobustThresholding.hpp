@@ -0,0 +1,420 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Robust automatic threshold selection (Kittler, Illingworth & Foglein, "Threshold
+ * Selection Based on a Simple Image Statistic"): the threshold is the mean of the values
+ * weighted by their gradient magnitude. The weighted sums are accumulated per tile of the
+ * volume in double precision, which also gives the local variant (Wilkinson, "Robust
+ * Automatic Threshold Selection"): one threshold per tile, interpolated between the tile
+ * centers. The gradient magnitude is either read from an array or computed on the fly
+ * with central differences, so no gradient volume needs to be stored.
+ */
+namespace RobustThresholding
+{
+/**
+ * @brief Layout of the values: dims[0] x dims[1] x dims[2] voxels, x fastest. Values that
+ * do not live on a grid are described as dims = {n, 1, 1}.
+ */
+struct Volume
+{
+  std::array<size_t, 3> dims = {0, 0, 0};
+  std::array<double, 3> spacing = {1.0, 1.0, 1.0};
+
+  size_t size() const
+  {
+    return dims[0] * dims[1] * dims[2];
+  }
+};
+
+/**
+ * @brief Sums of the gradient weighted values and of the gradient magnitudes
+ */
+struct WeightedSum
+{
+  double numerator = 0.0;
+  double denominator = 0.0;
+
+  void merge(const WeightedSum& other)
+  {
+    numerator += other.numerator;
+    denominator += other.denominator;
+  }
+};
+
+/**
+ * @brief Partition of a volume into tiles of tileSize voxels; the last tile along an axis
+ * may be smaller
+ */
+struct Tiling
+{
+  std::array<size_t, 3> tileSize = {1, 1, 1};
+  std::array<size_t, 3> numTiles = {1, 1, 1};
+
+  Tiling() = default;
+
+  Tiling(const Volume& volume, const std::array<size_t, 3>& size)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      tileSize[a] = std::max<size_t>(std::min(size[a], volume.dims[a]), 1);
+      numTiles[a] = std::max<size_t>((volume.dims[a] + tileSize[a] - 1) / tileSize[a], 1);
+    }
+  }
+
+  size_t size() const
+  {
+    return numTiles[0] * numTiles[1] * numTiles[2];
+  }
+};
+
+/**
+ * @brief Gradient magnitude read from an array
+ */
+class GradientArray
+{
+public:
+  explicit GradientArray(const float* gradient)
+  : m_Gradient(gradient)
+  {
+  }
+
+  double operator()(size_t index, size_t /* x */, size_t /* y */, size_t /* z */) const
+  {
+    return m_Gradient[index];
+  }
+
+private:
+  const float* m_Gradient = nullptr;
+};
+
+/**
+ * @brief Gradient magnitude computed with central differences, one sided on the faces of
+ * the volume; axes of length 1 contribute nothing
+ */
+template <typename T>
+class CentralDifference
+{
+public:
+  CentralDifference(const T* values, const Volume& volume)
+  : m_Values(values)
+  , m_Dims(volume.dims)
+  {
+    m_Strides = {1, volume.dims[0], volume.dims[0] * volume.dims[1]};
+    for(size_t a = 0; a < 3; a++)
+    {
+      m_InvSpacing[a] = 1.0 / volume.spacing[a];
+    }
+  }
+
+  double operator()(size_t index, size_t x, size_t y, size_t z) const
+  {
+    const std::array<size_t, 3> coords = {x, y, z};
+    double sum = 0.0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(m_Dims[a] < 2)
+      {
+        continue;
+      }
+      size_t lo = coords[a] > 0 ? index - m_Strides[a] : index;
+      size_t hi = coords[a] + 1 < m_Dims[a] ? index + m_Strides[a] : index;
+      double steps = (coords[a] > 0 && coords[a] + 1 < m_Dims[a]) ? 2.0 : 1.0;
+      double derivative = (static_cast<double>(m_Values[hi]) - static_cast<double>(m_Values[lo])) * m_InvSpacing[a] / steps;
+      sum += derivative * derivative;
+    }
+    return std::sqrt(sum);
+  }
+
+private:
+  const T* m_Values = nullptr;
+  std::array<size_t, 3> m_Dims;
+  std::array<size_t, 3> m_Strides;
+  std::array<double, 3> m_InvSpacing;
+};
+
+namespace Detail
+{
+/**
+ * @brief Accumulates the weighted sums of a range of tiles; every tile owns its sums, so
+ * the result does not depend on the thread schedule
+ */
+template <typename T, typename GradientFunc>
+class AccumulateTilesImpl
+{
+public:
+  AccumulateTilesImpl(const T* values, const GradientFunc& gradient, const Volume& volume, const Tiling& tiling, std::vector<WeightedSum>& sums)
+  : m_Values(values)
+  , m_Gradient(gradient)
+  , m_Volume(volume)
+  , m_Tiling(tiling)
+  , m_Sums(sums)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t t = range.min(); t < range.max(); t++)
+    {
+      std::array<size_t, 3> tile = {t % m_Tiling.numTiles[0], (t / m_Tiling.numTiles[0]) % m_Tiling.numTiles[1], t / (m_Tiling.numTiles[0] * m_Tiling.numTiles[1])};
+      std::array<size_t, 3> first = {0, 0, 0};
+      std::array<size_t, 3> last = {0, 0, 0};
+      for(size_t a = 0; a < 3; a++)
+      {
+        first[a] = tile[a] * m_Tiling.tileSize[a];
+        last[a] = std::min(first[a] + m_Tiling.tileSize[a], m_Volume.dims[a]);
+      }
+      WeightedSum sum;
+      for(size_t z = first[2]; z < last[2]; z++)
+      {
+        for(size_t y = first[1]; y < last[1]; y++)
+        {
+          size_t rowStart = (z * m_Volume.dims[1] + y) * m_Volume.dims[0];
+          for(size_t x = first[0]; x < last[0]; x++)
+          {
+            size_t index = rowStart + x;
+            double weight = m_Gradient(index, x, y, z);
+            sum.numerator += static_cast<double>(m_Values[index]) * weight;
+            sum.denominator += weight;
+          }
+        }
+      }
+      m_Sums[t] = sum;
+    }
+  }
+
+private:
+  const T* m_Values = nullptr;
+  const GradientFunc& m_Gradient;
+  const Volume& m_Volume;
+  const Tiling& m_Tiling;
+  std::vector<WeightedSum>& m_Sums;
+};
+
+/**
+ * @brief Linear interpolation weights between the tile centers along one axis: coordinate
+ * c lies between the centers of tiles lo[c] and lo[c] + 1, at fraction weight[c]; outside
+ * the first and last centers the nearest tile is used
+ */
+struct AxisInterpolation
+{
+  std::vector<size_t> lo;
+  std::vector<float> weight;
+
+  AxisInterpolation(size_t dim, size_t tileSize, size_t numTiles)
+  : lo(dim, 0)
+  , weight(dim, 0.0f)
+  {
+    const auto center = [&](size_t t) { return 0.5 * static_cast<double>(t * tileSize + std::min((t + 1) * tileSize, dim) - 1); };
+    size_t t = 0;
+    for(size_t c = 0; c < dim; c++)
+    {
+      while(t + 2 < numTiles && static_cast<double>(c) >= center(t + 1))
+      {
+        t++;
+      }
+      lo[c] = t;
+      if(numTiles > 1)
+      {
+        double w = (static_cast<double>(c) - center(t)) / (center(t + 1) - center(t));
+        weight[c] = static_cast<float>(std::min(std::max(w, 0.0), 1.0));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Writes the mask for a range of values compared against a single threshold
+ */
+template <typename T>
+class ApplyGlobalThresholdImpl
+{
+public:
+  ApplyGlobalThresholdImpl(const T* values, float threshold, bool* mask)
+  : m_Values(values)
+  , m_Threshold(threshold)
+  , m_Mask(mask)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Mask[i] = !(m_Values[i] < m_Threshold);
+    }
+  }
+
+private:
+  const T* m_Values = nullptr;
+  float m_Threshold = 0.0f;
+  bool* m_Mask = nullptr;
+};
+
+/**
+ * @brief Writes the mask for a range of planes, comparing every value against the tile
+ * thresholds interpolated to the voxel
+ */
+template <typename T>
+class ApplyLocalThresholdImpl
+{
+public:
+  ApplyLocalThresholdImpl(const T* values, const Volume& volume, const Tiling& tiling, const std::vector<float>& tileThresholds, bool* mask)
+  : m_Values(values)
+  , m_Volume(volume)
+  , m_Tiling(tiling)
+  , m_TileThresholds(tileThresholds)
+  , m_Mask(mask)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::array<AxisInterpolation, 3> axes = {AxisInterpolation(m_Volume.dims[0], m_Tiling.tileSize[0], m_Tiling.numTiles[0]),
+                                             AxisInterpolation(m_Volume.dims[1], m_Tiling.tileSize[1], m_Tiling.numTiles[1]),
+                                             AxisInterpolation(m_Volume.dims[2], m_Tiling.tileSize[2], m_Tiling.numTiles[2])};
+    const auto tileThreshold = [&](size_t tx, size_t ty, size_t tz) {
+      tx = std::min(tx, m_Tiling.numTiles[0] - 1);
+      ty = std::min(ty, m_Tiling.numTiles[1] - 1);
+      tz = std::min(tz, m_Tiling.numTiles[2] - 1);
+      return m_TileThresholds[(tz * m_Tiling.numTiles[1] + ty) * m_Tiling.numTiles[0] + tx];
+    };
+
+    // Thresholds interpolated in y and z for every tile column along x, refreshed per row
+    std::vector<float> column(m_Tiling.numTiles[0], 0.0f);
+    for(size_t z = range.min(); z < range.max(); z++)
+    {
+      size_t tz = axes[2].lo[z];
+      float wz = axes[2].weight[z];
+      for(size_t y = 0; y < m_Volume.dims[1]; y++)
+      {
+        size_t ty = axes[1].lo[y];
+        float wy = axes[1].weight[y];
+        for(size_t tx = 0; tx < m_Tiling.numTiles[0]; tx++)
+        {
+          float low = (1.0f - wy) * tileThreshold(tx, ty, tz) + wy * tileThreshold(tx, ty + 1, tz);
+          float high = (1.0f - wy) * tileThreshold(tx, ty, tz + 1) + wy * tileThreshold(tx, ty + 1, tz + 1);
+          column[tx] = (1.0f - wz) * low + wz * high;
+        }
+        size_t rowStart = (z * m_Volume.dims[1] + y) * m_Volume.dims[0];
+        for(size_t x = 0; x < m_Volume.dims[0]; x++)
+        {
+          size_t tx = axes[0].lo[x];
+          float wx = axes[0].weight[x];
+          float threshold = (1.0f - wx) * column[tx] + wx * column[std::min(tx + 1, m_Tiling.numTiles[0] - 1)];
+          m_Mask[rowStart + x] = !(m_Values[rowStart + x] < threshold);
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Values = nullptr;
+  const Volume& m_Volume;
+  const Tiling& m_Tiling;
+  const std::vector<float>& m_TileThresholds;
+  bool* m_Mask = nullptr;
+};
+} // namespace Detail
+
+/**
+ * @brief Tiles that only split the slowest varying axis longer than 1, into at most
+ * k_GlobalTiles tiles; used to accumulate a single global threshold in parallel. The
+ * tiling only depends on the volume, so the order in which the tile sums are added, and
+ * with it the threshold, is the same on every machine.
+ */
+inline Tiling globalTiling(const Volume& volume)
+{
+  constexpr size_t k_GlobalTiles = 64;
+  std::array<size_t, 3> size = volume.dims;
+  for(size_t a = 3; a > 0; a--)
+  {
+    if(volume.dims[a - 1] > 1)
+    {
+      size[a - 1] = std::max<size_t>((volume.dims[a - 1] + k_GlobalTiles - 1) / k_GlobalTiles, 1);
+      break;
+    }
+  }
+  return Tiling(volume, size);
+}
+
+/**
+ * @brief Accumulates the weighted sums of every tile in parallel
+ * @param gradient Callable double(size_t index, size_t x, size_t y, size_t z) returning
+ * the gradient magnitude at a voxel, for example GradientArray or CentralDifference
+ * @return One sum per tile, x fastest
+ */
+template <typename T, typename GradientFunc>
+std::vector<WeightedSum> accumulate(const T* values, const GradientFunc& gradient, const Volume& volume, const Tiling& tiling)
+{
+  std::vector<WeightedSum> sums(tiling.size());
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, tiling.size());
+  dataAlg.execute(Detail::AccumulateTilesImpl<T, GradientFunc>(values, gradient, volume, tiling, sums));
+  return sums;
+}
+
+/**
+ * @brief Global threshold from the tile sums, added in tile order
+ */
+inline float globalThreshold(const std::vector<WeightedSum>& sums)
+{
+  WeightedSum total;
+  for(const WeightedSum& sum : sums)
+  {
+    total.merge(sum);
+  }
+  return static_cast<float>(total.numerator / total.denominator);
+}
+
+/**
+ * @brief Threshold of every tile. A tile whose gradient weight is below minimumWeight
+ * times the mean tile weight has no reliable edge of its own and uses the global threshold.
+ */
+inline std::vector<float> tileThresholds(const std::vector<WeightedSum>& sums, double minimumWeight)
+{
+  float global = globalThreshold(sums);
+  double meanWeight = 0.0;
+  for(const WeightedSum& sum : sums)
+  {
+    meanWeight += sum.denominator;
+  }
+  meanWeight /= static_cast<double>(sums.size());
+
+  std::vector<float> thresholds(sums.size(), global);
+  for(size_t t = 0; t < sums.size(); t++)
+  {
+    if(sums[t].denominator > 0.0 && sums[t].denominator >= minimumWeight * meanWeight)
+    {
+      thresholds[t] = static_cast<float>(sums[t].numerator / sums[t].denominator);
+    }
+  }
+  return thresholds;
+}
+
+/**
+ * @brief Writes mask[i] = false where values[i] is less than its threshold, true otherwise
+ * @param tileThresholds A single global threshold, or one threshold per tile of tiling
+ * that is interpolated linearly between the tile centers
+ */
+template <typename T>
+void apply(const T* values, const Volume& volume, const Tiling& tiling, const std::vector<float>& tileThresholds, bool* mask)
+{
+  ParallelDataAlgorithm dataAlg;
+  if(tileThresholds.size() == 1)
+  {
+    dataAlg.setRange(0, volume.size());
+    dataAlg.execute(Detail::ApplyGlobalThresholdImpl<T>(values, tileThresholds[0], mask));
+    return;
+  }
+  dataAlg.setRange(0, volume.dims[2]);
+  dataAlg.execute(Detail::ApplyLocalThresholdImpl<T>(values, volume, tiling, tileThresholds, mask));
+}
+} // namespace RobustThresholding
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SlabBinning.hpp"
+
+/**
+ * @brief Rasterizes line segments onto a regular grid whose cells each integrate over a
+ * window twice the grid spacing wide, centered on the cell, so neighboring windows overlap
+ * by half (the layout used for dislocation density maps). Every window is the union of
+ * 2x2x2 sub-cells of a grid with the same spacing shifted by half a spacing, so a segment
+ * is walked through the sub-cells it actually crosses (Amanatides & Woo, "A Fast Voxel
+ * Traversal Algorithm for Ray Tracing") and each clipped piece is deposited into the
+ * windows that contain its sub-cell.
+ */
+namespace SegmentRasterization
+{
+/**
+ * @brief Walks the segment p1-p2 through the unit cells of a grid (given in grid coordinates)
+ * and calls visit(i, j, k, t0, t1) for every cell it crosses, where [t0, t1] is the parametric
+ * piece of the segment inside that cell. Only the cells in [lo, hi) are visited.
+ */
+template <typename VisitFunc>
+void traverse(const std::array<double, 3>& p1, const std::array<double, 3>& p2, const std::array<int64_t, 3>& lo, const std::array<int64_t, 3>& hi, const VisitFunc& visit)
+{
+  std::array<double, 3> delta = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+
+  // Clip the parametric range to the box of visited cells
+  double tEnter = 0.0;
+  double tExit = 1.0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(lo[a] >= hi[a])
+    {
+      return;
+    }
+    if(delta[a] == 0.0)
+    {
+      if(p1[a] < static_cast<double>(lo[a]) || p1[a] >= static_cast<double>(hi[a]))
+      {
+        return;
+      }
+      continue;
+    }
+    double t0 = (static_cast<double>(lo[a]) - p1[a]) / delta[a];
+    double t1 = (static_cast<double>(hi[a]) - p1[a]) / delta[a];
+    tEnter = std::max(tEnter, std::min(t0, t1));
+    tExit = std::min(tExit, std::max(t0, t1));
+  }
+  if(tEnter >= tExit)
+  {
+    return;
+  }
+
+  // Start in the cell containing the middle of the first step so points exactly on a
+  // boundary are not attributed to the cell behind them
+  std::array<int64_t, 3> cell = {0, 0, 0};
+  std::array<int64_t, 3> step = {0, 0, 0};
+  std::array<double, 3> tNextBoundary = {0.0, 0.0, 0.0};
+  std::array<double, 3> tStep = {0.0, 0.0, 0.0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    double start = p1[a] + tEnter * delta[a];
+    int64_t index = static_cast<int64_t>(std::floor(start));
+    if(delta[a] < 0.0 && static_cast<double>(index) == start)
+    {
+      index--;
+    }
+    cell[a] = std::min(std::max(index, lo[a]), hi[a] - 1);
+    if(delta[a] > 0.0)
+    {
+      step[a] = 1;
+      tStep[a] = 1.0 / delta[a];
+      tNextBoundary[a] = (static_cast<double>(cell[a] + 1) - p1[a]) / delta[a];
+    }
+    else if(delta[a] < 0.0)
+    {
+      step[a] = -1;
+      tStep[a] = -1.0 / delta[a];
+      tNextBoundary[a] = (static_cast<double>(cell[a]) - p1[a]) / delta[a];
+    }
+    else
+    {
+      tNextBoundary[a] = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  double t = tEnter;
+  while(t < tExit)
+  {
+    size_t axis = 0;
+    if(tNextBoundary[1] < tNextBoundary[axis])
+    {
+      axis = 1;
+    }
+    if(tNextBoundary[2] < tNextBoundary[axis])
+    {
+      axis = 2;
+    }
+    double tNext = std::min(tNextBoundary[axis], tExit);
+    if(tNext > t)
+    {
+      visit(cell[0], cell[1], cell[2], t, tNext);
+    }
+    t = tNext;
+    cell[axis] += step[axis];
+    tNextBoundary[axis] += tStep[axis];
+    if(cell[axis] < lo[axis] || cell[axis] >= hi[axis])
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Rasterizes one segment into the windows of the planes zBegin ... zEnd - 1 of a slab
+ */
+template <typename EndpointFunc, typename DepositFunc>
+class RasterizeSegmentImpl
+{
+public:
+  RasterizeSegmentImpl(const EndpointFunc& endpoints, const DepositFunc& deposit, const std::array<double, 3>& origin, const std::array<double, 3>& spacing, const std::array<int64_t, 3>& dims)
+  : m_Endpoints(endpoints)
+  , m_Deposit(deposit)
+  , m_Origin(origin)
+  , m_Spacing(spacing)
+  , m_Dims(dims)
+  {
+  }
+
+  void operator()(int64_t zBegin, int64_t zEnd, size_t segment) const
+  {
+    // Sub-cell s contributes to the windows s - 1 and s
+    std::array<int64_t, 3> lo = {0, 0, zBegin};
+    std::array<int64_t, 3> hi = {m_Dims[0] + 1, m_Dims[1] + 1, zEnd + 1};
+    std::array<double, 3> p1 = {0.0, 0.0, 0.0};
+    std::array<double, 3> p2 = {0.0, 0.0, 0.0};
+    m_Endpoints(segment, p1, p2);
+    double length = std::sqrt((p2[0] - p1[0]) * (p2[0] - p1[0]) + (p2[1] - p1[1]) * (p2[1] - p1[1]) + (p2[2] - p1[2]) * (p2[2] - p1[2]));
+    toSubGrid(p1);
+    toSubGrid(p2);
+    traverse(p1, p2, lo, hi, [&](int64_t x, int64_t y, int64_t z, double t0, double t1) {
+      double piece = (t1 - t0) * length;
+      for(int64_t wz = std::max(z - 1, zBegin); wz <= std::min(z, zEnd - 1); wz++)
+      {
+        for(int64_t wy = std::max<int64_t>(y - 1, 0); wy <= std::min(y, m_Dims[1] - 1); wy++)
+        {
+          for(int64_t wx = std::max<int64_t>(x - 1, 0); wx <= std::min(x, m_Dims[0] - 1); wx++)
+          {
+            m_Deposit(segment, static_cast<size_t>((wz * m_Dims[1] + wy) * m_Dims[0] + wx), piece);
+          }
+        }
+      }
+    });
+  }
+
+private:
+  const EndpointFunc& m_Endpoints;
+  const DepositFunc& m_Deposit;
+  std::array<double, 3> m_Origin;
+  std::array<double, 3> m_Spacing;
+  std::array<int64_t, 3> m_Dims;
+
+  /**
+   * @brief Converts a physical position to the coordinates of the sub-cell grid, which
+   * starts half a spacing before the first window
+   */
+  void toSubGrid(std::array<double, 3>& p) const
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      p[a] = (p[a] - m_Origin[a]) / m_Spacing[a] + 0.5;
+    }
+  }
+};
+
+/**
+ * @brief Accumulates the length of every segment inside every window of the grid. The
+ * window of cell (i, j, k) spans [origin + (i - 0.5) * spacing, origin + (i + 1.5) * spacing]
+ * along x, and likewise along y and z.
+ * @param numSegments Number of segments
+ * @param endpoints Callable void(size_t segment, std::array<double, 3>& p1, std::array<double, 3>& p2)
+ * that returns the physical end points of a segment
+ * @param origin Grid origin
+ * @param spacing Grid spacing (half the window size)
+ * @param dims Number of cells along x, y and z
+ * @param deposit Callable void(size_t segment, size_t cell, double length). It is called
+ * concurrently for different cells, but never concurrently for the same cell, and the
+ * deposits into one cell arrive in ascending segment order.
+ */
+template <typename EndpointFunc, typename DepositFunc>
+void rasterizeOverlappingWindows(size_t numSegments, const EndpointFunc& endpoints, const std::array<double, 3>& origin, const std::array<double, 3>& spacing, const std::array<int64_t, 3>& dims,
+                                 const DepositFunc& deposit)
+{
+  if(numSegments == 0 || dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0)
+  {
+    return;
+  }
+
+  // Range of window planes a segment can touch, or false if it misses the grid along z
+  const auto windowPlanes = [&](size_t segment, int64_t& zFirst, int64_t& zLast) {
+    std::array<double, 3> p1 = {0.0, 0.0, 0.0};
+    std::array<double, 3> p2 = {0.0, 0.0, 0.0};
+    endpoints(segment, p1, p2);
+    double s1 = (p1[2] - origin[2]) / spacing[2] + 0.5;
+    double s2 = (p2[2] - origin[2]) / spacing[2] + 0.5;
+    double sMin = std::floor(std::min(s1, s2));
+    double sMax = std::floor(std::max(s1, s2));
+    if(sMax < 0.0 || sMin > static_cast<double>(dims[2]))
+    {
+      return false;
+    }
+    zFirst = std::max<int64_t>(static_cast<int64_t>(sMin) - 1, 0);
+    zLast = std::min<int64_t>(static_cast<int64_t>(sMax), dims[2] - 1);
+    return zFirst <= zLast;
+  };
+
+  SlabBinning::Bins bins = SlabBinning::bin(numSegments, dims[2], windowPlanes);
+  SlabBinning::execute(bins, RasterizeSegmentImpl<EndpointFunc, DepositFunc>(endpoints, deposit, origin, spacing, dims));
+}
+} // namespace SegmentRasterization
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SlabBinning.hpp"
+
+/**
+ * @brief Rasterizes solid shapes onto a regular grid by visiting only the voxels inside
+ * each shape's bounding box. The shapes are binned into the Z slabs their bounding boxes
+ * overlap, and the slabs are filled in parallel (see SlabBinning).
+ */
+namespace ShapeRasterization
+{
+/**
+ * @brief Regular grid whose voxel (i, j, k) is sampled at origin + (i, j, k) * spacing
+ */
+struct Grid
+{
+  std::array<int64_t, 3> dims = {0, 0, 0};
+  std::array<float, 3> origin = {0.0f, 0.0f, 0.0f};
+  std::array<float, 3> spacing = {1.0f, 1.0f, 1.0f};
+};
+
+namespace Detail
+{
+/**
+ * @brief Converts a physical bounding box to the range of voxels whose sample points
+ * may lie inside it. The range is widened by one voxel on each side so that rounding
+ * never drops a voxel; the shape test decides the rest.
+ * @return false if the box misses the grid or is not a valid box
+ */
+inline bool voxelRange(const Grid& grid, const std::array<float, 3>& lo, const std::array<float, 3>& hi, std::array<int64_t, 3>& first, std::array<int64_t, 3>& last)
+{
+  for(size_t a = 0; a < 3; a++)
+  {
+    // Written so that NaN bounds fail the test
+    if(!(lo[a] <= hi[a]))
+    {
+      return false;
+    }
+    double begin = std::floor((static_cast<double>(lo[a]) - grid.origin[a]) / grid.spacing[a]) - 1.0;
+    double end = std::ceil((static_cast<double>(hi[a]) - grid.origin[a]) / grid.spacing[a]) + 1.0;
+    begin = std::max(begin, 0.0);
+    end = std::min(end, static_cast<double>(grid.dims[a] - 1));
+    if(begin > end)
+    {
+      return false;
+    }
+    first[a] = static_cast<int64_t>(begin);
+    last[a] = static_cast<int64_t>(end);
+  }
+  return true;
+}
+
+/**
+ * @brief Rasterizes one shape into the planes zBegin ... zEnd - 1 of a slab
+ */
+template <typename ShapeFunc, typename WriteFunc>
+class RasterizeShapeImpl
+{
+public:
+  RasterizeShapeImpl(const ShapeFunc& shapes, const WriteFunc& write, const Grid& grid)
+  : m_Shapes(shapes)
+  , m_Write(write)
+  , m_Grid(grid)
+  {
+  }
+
+  void operator()(int64_t zBegin, int64_t zEnd, size_t shape) const
+  {
+    std::array<float, 3> lo = {0.0f, 0.0f, 0.0f};
+    std::array<float, 3> hi = {0.0f, 0.0f, 0.0f};
+    std::array<int64_t, 3> first = {0, 0, 0};
+    std::array<int64_t, 3> last = {0, 0, 0};
+    m_Shapes.bounds(shape, lo, hi);
+    voxelRange(m_Grid, lo, hi, first, last);
+    for(int64_t z = std::max(first[2], zBegin); z <= std::min(last[2], zEnd - 1); z++)
+    {
+      float pz = m_Grid.origin[2] + m_Grid.spacing[2] * z;
+      for(int64_t y = first[1]; y <= last[1]; y++)
+      {
+        float py = m_Grid.origin[1] + m_Grid.spacing[1] * y;
+        size_t rowStart = static_cast<size_t>((z * m_Grid.dims[1] + y) * m_Grid.dims[0]);
+        for(int64_t x = first[0]; x <= last[0]; x++)
+        {
+          float px = m_Grid.origin[0] + m_Grid.spacing[0] * x;
+          if(m_Shapes.contains(shape, px, py, pz))
+          {
+            m_Write(shape, rowStart + static_cast<size_t>(x));
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const ShapeFunc& m_Shapes;
+  const WriteFunc& m_Write;
+  Grid m_Grid;
+};
+} // namespace Detail
+
+/**
+ * @brief Calls write for every voxel of the grid that lies inside a shape
+ * @param numShapes Number of shapes
+ * @param shapes Object with the members
+ * void bounds(size_t shape, std::array<float, 3>& lo, std::array<float, 3>& hi) const, which
+ * returns the physical bounding box of a shape, and
+ * bool contains(size_t shape, float x, float y, float z) const, which tests a sample point
+ * @param grid Grid to rasterize onto
+ * @param write Callable void(size_t shape, size_t voxel). It is called concurrently for
+ * different voxels, but never concurrently for the same voxel, and the writes into one
+ * voxel arrive in ascending shape order.
+ */
+template <typename ShapeFunc, typename WriteFunc>
+void rasterize(size_t numShapes, const ShapeFunc& shapes, const Grid& grid, const WriteFunc& write)
+{
+  if(numShapes == 0 || grid.dims[0] <= 0 || grid.dims[1] <= 0 || grid.dims[2] <= 0)
+  {
+    return;
+  }
+
+  // Range of planes a shape can touch, or false if it misses the grid
+  const auto shapePlanes = [&](size_t shape, int64_t& zFirst, int64_t& zLast) {
+    std::array<float, 3> lo = {0.0f, 0.0f, 0.0f};
+    std::array<float, 3> hi = {0.0f, 0.0f, 0.0f};
+    std::array<int64_t, 3> first = {0, 0, 0};
+    std::array<int64_t, 3> last = {0, 0, 0};
+    shapes.bounds(shape, lo, hi);
+    if(!Detail::voxelRange(grid, lo, hi, first, last))
+    {
+      return false;
+    }
+    zFirst = first[2];
+    zLast = last[2];
+    return true;
+  };
+
+  SlabBinning::Bins bins = SlabBinning::bin(numShapes, grid.dims[2], shapePlanes);
+  SlabBinning::execute(bins, Detail::RasterizeShapeImpl<ShapeFunc, WriteFunc>(shapes, write, grid));
+}
+} // namespace ShapeRasterization
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Parallel scatter of items (shapes, segments, ...) onto the Z planes of a grid. The
+ * planes are split into slabs, every item is binned into the slabs its range of planes
+ * overlaps, and the slabs are then processed in parallel. A slab only writes the cells of
+ * its own planes and visits its items in ascending order, so every cell receives its
+ * writes in the same order as a serial pass over the items.
+ */
+namespace SlabBinning
+{
+/**
+ * @brief Items binned into slabs: slab s covers the planes slabBounds[s] ... slabBounds[s + 1] - 1
+ * and holds the items items[offsets[s]] ... items[offsets[s + 1] - 1], in ascending order
+ */
+struct Bins
+{
+  std::vector<int64_t> slabBounds;
+  std::vector<size_t> offsets;
+  std::vector<size_t> items;
+
+  size_t numSlabs() const
+  {
+    return slabBounds.empty() ? 0 : slabBounds.size() - 1;
+  }
+};
+
+namespace Detail
+{
+/**
+ * @brief Visits the items of a range of slabs
+ */
+template <typename VisitFunc>
+class VisitSlabsImpl
+{
+public:
+  VisitSlabsImpl(const Bins& bins, const VisitFunc& visit)
+  : m_Bins(bins)
+  , m_Visit(visit)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t slab = range.min(); slab < range.max(); slab++)
+    {
+      for(size_t k = m_Bins.offsets[slab]; k < m_Bins.offsets[slab + 1]; k++)
+      {
+        m_Visit(m_Bins.slabBounds[slab], m_Bins.slabBounds[slab + 1], m_Bins.items[k]);
+      }
+    }
+  }
+
+private:
+  const Bins& m_Bins;
+  const VisitFunc& m_Visit;
+};
+} // namespace Detail
+
+/**
+ * @brief Bins items into slabs of the planes 0 ... numPlanes - 1
+ * @param planes Callable bool(size_t item, int64_t& zFirst, int64_t& zLast) that returns the
+ * planes an item can touch, clamped to the grid, or false if it misses the grid
+ */
+template <typename PlanesFunc>
+Bins bin(size_t numItems, int64_t numPlanes, const PlanesFunc& planes)
+{
+  Bins bins;
+  if(numPlanes <= 0)
+  {
+    return bins;
+  }
+
+  size_t numSlabs = std::min<size_t>(static_cast<size_t>(numPlanes), 4 * std::max(1U, std::thread::hardware_concurrency()));
+  bins.slabBounds.resize(numSlabs + 1);
+  for(size_t slab = 0; slab <= numSlabs; slab++)
+  {
+    bins.slabBounds[slab] = static_cast<int64_t>((static_cast<size_t>(numPlanes) * slab) / numSlabs);
+  }
+  const auto slabOf = [&](int64_t z) { return static_cast<size_t>(std::upper_bound(bins.slabBounds.begin() + 1, bins.slabBounds.end(), z) - (bins.slabBounds.begin() + 1)); };
+
+  // Count the items of every slab, then place them in a second pass
+  bins.offsets.assign(numSlabs + 1, 0);
+  for(size_t i = 0; i < numItems; i++)
+  {
+    int64_t zFirst = 0;
+    int64_t zLast = -1;
+    if(!planes(i, zFirst, zLast))
+    {
+      continue;
+    }
+    for(size_t slab = slabOf(zFirst); slab <= slabOf(zLast); slab++)
+    {
+      bins.offsets[slab + 1]++;
+    }
+  }
+  for(size_t slab = 0; slab < numSlabs; slab++)
+  {
+    bins.offsets[slab + 1] += bins.offsets[slab];
+  }
+  bins.items.resize(bins.offsets[numSlabs]);
+  std::vector<size_t> fill(bins.offsets.begin(), bins.offsets.end() - 1);
+  for(size_t i = 0; i < numItems; i++)
+  {
+    int64_t zFirst = 0;
+    int64_t zLast = -1;
+    if(!planes(i, zFirst, zLast))
+    {
+      continue;
+    }
+    for(size_t slab = slabOf(zFirst); slab <= slabOf(zLast); slab++)
+    {
+      bins.items[fill[slab]++] = i;
+    }
+  }
+  return bins;
+}
+
+/**
+ * @brief Processes the slabs in parallel
+ * @param visit Callable void(int64_t zBegin, int64_t zEnd, size_t item), called for every
+ * item of the slab of planes zBegin ... zEnd - 1, which is the only part of the grid the
+ * call may write. Different slabs are visited concurrently; the items of one slab are
+ * visited in ascending order.
+ */
+template <typename VisitFunc>
+void execute(const Bins& bins, const VisitFunc& visit)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, bins.numSlabs());
+  dataAlg.execute(Detail::VisitSlabsImpl<VisitFunc>(bins, visit));
+}
+} // namespace SlabBinning
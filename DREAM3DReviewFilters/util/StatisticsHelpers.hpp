@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -142,6 +143,217 @@ double findSummation(const C<T, Ts...>& source)
   float sum = static_cast<float>(computeSum(source));
   return sum;
 }
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Percentile of count values, with linear interpolation between the order
+ * statistics at ranks fraction * count - 0.5 (so the 50th percentile is the median).
+ * The values are reordered.
+ * @param fraction Percentile as a fraction in [0, 1]
+ */
+template <typename T>
+double findPercentileInPlace(T* values, size_t count, double fraction)
+{
+  if(count == 0)
+  {
+    return 0.0;
+  }
+  double rank = std::min(std::max(fraction * static_cast<double>(count) - 0.5, 0.0), static_cast<double>(count - 1));
+  size_t lowIndex = static_cast<size_t>(std::floor(rank));
+  std::nth_element(values, values + lowIndex, values + count);
+  double low = static_cast<double>(values[lowIndex]);
+  double weight = rank - static_cast<double>(lowIndex);
+  if(weight == 0.0)
+  {
+    return low;
+  }
+  // After nth_element the next order statistic is the smallest value above lowIndex
+  double high = static_cast<double>(*std::min_element(values + lowIndex + 1, values + count));
+  return low + weight * (high - low);
+}
+
+// -----------------------------------------------------------------------------
+template <template <typename, typename...> class C, typename T, typename... Ts>
+float findPercentile(const C<T, Ts...>& source, double fraction)
+{
+  // Need a copy, not a reference, since the values are reordered (bytes for bool, which
+  // has no contiguous std::vector storage)
+  using CopyType = std::conditional_t<std::is_same<T, bool>::value, uint8_t, T>;
+  std::vector<CopyType> tmpList{std::cbegin(source), std::cend(source)};
+  return static_cast<float>(findPercentileInPlace(tmpList.data(), tmpList.size(), fraction));
+}
+
+/**
+ * @brief Mergeable approximate quantile sketch: a merging t-digest (Dunning & Ertl,
+ * "Computing Extremely Accurate Quantiles Using t-Digests"). The values are summarized by
+ * weighted centroids that are kept small near the tails, so extreme percentiles stay
+ * accurate. The compression sets the accuracy: the rank error of a quantile is typically
+ * well below 1 / compression, and a sketch never holds more than 3 * compression centroids
+ * whatever the number of values. Sketches of disjoint parts of a data set can be merged,
+ * so they can be built in parallel. Quantiles are interpolated like findPercentileInPlace,
+ * and are exact as long as no centroids have been merged (fewer than about compression / 2
+ * values).
+ */
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(double compression = 100.0)
+  : m_Compression(std::max(compression, 10.0))
+  , m_Capacity(3 * static_cast<size_t>(std::ceil(m_Compression)))
+  {
+  }
+
+  /**
+   * @brief Adds a value
+   */
+  void add(double value, double weight = 1.0)
+  {
+    if(m_TotalWeight == 0.0)
+    {
+      m_Min = value;
+      m_Max = value;
+    }
+    m_Min = std::min(m_Min, value);
+    m_Max = std::max(m_Max, value);
+    m_TotalWeight += weight;
+    m_Centroids.push_back({value, weight});
+    if(m_Centroids.size() >= m_Capacity)
+    {
+      compress();
+    }
+  }
+
+  /**
+   * @brief Adds all the values summarized by another sketch
+   */
+  void merge(const QuantileSketch& other)
+  {
+    if(other.m_TotalWeight == 0.0)
+    {
+      return;
+    }
+    double otherMin = other.m_Min;
+    double otherMax = other.m_Max;
+    for(const Centroid& centroid : other.m_Centroids)
+    {
+      add(centroid.mean, centroid.weight);
+    }
+    m_Min = std::min(m_Min, otherMin);
+    m_Max = std::max(m_Max, otherMax);
+  }
+
+  /**
+   * @brief Number (total weight) of the values added
+   */
+  double count() const
+  {
+    return m_TotalWeight;
+  }
+
+  /**
+   * @brief Approximate quantile; 0 if no value has been added. Pending values are merged
+   * into the centroids first.
+   * @param fraction Quantile as a fraction in [0, 1]
+   */
+  double quantile(double fraction)
+  {
+    if(m_TotalWeight == 0.0)
+    {
+      return 0.0;
+    }
+    compress();
+    double index = std::min(std::max(fraction, 0.0), 1.0) * m_TotalWeight;
+
+    // Piecewise linear through (0, min), the centroid centers and (total, max)
+    double leftPosition = 0.0;
+    double leftValue = m_Min;
+    double weightSoFar = 0.0;
+    for(const Centroid& centroid : m_Centroids)
+    {
+      double center = weightSoFar + 0.5 * centroid.weight;
+      if(index < center)
+      {
+        return interpolate(leftPosition, leftValue, center, centroid.mean, index);
+      }
+      leftPosition = center;
+      leftValue = centroid.mean;
+      weightSoFar += centroid.weight;
+    }
+    return interpolate(leftPosition, leftValue, m_TotalWeight, m_Max, index);
+  }
+
+private:
+  struct Centroid
+  {
+    double mean;
+    double weight;
+  };
+
+  double m_Compression = 100.0;
+  size_t m_Capacity = 300;
+  std::vector<Centroid> m_Centroids;
+  size_t m_NumMerged = 0;
+  double m_TotalWeight = 0.0;
+  double m_Min = 0.0;
+  double m_Max = 0.0;
+
+  static double interpolate(double x0, double y0, double x1, double y1, double x)
+  {
+    if(x <= x0)
+    {
+      return y0;
+    }
+    if(x >= x1)
+    {
+      return y1;
+    }
+    return y0 + (y1 - y0) * (x - x0) / (x1 - x0);
+  }
+
+  /**
+   * @brief Scale function k1 of the t-digest paper; neighboring centroids may be merged
+   * while they span at most one unit of k
+   */
+  double scale(double q) const
+  {
+    constexpr double k_Pi = 3.14159265358979323846;
+    return m_Compression / (2.0 * k_Pi) * std::asin(std::min(std::max(2.0 * q - 1.0, -1.0), 1.0));
+  }
+
+  /**
+   * @brief Merges the pending values into the sorted centroids
+   */
+  void compress()
+  {
+    if(m_NumMerged == m_Centroids.size())
+    {
+      return;
+    }
+    std::sort(m_Centroids.begin(), m_Centroids.end(), [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+    size_t last = 0;
+    double weightBefore = 0.0;
+    double kLeft = scale(0.0);
+    for(size_t i = 1; i < m_Centroids.size(); i++)
+    {
+      Centroid& current = m_Centroids[last];
+      const Centroid& next = m_Centroids[i];
+      double proposed = current.weight + next.weight;
+      if(scale((weightBefore + proposed) / m_TotalWeight) - kLeft <= 1.0)
+      {
+        current.mean += (next.mean - current.mean) * next.weight / proposed;
+        current.weight = proposed;
+      }
+      else
+      {
+        weightBefore += current.weight;
+        kLeft = scale(weightBefore / m_TotalWeight);
+        m_Centroids[++last] = next;
+      }
+    }
+    m_Centroids.resize(last + 1);
+    m_NumMerged = m_Centroids.size();
+  }
+};
 } // namespace StatisticsHelpers
 
 #ifdef STATISTICS_FILTER_CLASS_NAME
@@ -158,9 +370,9 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID35 = 35, // StdDev
   DataArrayID36 = 36, // Summation
   DataArrayID37 = 37, // Histogram
-  DataArrayID38 = 38, //
+  DataArrayID38 = 38, // Percentiles
   DataArrayID39 = 39, // StandardizedArray
-  DataArrayID40 = 40, //
+  DataArrayID40 = 40, // InterquartileRange
 };
 } // namespace
 
@@ -244,4 +456,67 @@ void STATISTICS_FILTER_CLASS_NAME::createCompatibleArrays(QVector<DataArrayPath>
     }
   }
 }
+
+/**
+ * @brief createQuantileArrays Parses the comma delimited percentiles into m_PercentileFractions and
+ * creates the percentile and interquartile range arrays
+ * @param errorCode Error raised for an invalid percentile; errorCode - 1 is raised if no percentile
+ * is entered and errorCode - 2 if the quantile sketch compression is below 10
+ */
+void STATISTICS_FILTER_CLASS_NAME::createQuantileArrays(int32_t errorCode)
+{
+  std::vector<size_t> cDims = {1};
+
+  if(m_FindPercentiles)
+  {
+    m_PercentileFractions.clear();
+    QStringList tokens = m_Percentiles.split(',');
+    for(const QString& token : tokens)
+    {
+      if(token.trimmed().isEmpty())
+      {
+        continue;
+      }
+      bool ok = false;
+      double percentile = token.trimmed().toDouble(&ok);
+      if(!ok || percentile < 0.0 || percentile > 100.0)
+      {
+        QString ss = QObject::tr("The percentiles must be a comma delimited list of numbers between 0 and 100, but '%1' was found").arg(token.trimmed());
+        setErrorCondition(errorCode, ss);
+        return;
+      }
+      m_PercentileFractions.push_back(percentile / 100.0);
+    }
+    if(m_PercentileFractions.empty())
+    {
+      QString ss = QObject::tr("At least one percentile must be entered to find percentiles");
+      setErrorCondition(errorCode - 1, ss);
+      return;
+    }
+    std::vector<size_t> cDims_List = {m_PercentileFractions.size()};
+    DataArrayPath path(getDestinationAttributeMatrix().getDataContainerName(), getDestinationAttributeMatrix().getAttributeMatrixName(), getPercentilesArrayName());
+    m_PercentilesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims_List, "", DataArrayID38);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
+
+  if(m_FindInterquartileRange)
+  {
+    DataArrayPath path(getDestinationAttributeMatrix().getDataContainerName(), getDestinationAttributeMatrix().getAttributeMatrixName(), getInterquartileRangeArrayName());
+    m_InterquartileRangePtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims, "", DataArrayID40);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
+
+  if(m_UseApproximateQuantiles && m_SketchCompression < 10.0)
+  {
+    QString ss = QObject::tr("The quantile sketch compression must be at least 10");
+    setErrorCondition(errorCode - 2, ss);
+    return;
+  }
+}
 #endif
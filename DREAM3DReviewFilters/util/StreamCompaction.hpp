@@ -0,0 +1,364 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Parallel stream compaction: the elements to keep are flagged, the kept counts of
+ * contiguous blocks of elements are prefix summed, and every block scatters its runs of
+ * consecutive kept elements. The result is a list of runs that maps the kept elements, in
+ * their original order, onto 0 ... numKept - 1; the same runs compact any number of arrays
+ * with one memcpy per run.
+ */
+namespace StreamCompaction
+{
+/**
+ * @brief Index of a removed element in an old to new index map
+ */
+constexpr size_t k_Removed = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Consecutive kept elements source ... source + length - 1, which move to
+ * sink ... sink + length - 1
+ */
+struct Run
+{
+  size_t source = 0;
+  size_t sink = 0;
+  size_t length = 0;
+};
+
+/**
+ * @brief Runs of a compaction. Runs never cross a block boundary, so no run is longer
+ * than a block, and copying runs in parallel stays balanced when little is removed.
+ */
+struct IndexMap
+{
+  size_t numElements = 0;
+  size_t numKept = 0;
+  std::vector<Run> runs;
+};
+
+namespace Detail
+{
+/**
+ * @brief Flags the elements of a range of blocks and counts the kept elements and the
+ * runs of every block
+ */
+template <typename KeepFunc>
+class FlagBlocksImpl
+{
+public:
+  FlagBlocksImpl(const KeepFunc& keep, const std::vector<size_t>& blockBounds, std::vector<uint8_t>& flags, std::vector<size_t>& keptCounts, std::vector<size_t>& runCounts)
+  : m_Keep(keep)
+  , m_BlockBounds(blockBounds)
+  , m_Flags(flags)
+  , m_KeptCounts(keptCounts)
+  , m_RunCounts(runCounts)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t kept = 0;
+      size_t runs = 0;
+      bool previous = false;
+      for(size_t i = m_BlockBounds[block]; i < m_BlockBounds[block + 1]; i++)
+      {
+        bool flag = m_Keep(i);
+        m_Flags[i] = flag ? 1 : 0;
+        if(flag)
+        {
+          kept++;
+          runs += previous ? 0 : 1;
+        }
+        previous = flag;
+      }
+      m_KeptCounts[block] = kept;
+      m_RunCounts[block] = runs;
+    }
+  }
+
+private:
+  const KeepFunc& m_Keep;
+  const std::vector<size_t>& m_BlockBounds;
+  std::vector<uint8_t>& m_Flags;
+  std::vector<size_t>& m_KeptCounts;
+  std::vector<size_t>& m_RunCounts;
+};
+
+/**
+ * @brief Writes the runs of a range of blocks, starting at the offsets given by the
+ * exclusive prefix sums of the kept and run counts
+ */
+class ScatterRunsImpl
+{
+public:
+  ScatterRunsImpl(const std::vector<size_t>& blockBounds, const std::vector<uint8_t>& flags, const std::vector<size_t>& keptOffsets, const std::vector<size_t>& runOffsets, std::vector<Run>& runs)
+  : m_BlockBounds(blockBounds)
+  , m_Flags(flags)
+  , m_KeptOffsets(keptOffsets)
+  , m_RunOffsets(runOffsets)
+  , m_Runs(runs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t sink = m_KeptOffsets[block];
+      size_t run = m_RunOffsets[block];
+      size_t i = m_BlockBounds[block];
+      size_t end = m_BlockBounds[block + 1];
+      while(i < end)
+      {
+        if(m_Flags[i] == 0)
+        {
+          i++;
+          continue;
+        }
+        size_t first = i;
+        while(i < end && m_Flags[i] != 0)
+        {
+          i++;
+        }
+        m_Runs[run].source = first;
+        m_Runs[run].sink = sink;
+        m_Runs[run].length = i - first;
+        sink += i - first;
+        run++;
+      }
+    }
+  }
+
+private:
+  const std::vector<size_t>& m_BlockBounds;
+  const std::vector<uint8_t>& m_Flags;
+  const std::vector<size_t>& m_KeptOffsets;
+  const std::vector<size_t>& m_RunOffsets;
+  std::vector<Run>& m_Runs;
+};
+
+/**
+ * @brief Copies the tuples of a range of runs
+ */
+template <typename T>
+class CopyRunsImpl
+{
+public:
+  CopyRunsImpl(const IndexMap& map, const T* source, T* sink, size_t numComps)
+  : m_Map(map)
+  , m_Source(source)
+  , m_Sink(sink)
+  , m_NumComps(numComps)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t r = range.min(); r < range.max(); r++)
+    {
+      const Run& run = m_Map.runs[r];
+      std::memcpy(m_Sink + run.sink * m_NumComps, m_Source + run.source * m_NumComps, run.length * m_NumComps * sizeof(T));
+    }
+  }
+
+private:
+  const IndexMap& m_Map;
+  const T* m_Source = nullptr;
+  T* m_Sink = nullptr;
+  size_t m_NumComps = 1;
+};
+
+/**
+ * @brief Copies a range of tuples from the source tuples given by a list of indices
+ */
+template <typename T>
+class GatherTuplesImpl
+{
+public:
+  GatherTuplesImpl(const std::vector<size_t>& sources, const T* source, T* sink, size_t numComps)
+  : m_Sources(sources)
+  , m_Source(source)
+  , m_Sink(sink)
+  , m_NumComps(numComps)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      std::memcpy(m_Sink + i * m_NumComps, m_Source + m_Sources[i] * m_NumComps, m_NumComps * sizeof(T));
+    }
+  }
+
+private:
+  const std::vector<size_t>& m_Sources;
+  const T* m_Source = nullptr;
+  T* m_Sink = nullptr;
+  size_t m_NumComps = 1;
+};
+
+/**
+ * @brief Writes the new index of every kept element of a range of runs
+ */
+class NewIndicesImpl
+{
+public:
+  NewIndicesImpl(const IndexMap& map, size_t* newIndices)
+  : m_Map(map)
+  , m_NewIndices(newIndices)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t r = range.min(); r < range.max(); r++)
+    {
+      const Run& run = m_Map.runs[r];
+      for(size_t i = 0; i < run.length; i++)
+      {
+        m_NewIndices[run.source + i] = run.sink + i;
+      }
+    }
+  }
+
+private:
+  const IndexMap& m_Map;
+  size_t* m_NewIndices = nullptr;
+};
+
+/**
+ * @brief Replaces a range of indices by their new indices
+ */
+template <typename IndexType>
+class RemapIndicesImpl
+{
+public:
+  RemapIndicesImpl(const std::vector<size_t>& newIndices, IndexType* indices)
+  : m_NewIndices(newIndices)
+  , m_Indices(indices)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Indices[i] = static_cast<IndexType>(m_NewIndices[m_Indices[i]]);
+    }
+  }
+
+private:
+  const std::vector<size_t>& m_NewIndices;
+  IndexType* m_Indices = nullptr;
+};
+} // namespace Detail
+
+/**
+ * @brief Compacts the elements 0 ... numElements - 1
+ * @param keep Callable bool(size_t element); called exactly once per element, concurrently
+ * for different elements
+ */
+template <typename KeepFunc>
+IndexMap compact(size_t numElements, const KeepFunc& keep)
+{
+  IndexMap map;
+  map.numElements = numElements;
+  if(numElements == 0)
+  {
+    return map;
+  }
+
+  size_t numBlocks = std::min<size_t>(numElements, 16 * std::max(1U, std::thread::hardware_concurrency()));
+  std::vector<size_t> blockBounds(numBlocks + 1);
+  for(size_t block = 0; block <= numBlocks; block++)
+  {
+    blockBounds[block] = (numElements * block) / numBlocks;
+  }
+
+  std::vector<uint8_t> flags(numElements);
+  std::vector<size_t> keptOffsets(numBlocks + 1, 0);
+  std::vector<size_t> runOffsets(numBlocks + 1, 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(Detail::FlagBlocksImpl<KeepFunc>(keep, blockBounds, flags, keptOffsets, runOffsets));
+
+  // Exclusive prefix sums; the counts are shifted into place as they are summed
+  size_t kept = 0;
+  size_t runs = 0;
+  for(size_t block = 0; block <= numBlocks; block++)
+  {
+    size_t blockKept = block < numBlocks ? keptOffsets[block] : 0;
+    size_t blockRuns = block < numBlocks ? runOffsets[block] : 0;
+    keptOffsets[block] = kept;
+    runOffsets[block] = runs;
+    kept += blockKept;
+    runs += blockRuns;
+  }
+
+  map.numKept = keptOffsets[numBlocks];
+  map.runs.resize(runOffsets[numBlocks]);
+  dataAlg.execute(Detail::ScatterRunsImpl(blockBounds, flags, keptOffsets, runOffsets, map.runs));
+  return map;
+}
+
+/**
+ * @brief Copies the kept tuples of source into the first map.numKept tuples of sink
+ */
+template <typename T>
+void copyTuples(const IndexMap& map, const T* source, T* sink, size_t numComps)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, map.runs.size());
+  dataAlg.execute(Detail::CopyRunsImpl<T>(map, source, sink, numComps));
+}
+
+/**
+ * @brief Copies the tuples sources[0], sources[1], ... of source into the first
+ * sources.size() tuples of sink, for kept elements that are not in their original order
+ */
+template <typename T>
+void gatherTuples(const std::vector<size_t>& sources, const T* source, T* sink, size_t numComps)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, sources.size());
+  dataAlg.execute(Detail::GatherTuplesImpl<T>(sources, source, sink, numComps));
+}
+
+/**
+ * @brief Old to new index map of a compaction, holding k_Removed for removed elements
+ */
+inline std::vector<size_t> newIndices(const IndexMap& map)
+{
+  std::vector<size_t> indices(map.numElements, k_Removed);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, map.runs.size());
+  dataAlg.execute(Detail::NewIndicesImpl(map, indices.data()));
+  return indices;
+}
+
+/**
+ * @brief Replaces indices into the elements of a compaction, for example the vertices of
+ * compacted triangles, by the new indices of those elements; every index must refer to
+ * a kept element
+ */
+template <typename IndexType>
+void remapIndices(const IndexMap& map, IndexType* indices, size_t numIndices)
+{
+  std::vector<size_t> indexMap = newIndices(map);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numIndices);
+  dataAlg.execute(Detail::RemapIndicesImpl<IndexType>(indexMap, indices));
+}
+} // namespace StreamCompaction
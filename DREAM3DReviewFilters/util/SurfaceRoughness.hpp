@@ -0,0 +1,407 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Roughness of the boundary cells of an image, measured in the XY projection: a
+ * line y = a + b x is fitted to the cell centers by least squares, and the roughness
+ * parameters are taken from the perpendicular distances of the cells to that line. Lines
+ * and roughness are found for the whole image, for every feature and for sliding windows
+ * of planes along z (the build direction). The image is read twice, once to fit the lines
+ * and once for the distances, each time in parallel over slabs of z planes with running
+ * sums per group; no coordinates are collected.
+ */
+namespace SurfaceRoughness
+{
+/**
+ * @brief Least squares line fit of y on x from running centered sums
+ */
+struct LineFit
+{
+  uint64_t count = 0;
+  double meanX = 0.0;
+  double meanY = 0.0;
+  double ssxx = 0.0;
+  double ssxy = 0.0;
+
+  void add(double x, double y)
+  {
+    count++;
+    double dx = x - meanX;
+    meanX += dx / static_cast<double>(count);
+    meanY += (y - meanY) / static_cast<double>(count);
+    ssxx += dx * (x - meanX);
+    ssxy += dx * (y - meanY);
+  }
+
+  void merge(const LineFit& other)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(count == 0)
+    {
+      *this = other;
+      return;
+    }
+    double n = static_cast<double>(count + other.count);
+    double weight = static_cast<double>(count) * static_cast<double>(other.count) / n;
+    double dx = other.meanX - meanX;
+    double dy = other.meanY - meanY;
+    meanX += dx * static_cast<double>(other.count) / n;
+    meanY += dy * static_cast<double>(other.count) / n;
+    ssxx += other.ssxx + dx * dx * weight;
+    ssxy += other.ssxy + dx * dy * weight;
+    count += other.count;
+  }
+
+  /**
+   * @brief A line needs at least two cells at different x
+   */
+  bool valid() const
+  {
+    return count > 1 && ssxx > 0.0;
+  }
+
+  double slope() const
+  {
+    return valid() ? ssxy / ssxx : 0.0;
+  }
+
+  double intercept() const
+  {
+    return valid() ? meanY - slope() * meanX : 0.0;
+  }
+};
+
+/**
+ * @brief Fitted line in the form used for distances: the signed perpendicular distance
+ * of (x, y) is (y - a - b x) / sqrt(1 + b^2)
+ */
+struct Line
+{
+  bool valid = false;
+  double a = 0.0;
+  double b = 0.0;
+  double scale = 1.0;
+
+  Line() = default;
+
+  explicit Line(const LineFit& fit)
+  : valid(fit.valid())
+  , a(fit.intercept())
+  , b(fit.slope())
+  , scale(1.0 / std::sqrt(1.0 + fit.slope() * fit.slope()))
+  {
+  }
+
+  double distance(double x, double y) const
+  {
+    return (y - (a + b * x)) * scale;
+  }
+};
+
+/**
+ * @brief Running sums of the signed distances to a line
+ */
+struct Profile
+{
+  uint64_t count = 0;
+  double sumAbs = 0.0;
+  double sumSquares = 0.0;
+  double min = std::numeric_limits<double>::max();
+  double max = std::numeric_limits<double>::lowest();
+
+  void add(double distance)
+  {
+    count++;
+    sumAbs += std::abs(distance);
+    sumSquares += distance * distance;
+    min = std::min(min, distance);
+    max = std::max(max, distance);
+  }
+
+  void merge(const Profile& other)
+  {
+    count += other.count;
+    sumAbs += other.sumAbs;
+    sumSquares += other.sumSquares;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+
+  /**
+   * @brief Writes Ra (mean absolute distance), Rq (root mean square distance) and Rz
+   * (highest peak to lowest valley); all 0 without cells
+   */
+  void write(double* params) const
+  {
+    params[0] = count > 0 ? sumAbs / static_cast<double>(count) : 0.0;
+    params[1] = count > 0 ? std::sqrt(sumSquares / static_cast<double>(count)) : 0.0;
+    params[2] = count > 0 ? max - min : 0.0;
+  }
+};
+
+/**
+ * @brief Boundary cells of an image and the groups they are measured in
+ */
+struct Image
+{
+  std::array<size_t, 3> dims = {0, 0, 0};
+  std::array<float, 3> origin = {0.0f, 0.0f, 0.0f};
+  std::array<float, 3> spacing = {1.0f, 1.0f, 1.0f};
+  const int8_t* boundaryCells = nullptr;
+  // Optional; feature of every cell, in [0, numFeatures)
+  const int32_t* featureIds = nullptr;
+  size_t numFeatures = 0;
+  // Windows span the planes z - windowHalfWidth ... z + windowHalfWidth
+  bool windows = false;
+  size_t windowHalfWidth = 0;
+
+  /**
+   * @brief Cell center, as ImageGeom::getCoords computes it
+   */
+  double coord(size_t axis, size_t i) const
+  {
+    return static_cast<double>(i * spacing[axis] + origin[axis]) + 0.5 * spacing[axis];
+  }
+
+  size_t firstWindow(size_t z) const
+  {
+    return z > windowHalfWidth ? z - windowHalfWidth : 0;
+  }
+
+  size_t lastWindow(size_t z) const
+  {
+    return std::min(z + windowHalfWidth, dims[2] - 1);
+  }
+};
+
+/**
+ * @brief Results of one pass: one accumulator per plane (the image total is their
+ * merge), per feature and per window
+ */
+template <typename Accumulator>
+struct GroupSums
+{
+  std::vector<Accumulator> planes;
+  std::vector<Accumulator> features;
+  std::vector<Accumulator> windows;
+
+  Accumulator total() const
+  {
+    Accumulator sum;
+    for(const Accumulator& plane : planes)
+    {
+      sum.merge(plane);
+    }
+    return sum;
+  }
+};
+
+namespace Detail
+{
+/**
+ * @brief Slab partition of the z planes into at most k_MaxSlabs slabs. The number of slabs
+ * is further limited so the per feature partial sums of all slabs stay within a fixed
+ * budget. The partition only depends on the image, so the slab partials are merged in the
+ * same order on every machine.
+ */
+inline std::vector<size_t> slabBounds(const Image& image)
+{
+  constexpr size_t k_MaxSlabs = 64;
+  const size_t budget = size_t(1) << 24;
+  size_t numSlabs = std::min(image.dims[2], k_MaxSlabs);
+  numSlabs = std::max<size_t>(std::min(numSlabs, budget / (image.numFeatures + 1)), 1);
+  std::vector<size_t> bounds(numSlabs + 1);
+  for(size_t slab = 0; slab <= numSlabs; slab++)
+  {
+    bounds[slab] = (image.dims[2] * slab) / numSlabs;
+  }
+  return bounds;
+}
+
+/**
+ * @brief Partial sums of one slab. Planes belong to a single slab and are written
+ * directly; features and the windows that reach into the slab are kept per slab.
+ */
+template <typename Accumulator>
+struct SlabSums
+{
+  std::vector<Accumulator> features;
+  std::vector<Accumulator> windows;
+  size_t firstWindow = 0;
+};
+
+/**
+ * @brief Streams over the boundary cells of a range of slabs. For every cell, visit(plane,
+ * sums, z, feature, px, py) adds the cell center (px, py) to the accumulator of its plane
+ * and to the slab sums; feature is -1 without feature ids or for negative ids.
+ */
+template <typename Accumulator, typename VisitFunc>
+class SlabPassImpl
+{
+public:
+  SlabPassImpl(const Image& image, const std::vector<size_t>& bounds, const VisitFunc& visit, std::vector<Accumulator>& planes, std::vector<SlabSums<Accumulator>>& slabs)
+  : m_Image(image)
+  , m_Bounds(bounds)
+  , m_Visit(visit)
+  , m_Planes(planes)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t slab = range.min(); slab < range.max(); slab++)
+    {
+      SlabSums<Accumulator>& sums = m_Slabs[slab];
+      if(nullptr != m_Image.featureIds)
+      {
+        sums.features.assign(m_Image.numFeatures, Accumulator());
+      }
+      if(m_Image.windows && m_Bounds[slab] < m_Bounds[slab + 1])
+      {
+        sums.firstWindow = m_Image.firstWindow(m_Bounds[slab]);
+        sums.windows.assign(m_Image.lastWindow(m_Bounds[slab + 1] - 1) - sums.firstWindow + 1, Accumulator());
+      }
+      for(size_t z = m_Bounds[slab]; z < m_Bounds[slab + 1]; z++)
+      {
+        for(size_t y = 0; y < m_Image.dims[1]; y++)
+        {
+          double py = m_Image.coord(1, y);
+          size_t rowStart = (z * m_Image.dims[1] + y) * m_Image.dims[0];
+          for(size_t x = 0; x < m_Image.dims[0]; x++)
+          {
+            if(m_Image.boundaryCells[rowStart + x] <= 0)
+            {
+              continue;
+            }
+            int32_t feature = nullptr != m_Image.featureIds ? std::max(m_Image.featureIds[rowStart + x], -1) : -1;
+            m_Visit(m_Planes[z], sums, z, feature, m_Image.coord(0, x), py);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const Image& m_Image;
+  const std::vector<size_t>& m_Bounds;
+  const VisitFunc& m_Visit;
+  std::vector<Accumulator>& m_Planes;
+  std::vector<SlabSums<Accumulator>>& m_Slabs;
+};
+
+/**
+ * @brief Runs one pass over the image and merges the slab partials in slab order
+ */
+template <typename Accumulator, typename VisitFunc>
+GroupSums<Accumulator> slabPass(const Image& image, const VisitFunc& visit)
+{
+  std::vector<size_t> bounds = slabBounds(image);
+  size_t numSlabs = bounds.size() - 1;
+  GroupSums<Accumulator> result;
+  result.planes.assign(image.dims[2], Accumulator());
+  std::vector<SlabSums<Accumulator>> slabs(numSlabs);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute(SlabPassImpl<Accumulator, VisitFunc>(image, bounds, visit, result.planes, slabs));
+
+  if(nullptr != image.featureIds)
+  {
+    result.features.assign(image.numFeatures, Accumulator());
+  }
+  if(image.windows)
+  {
+    result.windows.assign(image.dims[2], Accumulator());
+  }
+  for(const SlabSums<Accumulator>& sums : slabs)
+  {
+    for(size_t f = 0; f < sums.features.size(); f++)
+    {
+      result.features[f].merge(sums.features[f]);
+    }
+    for(size_t w = 0; w < sums.windows.size(); w++)
+    {
+      result.windows[sums.firstWindow + w].merge(sums.windows[w]);
+    }
+  }
+  return result;
+}
+} // namespace Detail
+
+/**
+ * @brief Fits the lines of the image, of every feature and of every window. Window fits
+ * are merged from the plane fits, so only the features need partial sums.
+ */
+inline GroupSums<LineFit> fitLines(const Image& image)
+{
+  const auto visit = [](LineFit& plane, Detail::SlabSums<LineFit>& sums, size_t /* z */, int32_t feature, double px, double py) {
+    plane.add(px, py);
+    if(feature >= 0)
+    {
+      sums.features[feature].add(px, py);
+    }
+  };
+  Image planesOnly = image;
+  planesOnly.windows = false;
+  GroupSums<LineFit> fits = Detail::slabPass<LineFit>(planesOnly, visit);
+
+  if(image.windows)
+  {
+    fits.windows.assign(image.dims[2], LineFit());
+    for(size_t w = 0; w < image.dims[2]; w++)
+    {
+      for(size_t z = image.firstWindow(w); z <= image.lastWindow(w); z++)
+      {
+        fits.windows[w].merge(fits.planes[z]);
+      }
+    }
+  }
+  return fits;
+}
+
+/**
+ * @brief Measures the distances of the boundary cells to the fitted lines. The planes
+ * of the result are measured against the image line. Groups whose line cannot be fitted
+ * keep an empty profile.
+ */
+inline GroupSums<Profile> measureProfiles(const Image& image, const GroupSums<LineFit>& fits)
+{
+  Line imageLine(fits.total());
+  std::vector<Line> featureLines(fits.features.begin(), fits.features.end());
+  std::vector<Line> windowLines(fits.windows.begin(), fits.windows.end());
+
+  const auto visit = [&](Profile& plane, Detail::SlabSums<Profile>& sums, size_t z, int32_t feature, double px, double py) {
+    if(imageLine.valid)
+    {
+      plane.add(imageLine.distance(px, py));
+    }
+    if(feature >= 0 && featureLines[feature].valid)
+    {
+      sums.features[feature].add(featureLines[feature].distance(px, py));
+    }
+    if(image.windows)
+    {
+      for(size_t w = image.firstWindow(z); w <= image.lastWindow(z); w++)
+      {
+        if(windowLines[w].valid)
+        {
+          sums.windows[w - sums.firstWindow].add(windowLines[w].distance(px, py));
+        }
+      }
+    }
+  };
+  return Detail::slabPass<Profile>(image, visit);
+}
+} // namespace SurfaceRoughness
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Helpers for writing large ASCII (or binary) files. Elements are formatted
+ * in parallel, one chunk of elements per buffer, with std::to_chars; the buffers
+ * are then written in order with one large sequential write each.
+ */
+namespace TextFormattingHelpers
+{
+/**
+ * @brief Appends an integer in decimal notation
+ */
+template <typename T>
+void appendInteger(std::string& buffer, T value)
+{
+  std::array<char, 24> chars;
+  std::to_chars_result result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+  buffer.append(chars.data(), result.ptr);
+}
+
+/**
+ * @brief Appends a floating point value the way an std::ostream with the given
+ * precision formats it by default (%g)
+ */
+template <typename T>
+void appendGeneral(std::string& buffer, T value, int precision = 6)
+{
+  std::array<char, 64> chars;
+  std::to_chars_result result = std::to_chars(chars.data(), chars.data() + chars.size(), value, std::chars_format::general, precision);
+  buffer.append(chars.data(), result.ptr);
+}
+
+/**
+ * @brief Appends a floating point value with a fixed number of decimals
+ */
+template <typename T>
+void appendFixed(std::string& buffer, T value, int precision)
+{
+  // Fixed notation of very large values can exceed any local buffer
+  std::array<char, 128> chars;
+  std::to_chars_result result = std::to_chars(chars.data(), chars.data() + chars.size(), value, std::chars_format::fixed, precision);
+  if(result.ec != std::errc())
+  {
+    result = std::to_chars(chars.data(), chars.data() + chars.size(), value, std::chars_format::scientific, precision);
+  }
+  buffer.append(chars.data(), result.ptr);
+}
+
+/**
+ * @brief Appends the raw bytes of value; used for binary formats
+ */
+template <typename T>
+void appendBinary(std::string& buffer, T value)
+{
+  std::array<char, sizeof(T)> bytes;
+  std::memcpy(bytes.data(), &value, sizeof(T));
+  buffer.append(bytes.data(), bytes.size());
+}
+
+/**
+ * @brief Formats a range of chunks into their buffers
+ */
+template <typename FormatFunc>
+class FormatChunksImpl
+{
+public:
+  FormatChunksImpl(const FormatFunc& format, std::vector<std::string>& buffers, std::vector<char>& succeeded, size_t firstChunk, size_t chunkSize, size_t count)
+  : m_Format(format)
+  , m_Buffers(buffers)
+  , m_Succeeded(succeeded)
+  , m_FirstChunk(firstChunk)
+  , m_ChunkSize(chunkSize)
+  , m_Count(count)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      size_t start = (m_FirstChunk + i) * m_ChunkSize;
+      size_t end = std::min(start + m_ChunkSize, m_Count);
+      m_Buffers[i].clear();
+      m_Succeeded[i] = m_Format(start, end, m_Buffers[i]) ? 1 : 0;
+    }
+  }
+
+private:
+  const FormatFunc& m_Format;
+  std::vector<std::string>& m_Buffers;
+  std::vector<char>& m_Succeeded;
+  size_t m_FirstChunk = 0;
+  size_t m_ChunkSize = 0;
+  size_t m_Count = 0;
+};
+
+/**
+ * @brief Formats the elements [0, count) and hands the text to write in element order.
+ * The elements are split into chunks of chunkSize; a batch of chunks is formatted in
+ * parallel, written, and the buffers are reused for the next batch, so the memory
+ * used is bounded by the batch and not by count.
+ * @param count Number of elements
+ * @param chunkSize Number of elements formatted into one buffer
+ * @param format Callable bool(size_t start, size_t end, std::string& buffer) that
+ * appends the elements [start, end) to buffer; returning false aborts the output
+ * @param write Callable bool(const std::string& buffer) that writes one buffer
+ * @return false if formatting or writing failed
+ */
+template <typename FormatFunc, typename WriteFunc>
+bool writeChunks(size_t count, size_t chunkSize, const FormatFunc& format, const WriteFunc& write)
+{
+  chunkSize = std::max<size_t>(chunkSize, 1);
+  size_t numChunks = (count + chunkSize - 1) / chunkSize;
+  size_t batchSize = std::min<size_t>(numChunks, 4 * std::max(1U, std::thread::hardware_concurrency()));
+  std::vector<std::string> buffers(batchSize);
+  std::vector<char> succeeded(batchSize, 0);
+
+  for(size_t firstChunk = 0; firstChunk < numChunks; firstChunk += batchSize)
+  {
+    size_t batchChunks = std::min(batchSize, numChunks - firstChunk);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, batchChunks);
+    dataAlg.execute(FormatChunksImpl<FormatFunc>(format, buffers, succeeded, firstChunk, chunkSize, count));
+
+    for(size_t i = 0; i < batchChunks; i++)
+    {
+      if(succeeded[i] == 0 || !write(buffers[i]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // namespace TextFormattingHelpers
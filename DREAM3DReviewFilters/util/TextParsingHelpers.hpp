@@ -0,0 +1,353 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QFile>
+
+/**
+ * @brief Allocation free helpers for scanning large ASCII data files. The file is
+ * memory mapped, split into line aligned chunks that can be handed to separate
+ * threads, and numeric tokens are converted in place with std::from_chars.
+ */
+namespace TextParsingHelpers
+{
+/**
+ * @brief Read-only memory map of a complete file. The mapping is released when
+ * the object goes out of scope.
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const QString& filePath)
+  : m_File(filePath)
+  {
+    if(!m_File.open(QIODevice::ReadOnly))
+    {
+      return;
+    }
+    qint64 size = m_File.size();
+    if(size <= 0)
+    {
+      m_Valid = true;
+      return;
+    }
+    m_Data = m_File.map(0, size);
+    if(nullptr != m_Data)
+    {
+      m_Size = static_cast<size_t>(size);
+      m_Valid = true;
+    }
+  }
+
+  ~MappedFile()
+  {
+    if(nullptr != m_Data)
+    {
+      m_File.unmap(m_Data);
+    }
+  }
+
+  bool isValid() const
+  {
+    return m_Valid;
+  }
+
+  const char* begin() const
+  {
+    return reinterpret_cast<const char*>(m_Data);
+  }
+
+  const char* end() const
+  {
+    return begin() + m_Size;
+  }
+
+  size_t size() const
+  {
+    return m_Size;
+  }
+
+  MappedFile(const MappedFile&) = delete;            // Copy Constructor Not Implemented
+  MappedFile(MappedFile&&) = delete;                 // Move Constructor Not Implemented
+  MappedFile& operator=(const MappedFile&) = delete; // Copy Assignment Not Implemented
+  MappedFile& operator=(MappedFile&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  QFile m_File;
+  uchar* m_Data = nullptr;
+  size_t m_Size = 0;
+  bool m_Valid = false;
+};
+
+// -----------------------------------------------------------------------------
+inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// -----------------------------------------------------------------------------
+inline const char* skipBlanks(const char* p, const char* end)
+{
+  while(p < end && isBlank(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+inline const char* skipToken(const char* p, const char* end)
+{
+  while(p < end && !isBlank(*p) && *p != '\n')
+  {
+    ++p;
+  }
+  return p;
+}
+
+/**
+ * @brief Returns a pointer to the '\n' that ends the line starting at p, or end
+ */
+inline const char* findLineEnd(const char* p, const char* end)
+{
+  const void* nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+  return nullptr == nl ? end : static_cast<const char*>(nl);
+}
+
+/**
+ * @brief Returns a pointer to the first character of the line following p
+ */
+inline const char* nextLine(const char* p, const char* end)
+{
+  const char* lineEnd = findLineEnd(p, end);
+  return lineEnd == end ? end : lineEnd + 1;
+}
+
+/**
+ * @brief Returns true if [p, lineEnd) only contains white space
+ */
+inline bool isBlankLine(const char* p, const char* lineEnd)
+{
+  return skipBlanks(p, lineEnd) == lineEnd;
+}
+
+/**
+ * @brief Parses one numeric token starting at p (leading blanks are skipped).
+ * A leading '+' is accepted for compatibility with the *scanf family.
+ * @return Pointer one past the parsed token, or nullptr if no number could be read
+ */
+template <typename T>
+const char* parseNumber(const char* p, const char* end, T& value)
+{
+  p = skipBlanks(p, end);
+  if(p < end && *p == '+')
+  {
+    ++p;
+  }
+  std::from_chars_result result = std::from_chars(p, end, value);
+  if(result.ec != std::errc())
+  {
+    return nullptr;
+  }
+  if constexpr(std::is_integral_v<T>)
+  {
+    // Tolerate integers written with a fractional part ("1.0000") the same way
+    // a float conversion followed by a truncating cast would
+    if(result.ptr < end && (*result.ptr == '.' || *result.ptr == 'e' || *result.ptr == 'E'))
+    {
+      double tmp = 0.0;
+      result = std::from_chars(p, end, tmp);
+      if(result.ec != std::errc())
+      {
+        return nullptr;
+      }
+      value = static_cast<T>(tmp);
+    }
+  }
+  return result.ptr;
+}
+
+/**
+ * @brief Skips blanks and consumes the single character c
+ * @return Pointer one past c, or nullptr if the next non blank character is not c
+ */
+inline const char* expectChar(const char* p, const char* end, char c)
+{
+  p = skipBlanks(p, end);
+  if(p < end && *p == c)
+  {
+    return p + 1;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Returns true if the line starting at p (after leading blanks) begins with prefix
+ */
+inline bool startsWith(const char* p, const char* lineEnd, const char* prefix)
+{
+  p = skipBlanks(p, lineEnd);
+  size_t length = std::strlen(prefix);
+  return static_cast<size_t>(lineEnd - p) >= length && std::memcmp(p, prefix, length) == 0;
+}
+
+/**
+ * @brief Returns true if the first white space delimited token of the line equals word
+ */
+inline bool firstTokenEquals(const char* p, const char* lineEnd, const char* word)
+{
+  p = skipBlanks(p, lineEnd);
+  const char* tokenEnd = skipToken(p, lineEnd);
+  size_t length = std::strlen(word);
+  return static_cast<size_t>(tokenEnd - p) == length && std::memcmp(p, word, length) == 0;
+}
+
+/**
+ * @brief Returns a pointer to the start of the n-th (zero based) white space
+ * delimited token of the line, or nullptr if the line has fewer tokens
+ */
+inline const char* nthToken(const char* p, const char* lineEnd, size_t n)
+{
+  p = skipBlanks(p, lineEnd);
+  for(size_t i = 0; i < n && p < lineEnd; i++)
+  {
+    p = skipBlanks(skipToken(p, lineEnd), lineEnd);
+  }
+  return p < lineEnd ? p : nullptr;
+}
+
+/**
+ * @brief Sequential line reader over a memory mapped buffer. Lines are returned as
+ * [begin, end) ranges into the buffer without the trailing line break, so reading
+ * a line never allocates.
+ */
+class LineScanner
+{
+public:
+  LineScanner(const char* begin, const char* end)
+  : m_Cursor(begin)
+  , m_End(end)
+  {
+  }
+
+  bool atEnd() const
+  {
+    return m_Cursor >= m_End;
+  }
+
+  const char* position() const
+  {
+    return m_Cursor;
+  }
+
+  size_t lineNumber() const
+  {
+    return m_LineNumber;
+  }
+
+  /**
+   * @brief Advances to the next line
+   * @return false if the end of the buffer was already reached
+   */
+  bool readLine(const char*& lineBegin, const char*& lineEnd)
+  {
+    if(m_Cursor >= m_End)
+    {
+      return false;
+    }
+    lineBegin = m_Cursor;
+    lineEnd = findLineEnd(m_Cursor, m_End);
+    m_Cursor = lineEnd == m_End ? m_End : lineEnd + 1;
+    if(lineEnd > lineBegin && *(lineEnd - 1) == '\r')
+    {
+      --lineEnd;
+    }
+    m_LineNumber++;
+    return true;
+  }
+
+  /**
+   * @brief Skips the given number of lines
+   */
+  void skipLines(size_t count)
+  {
+    const char* lineBegin = nullptr;
+    const char* lineEnd = nullptr;
+    for(size_t i = 0; i < count && readLine(lineBegin, lineEnd); i++)
+    {
+    }
+  }
+
+private:
+  const char* m_Cursor = nullptr;
+  const char* m_End = nullptr;
+  size_t m_LineNumber = 0;
+};
+
+/**
+ * @brief Splits [begin, end) into at most numChunks pieces whose boundaries all
+ * fall on the first character of a line.
+ * @return The numChunks + 1 (or fewer) boundary pointers
+ */
+inline std::vector<const char*> splitIntoLineChunks(const char* begin, const char* end, size_t numChunks)
+{
+  std::vector<const char*> bounds;
+  bounds.push_back(begin);
+  if(numChunks == 0)
+  {
+    numChunks = 1;
+  }
+  size_t total = static_cast<size_t>(end - begin);
+  for(size_t i = 1; i < numChunks; i++)
+  {
+    const char* guess = begin + (total * i) / numChunks;
+    if(guess <= bounds.back())
+    {
+      continue;
+    }
+    // Move to the beginning of the next line so no line is split across chunks
+    const char* aligned = nextLine(guess - 1, end);
+    if(aligned > bounds.back() && aligned < end)
+    {
+      bounds.push_back(aligned);
+    }
+  }
+  bounds.push_back(end);
+  return bounds;
+}
+
+/**
+ * @brief Counts the lines in [begin, end) that contain at least one non blank character
+ */
+inline size_t countDataLines(const char* begin, const char* end)
+{
+  size_t count = 0;
+  const char* p = begin;
+  while(p < end)
+  {
+    const char* lineEnd = findLineEnd(p, end);
+    if(!isBlankLine(p, lineEnd))
+    {
+      count++;
+    }
+    p = lineEnd == end ? end : lineEnd + 1;
+  }
+  return count;
+}
+
+/**
+ * @brief Returns a reasonable number of chunks for parallel scanning of a buffer
+ * of the given size; small buffers are not split at all.
+ */
+inline size_t suggestedChunkCount(size_t numBytes)
+{
+  constexpr size_t k_BytesPerChunk = 4 * 1024 * 1024;
+  return numBytes / k_BytesPerChunk + 1;
+}
+} // namespace TextParsingHelpers
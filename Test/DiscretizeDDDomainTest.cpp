@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/DiscretizeDDDomain.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SegmentRasterization.hpp"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class DiscretizeDDDomainTest
+{
+  using Cell = std::array<int64_t, 3>;
+  using Point = std::array<double, 3>;
+
+  const QString k_EdgeDataContainerName = {"Dislocations"};
+  const QString k_DensityDataContainerName = {"Density"};
+  const QString k_CellAttributeMatrixName = {"CellData"};
+  const QString k_DensityArrayName = {"DislocationLineDensity"};
+
+public:
+  DiscretizeDDDomainTest() = default;
+  virtual ~DiscretizeDDDomainTest() = default;
+
+  // -----------------------------------------------------------------------------
+  std::map<Cell, double> traversePieces(const Point& p1, const Point& p2, const Cell& lo, const Cell& hi)
+  {
+    std::map<Cell, double> pieces;
+    SegmentRasterization::traverse(p1, p2, lo, hi, [&pieces](int64_t x, int64_t y, int64_t z, double t0, double t1) { pieces[{x, y, z}] += t1 - t0; });
+    return pieces;
+  }
+
+  // -----------------------------------------------------------------------------
+  std::map<Cell, double> samplePieces(const Point& p1, const Point& p2, const Cell& lo, const Cell& hi, size_t numSamples)
+  {
+    // The midpoints of numSamples equal pieces of the segment, each worth 1 / numSamples
+    std::map<Cell, double> pieces;
+    for(size_t i = 0; i < numSamples; i++)
+    {
+      double t = (static_cast<double>(i) + 0.5) / static_cast<double>(numSamples);
+      Cell cell = {0, 0, 0};
+      bool inside = true;
+      for(size_t a = 0; a < 3; a++)
+      {
+        cell[a] = static_cast<int64_t>(std::floor(p1[a] + t * (p2[a] - p1[a])));
+        inside = inside && cell[a] >= lo[a] && cell[a] < hi[a];
+      }
+      if(inside)
+      {
+        pieces[cell] += 1.0 / static_cast<double>(numSamples);
+      }
+    }
+    return pieces;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestTraverse()
+  {
+    const Cell lo = {0, 0, 0};
+    const Cell hi = {4, 3, 5};
+    const std::vector<std::array<Point, 2>> segments = {
+        // Axis aligned
+        {{{0.5, 0.5, 0.5}, {3.5, 0.5, 0.5}}},
+        {{{0.5, 2.5, 0.5}, {0.5, 0.5, 0.5}}},
+        {{{0.5, 0.5, 0.2}, {0.5, 0.5, 4.7}}},
+        {{{0.5, 1.0, 0.5}, {3.5, 1.0, 0.5}}},
+        // Diagonal
+        {{{0.2, 0.3, 0.1}, {3.7, 2.9, 4.6}}},
+        {{{3.9, 0.1, 4.9}, {0.1, 2.9, 0.2}}},
+        // Ending or starting exactly on a cell face, edge or corner
+        {{{0.5, 0.5, 0.5}, {2.0, 0.5, 0.5}}},
+        {{{3.0, 0.5, 0.5}, {1.0, 0.5, 0.5}}},
+        {{{2.0, 1.0, 1.0}, {3.5, 2.5, 2.5}}},
+        {{{1.0, 1.0, 1.0}, {3.0, 3.0, 3.0}}},
+        // Leaving or missing the volume
+        {{{-1.5, 0.5, 0.5}, {6.0, 1.5, 2.5}}},
+        {{{2.5, 1.5, -3.0}, {2.5, 1.5, 9.0}}},
+        {{{-2.0, -2.0, -2.0}, {-1.0, -1.0, -1.0}}},
+    };
+
+    // Each crossed cell face shifts the sampled lengths by at most 1 / numSamples
+    const size_t numSamples = 100000;
+    const double tolerance = 1.0E-4;
+    for(const std::array<Point, 2>& segment : segments)
+    {
+      std::map<Cell, double> traversed = traversePieces(segment[0], segment[1], lo, hi);
+      std::map<Cell, double> sampled = samplePieces(segment[0], segment[1], lo, hi, numSamples);
+      DREAM3D_REQUIRE_EQUAL(traversed.size(), sampled.size())
+      for(const auto& piece : traversed)
+      {
+        DREAM3D_REQUIRE(sampled.find(piece.first) != sampled.end())
+        DREAM3D_REQUIRED(std::abs(piece.second - sampled[piece.first]), <, tolerance)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  double windowLength(const Cell& cell, const std::array<Point, 2>& segment)
+  {
+    // Length of an axis aligned segment inside the window [c - 0.5, c + 1.5] of a unit spaced grid
+    double length = 1.0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      double begin = std::max(std::min(segment[0][a], segment[1][a]), static_cast<double>(cell[a]) - 0.5);
+      double end = std::min(std::max(segment[0][a], segment[1][a]), static_cast<double>(cell[a]) + 1.5);
+      if(end < begin)
+      {
+        return 0.0;
+      }
+      if(segment[0][a] != segment[1][a])
+      {
+        length = end - begin;
+      }
+    }
+    return length;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestDensity()
+  {
+    // Two unused vertices span the grid [0, 4]^3; a 2 micron cell gives a spacing of 1 and 4^3 cells
+    const std::vector<std::array<Point, 2>> segments = {
+        {{{0.5, 1.25, 1.25}, {3.5, 1.25, 1.25}}},
+        {{{2.75, 2.75, 0.25}, {2.75, 2.75, 0.75}}},
+    };
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_EdgeDataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    SharedVertexList::Pointer vertices = EdgeGeom::CreateSharedVertexList(2 + 2 * segments.size());
+    EdgeGeom::Pointer edgeGeom = EdgeGeom::CreateGeometry(segments.size(), vertices, SIMPL::Geometry::EdgeGeometry, true);
+    float* vertex = edgeGeom->getVertexPointer(0);
+    MeshIndexType* edge = edgeGeom->getEdgePointer(0);
+    for(size_t a = 0; a < 3; a++)
+    {
+      vertex[a] = 0.0f;
+      vertex[3 + a] = 4.0f;
+    }
+    for(size_t i = 0; i < segments.size(); i++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        vertex[3 * (2 + 2 * i) + a] = static_cast<float>(segments[i][0][a]);
+        vertex[3 * (3 + 2 * i) + a] = static_cast<float>(segments[i][1][a]);
+      }
+      edge[2 * i] = 2 + 2 * i;
+      edge[2 * i + 1] = 3 + 2 * i;
+    }
+    dc->setGeometry(edgeGeom);
+
+    DiscretizeDDDomain::Pointer filter = DiscretizeDDDomain::New();
+    filter->setDataContainerArray(dca);
+    filter->setEdgeDataContainerName({k_EdgeDataContainerName, "", ""});
+    filter->setCellSize({2.0f, 2.0f, 2.0f});
+    filter->setOutputDataContainerName({k_DensityDataContainerName, "", ""});
+    filter->setOutputAttributeMatrixName(k_CellAttributeMatrixName);
+    filter->setOutputArrayName(k_DensityArrayName);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    FloatArrayType::Pointer density = dca->getDataContainer(k_DensityDataContainerName)->getAttributeMatrix(k_CellAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>(k_DensityArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(density.get())
+    DREAM3D_REQUIRE_EQUAL(density->getNumberOfTuples(), 64)
+    DREAM3D_REQUIRE_EQUAL(density->getNumberOfComponents(), 1)
+
+    // The first segment has 1, 2, 2 and 1 microns in the windows along x; the second one has
+    // 0.5 and 0.25 microns in the windows along z. Both are counted once, in um / um^3 * 1e12
+    const double cellVolume = 8.0;
+    for(int64_t z = 0; z < 4; z++)
+    {
+      for(int64_t y = 0; y < 4; y++)
+      {
+        for(int64_t x = 0; x < 4; x++)
+        {
+          double length = 0.0;
+          for(const std::array<Point, 2>& segment : segments)
+          {
+            length += windowLength({x, y, z}, segment);
+          }
+          double expected = length / cellVolume * 1.0E12;
+          DREAM3D_REQUIRED(std::abs(density->getValue((z * 4 + y) * 4 + x) - expected), <=, 1.0E-5 * 1.0E12)
+        }
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### DiscretizeDDDomainTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTraverse())
+    DREAM3D_REGISTER_TEST(TestDensity())
+  }
+
+public:
+  DiscretizeDDDomainTest(const DiscretizeDDDomainTest&) = delete;            // Copy Constructor Not Implemented
+  DiscretizeDDDomainTest(DiscretizeDDDomainTest&&) = delete;                 // Move Constructor Not Implemented
+  DiscretizeDDDomainTest& operator=(const DiscretizeDDDomainTest&) = delete; // Copy Assignment Not Implemented
+  DiscretizeDDDomainTest& operator=(DiscretizeDDDomainTest&&) = delete;      // Move Assignment Not Implemented
+};
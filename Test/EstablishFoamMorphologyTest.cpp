@@ -31,6 +31,10 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QString>
@@ -50,6 +54,9 @@
 
 #include "UnitTestSupport.hpp"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/EstablishFoamMorphology.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/DistanceTransform.hpp"
+
 #include "DREAM3DReviewTestFileLocations.h"
 
 class EstablishFoamMorphologyTest
@@ -61,6 +68,8 @@ class EstablishFoamMorphologyTest
   const QString k_CellFeatureData2 = {"CellFeatureData2"};
   const QString k_Centroids = {"Centroids"};
   const QString k_Phases2 = {"Phases2"};
+  const QString k_CellData = {"CellData"};
+  const QString k_FeatureIds = {"FeatureIds"};
 
 public:
   EstablishFoamMorphologyTest() = default;
@@ -162,6 +171,121 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer runParallelPacking(int seed)
+  {
+    QString pipelineFile = UnitTest::PluginSourceDir + "/" + "ExamplePipelines/" + UnitTest::PluginName + "/" + "Open-Cell-Foam-Example.json";
+    JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+    FilterPipeline::Pointer pipeline = jsonReader->readPipelineFromFile(pipelineFile);
+    if(nullptr == pipeline.get())
+    {
+      return DataContainerArray::NullPointer();
+    }
+
+    // Only run the pipeline up to the packing, so no later filter draws random numbers
+    EstablishFoamMorphology::Pointer foam;
+    int32_t numFilters = 0;
+    for(const AbstractFilter::Pointer& filter : pipeline->getFilterContainer())
+    {
+      numFilters++;
+      foam = std::dynamic_pointer_cast<EstablishFoamMorphology>(filter);
+      if(nullptr != foam.get())
+      {
+        break;
+      }
+    }
+    if(nullptr == foam.get())
+    {
+      return DataContainerArray::NullPointer();
+    }
+    while(pipeline->size() > numFilters)
+    {
+      pipeline->popBack();
+    }
+    foam->setParallelPacking(true);
+    foam->setPackingSeed(seed);
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    if(pipeline->getErrorCode() < 0)
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParallelPackingReproducible()
+  {
+    // Two runs with the same seed must place every Feature on the same cells
+    DataContainerArray::Pointer dca1 = runParallelPacking(5489);
+    DataContainerArray::Pointer dca2 = runParallelPacking(5489);
+    DREAM3D_REQUIRE_VALID_POINTER(dca1.get())
+    DREAM3D_REQUIRE_VALID_POINTER(dca2.get())
+
+    Int32ArrayType::Pointer featureIds1 = dca1->getDataContainer(k_SyntheticVolumeDataContainer)->getAttributeMatrix(k_CellData)->getAttributeArrayAs<Int32ArrayType>(k_FeatureIds);
+    Int32ArrayType::Pointer featureIds2 = dca2->getDataContainer(k_SyntheticVolumeDataContainer)->getAttributeMatrix(k_CellData)->getAttributeArrayAs<Int32ArrayType>(k_FeatureIds);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds1.get())
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds2.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds1->getNumberOfTuples(), featureIds2->getNumberOfTuples())
+
+    size_t numCells = featureIds1->getNumberOfTuples();
+    size_t numDifferent = 0;
+    for(size_t i = 0; i < numCells; i++)
+    {
+      numDifferent += featureIds1->getValue(i) != featureIds2->getValue(i) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(numDifferent, 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestDistanceTransform()
+  {
+    // Compare against a brute force search on a small anisotropic grid
+    std::array<size_t, 3> dims = {9, 7, 5};
+    std::array<double, 3> spacing = {0.5, 1.0, 1.5};
+    size_t totalPoints = dims[0] * dims[1] * dims[2];
+    std::vector<size_t> seeds = {3, 40, 41, 150, 299};
+    const auto isSeed = [&seeds](size_t index) { return std::find(seeds.begin(), seeds.end(), index) != seeds.end(); };
+
+    std::vector<double> squaredDistances;
+    std::vector<int64_t> nearestSeeds;
+    DistanceTransform::computeSquared(dims, spacing, isSeed, squaredDistances, nearestSeeds);
+
+    const auto squaredDistance = [&](size_t a, size_t b) {
+      double dx = spacing[0] * (static_cast<double>(a % dims[0]) - static_cast<double>(b % dims[0]));
+      double dy = spacing[1] * (static_cast<double>((a / dims[0]) % dims[1]) - static_cast<double>((b / dims[0]) % dims[1]));
+      double dz = spacing[2] * (static_cast<double>(a / (dims[0] * dims[1])) - static_cast<double>(b / (dims[0] * dims[1])));
+      return dx * dx + dy * dy + dz * dz;
+    };
+
+    for(size_t i = 0; i < totalPoints; i++)
+    {
+      double expected = std::numeric_limits<double>::max();
+      for(size_t seed : seeds)
+      {
+        expected = std::min(expected, squaredDistance(i, seed));
+      }
+      DREAM3D_REQUIRE(std::abs(squaredDistances[i] - expected) < 1.0E-9)
+      DREAM3D_REQUIRE(isSeed(static_cast<size_t>(nearestSeeds[i])))
+      DREAM3D_REQUIRE(std::abs(squaredDistance(i, static_cast<size_t>(nearestSeeds[i])) - expected) < 1.0E-9)
+    }
+
+    // Without any seed every distance is infinite
+    DistanceTransform::computeSquared(dims, spacing, [](size_t) { return false; }, squaredDistances, nearestSeeds);
+    DREAM3D_REQUIRE(std::isinf(squaredDistances[0]))
+    DREAM3D_REQUIRE_EQUAL(nearestSeeds[totalPoints - 1], -1)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -172,8 +296,12 @@ public:
 
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
+    DREAM3D_REGISTER_TEST(TestDistanceTransform())
+
     DREAM3D_REGISTER_TEST(TestEstablishFoamMorphologyTest())
 
+    DREAM3D_REGISTER_TEST(TestParallelPackingReproducible())
+
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
@@ -0,0 +1,186 @@
+#include <array>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/ExtractInternalSurfacesFromTriangleGeometry.h"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class ExtractInternalSurfacesFromTriangleGeometryTest
+{
+  const QString k_TriangleDataContainerName = {"TriangleDataContainer"};
+  const QString k_InternalTrianglesName = {"InternalTriangles"};
+  const QString k_VertexAttributeMatrixName = {"VertexData"};
+  const QString k_FaceAttributeMatrixName = {"FaceData"};
+  const QString k_NodeTypesArrayName = {"NodeType"};
+  const QString k_VertexValuesArrayName = {"VertexValues"};
+  const QString k_FaceLabelsArrayName = {"FaceLabels"};
+
+public:
+  ExtractInternalSurfacesFromTriangleGeometryTest() = default;
+  virtual ~ExtractInternalSurfacesFromTriangleGeometryTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Seven vertices, of which vertex 3 lies on the outer surface, vertex 4 repeats the
+  // coordinates of vertex 1 and vertex 6 is not used; triangles 1, 3 and 4 are internal
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure()
+  {
+    const std::vector<std::array<float, 3>> coords = {{{0.0f, 0.0f, 0.0f}}, {{1.0f, 0.0f, 0.0f}}, {{0.0f, 1.0f, 0.0f}}, {{1.0f, 1.0f, 0.0f}},
+                                                      {{1.0f, 0.0f, 0.0f}}, {{0.0f, 0.0f, 1.0f}}, {{2.0f, 2.0f, 2.0f}}};
+    const std::vector<int8_t> nodeTypes = {2, 3, 4, 12, 2, 2, 2};
+    const std::vector<std::array<MeshIndexType, 3>> tris = {{{0, 1, 3}}, {{2, 5, 0}}, {{3, 2, 1}}, {{4, 0, 5}}, {{1, 2, 5}}};
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_TriangleDataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(coords.size());
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(tris.size(), vertices, SIMPL::Geometry::TriangleGeometry);
+    float* vertex = triangleGeom->getVertexPointer(0);
+    MeshIndexType* triangle = triangleGeom->getTriPointer(0);
+    for(size_t i = 0; i < coords.size(); i++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        vertex[3 * i + a] = coords[i][a];
+      }
+    }
+    for(size_t i = 0; i < tris.size(); i++)
+    {
+      for(size_t v = 0; v < 3; v++)
+      {
+        triangle[3 * i + v] = tris[i][v];
+      }
+    }
+    dc->setGeometry(triangleGeom);
+
+    AttributeMatrix::Pointer vertexAm = AttributeMatrix::New({coords.size()}, k_VertexAttributeMatrixName, AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAm);
+    Int8ArrayType::Pointer nodeTypesArray = Int8ArrayType::CreateArray(coords.size(), k_NodeTypesArrayName, true);
+    FloatArrayType::Pointer vertexValues = FloatArrayType::CreateArray(coords.size(), {2}, k_VertexValuesArrayName, true);
+    for(size_t i = 0; i < coords.size(); i++)
+    {
+      nodeTypesArray->setValue(i, nodeTypes[i]);
+      vertexValues->setComponent(i, 0, 10.0f * static_cast<float>(i));
+      vertexValues->setComponent(i, 1, 10.0f * static_cast<float>(i) + 1.0f);
+    }
+    vertexAm->addOrReplaceAttributeArray(nodeTypesArray);
+    vertexAm->addOrReplaceAttributeArray(vertexValues);
+
+    AttributeMatrix::Pointer faceAm = AttributeMatrix::New({tris.size()}, k_FaceAttributeMatrixName, AttributeMatrix::Type::Face);
+    dc->addOrReplaceAttributeMatrix(faceAm);
+    Int32ArrayType::Pointer faceLabels = Int32ArrayType::CreateArray(tris.size(), {2}, k_FaceLabelsArrayName, true);
+    for(size_t i = 0; i < tris.size(); i++)
+    {
+      faceLabels->setComponent(i, 0, static_cast<int32_t>(i));
+      faceLabels->setComponent(i, 1, -static_cast<int32_t>(i));
+    }
+    faceAm->addOrReplaceAttributeArray(faceLabels);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestExtract()
+  {
+    DataContainerArray::Pointer dca = createDataStructure();
+    ExtractInternalSurfacesFromTriangleGeometry::Pointer filter = ExtractInternalSurfacesFromTriangleGeometry::New();
+    filter->setDataContainerArray(dca);
+    filter->setTriangleDataContainerName({k_TriangleDataContainerName, "", ""});
+    filter->setNodeTypesArrayPath({k_TriangleDataContainerName, k_VertexAttributeMatrixName, k_NodeTypesArrayName});
+    filter->setInternalTrianglesName(k_InternalTrianglesName);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(k_InternalTrianglesName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    TriangleGeom::Pointer internalTris = dc->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(internalTris.get())
+
+    // Vertices are numbered in the order of first use, and vertices 1 and 4 are merged into
+    // the new vertex 3, which takes its data from vertex 4
+    const std::vector<size_t> vertSources = {2, 5, 0, 4};
+    const std::vector<size_t> triSources = {1, 3, 4};
+    const std::vector<std::array<MeshIndexType, 3>> expectedTris = {{{0, 1, 2}}, {{3, 2, 1}}, {{3, 0, 1}}};
+    DREAM3D_REQUIRE_EQUAL(internalTris->getNumberOfVertices(), vertSources.size())
+    DREAM3D_REQUIRE_EQUAL(internalTris->getNumberOfTris(), triSources.size())
+
+    TriangleGeom::Pointer tris = dca->getDataContainer(k_TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+    float* vertex = tris->getVertexPointer(0);
+    float* internalVertex = internalTris->getVertexPointer(0);
+    for(size_t i = 0; i < vertSources.size(); i++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        DREAM3D_REQUIRE_EQUAL(internalVertex[3 * i + a], vertex[3 * vertSources[i] + a])
+      }
+    }
+    MeshIndexType* internalTriangle = internalTris->getTriPointer(0);
+    for(size_t i = 0; i < expectedTris.size(); i++)
+    {
+      for(size_t v = 0; v < 3; v++)
+      {
+        DREAM3D_REQUIRE_EQUAL(internalTriangle[3 * i + v], expectedTris[i][v])
+      }
+    }
+
+    AttributeMatrix::Pointer vertexAm = dc->getAttributeMatrix(k_VertexAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(vertexAm.get())
+    DREAM3D_REQUIRE_EQUAL(vertexAm->getNumberOfTuples(), vertSources.size())
+    Int8ArrayType::Pointer nodeTypes = vertexAm->getAttributeArrayAs<Int8ArrayType>(k_NodeTypesArrayName);
+    FloatArrayType::Pointer vertexValues = vertexAm->getAttributeArrayAs<FloatArrayType>(k_VertexValuesArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(nodeTypes.get())
+    DREAM3D_REQUIRE_VALID_POINTER(vertexValues.get())
+    const std::vector<int8_t> expectedNodeTypes = {4, 2, 2, 2};
+    for(size_t i = 0; i < vertSources.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodeTypes->getValue(i), expectedNodeTypes[i])
+      DREAM3D_REQUIRE_EQUAL(vertexValues->getComponent(i, 0), 10.0f * static_cast<float>(vertSources[i]))
+      DREAM3D_REQUIRE_EQUAL(vertexValues->getComponent(i, 1), 10.0f * static_cast<float>(vertSources[i]) + 1.0f)
+    }
+
+    AttributeMatrix::Pointer faceAm = dc->getAttributeMatrix(k_FaceAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(faceAm.get())
+    DREAM3D_REQUIRE_EQUAL(faceAm->getNumberOfTuples(), triSources.size())
+    Int32ArrayType::Pointer faceLabels = faceAm->getAttributeArrayAs<Int32ArrayType>(k_FaceLabelsArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(faceLabels.get())
+    for(size_t i = 0; i < triSources.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(i, 0), static_cast<int32_t>(triSources[i]))
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(i, 1), -static_cast<int32_t>(triSources[i]))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### ExtractInternalSurfacesFromTriangleGeometryTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestExtract())
+  }
+
+public:
+  ExtractInternalSurfacesFromTriangleGeometryTest(const ExtractInternalSurfacesFromTriangleGeometryTest&) = delete;            // Copy Constructor Not Implemented
+  ExtractInternalSurfacesFromTriangleGeometryTest(ExtractInternalSurfacesFromTriangleGeometryTest&&) = delete;                 // Move Constructor Not Implemented
+  ExtractInternalSurfacesFromTriangleGeometryTest& operator=(const ExtractInternalSurfacesFromTriangleGeometryTest&) = delete; // Copy Assignment Not Implemented
+  ExtractInternalSurfacesFromTriangleGeometryTest& operator=(ExtractInternalSurfacesFromTriangleGeometryTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/FindArrayStatistics.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/GroupedStatistics.hpp"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/StatisticsHelpers.hpp"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class FindArrayStatisticsTest
+{
+  const QString k_DataContainerName = {"DataContainer"};
+  const QString k_AttributeMatrixName = {"CellData"};
+  const QString k_StatisticsMatrixName = {"Statistics"};
+  const QString k_DataArrayName = {"Data"};
+
+public:
+  FindArrayStatisticsTest() = default;
+  virtual ~FindArrayStatisticsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure(const std::vector<float>& values)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> tupleDims = {values.size()};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tupleDims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(values.size(), k_DataArrayName, true);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      (*data)[i] = values[i];
+    }
+    am->addOrReplaceAttributeArray(data);
+
+    // The whole array statistics go to an Attribute Matrix with a single tuple
+    AttributeMatrix::Pointer statsAm = AttributeMatrix::New({1}, k_StatisticsMatrixName, AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(statsAm);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  FindArrayStatistics::Pointer createFilter(const QString& percentiles, bool approximate, double compression)
+  {
+    FindArrayStatistics::Pointer filter = FindArrayStatistics::New();
+    filter->setSelectedArrayPath({k_DataContainerName, k_AttributeMatrixName, k_DataArrayName});
+    filter->setDestinationAttributeMatrix({k_DataContainerName, k_StatisticsMatrixName, ""});
+    filter->setComputeByIndex(false);
+    filter->setFindMedian(true);
+    filter->setFindPercentiles(true);
+    filter->setPercentiles(percentiles);
+    filter->setFindInterquartileRange(true);
+    filter->setUseApproximateQuantiles(approximate);
+    filter->setSketchCompression(compression);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestPreflight()
+  {
+    FindArrayStatistics::Pointer filter = createFilter("5, 105", false, 100.0);
+    filter->setDataContainerArray(createDataStructure({1.0f, 2.0f, 3.0f}));
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, -11004)
+
+    filter = createFilter(" , ", false, 100.0);
+    filter->setDataContainerArray(createDataStructure({1.0f, 2.0f, 3.0f}));
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, -11005)
+
+    filter = createFilter("5, 50, 95", true, 5.0);
+    filter->setDataContainerArray(createDataStructure({1.0f, 2.0f, 3.0f}));
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, -11006)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestExactQuantiles()
+  {
+    // The squares 1, 4, ..., 400, out of order. Percentile p lies at rank p * 20 / 100 - 0.5
+    std::vector<float> values(20);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      float root = static_cast<float>((i * 7) % 20 + 1);
+      values[i] = root * root;
+    }
+
+    DataContainerArray::Pointer dca = createDataStructure(values);
+    FindArrayStatistics::Pointer filter = createFilter("5, 50, 95", false, 100.0);
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    AttributeMatrix::Pointer am = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_StatisticsMatrixName);
+
+    FloatArrayType::Pointer percentiles = am->getAttributeArrayAs<FloatArrayType>("Percentiles");
+    DREAM3D_REQUIRE_VALID_POINTER(percentiles.get())
+    DREAM3D_REQUIRE_EQUAL(percentiles->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL((*percentiles)[0], 2.5f)
+    DREAM3D_REQUIRE_EQUAL((*percentiles)[1], 110.5f)
+    DREAM3D_REQUIRE_EQUAL((*percentiles)[2], 380.5f)
+
+    FloatArrayType::Pointer median = am->getAttributeArrayAs<FloatArrayType>("Median");
+    DREAM3D_REQUIRE_VALID_POINTER(median.get())
+    DREAM3D_REQUIRE_EQUAL((*median)[0], 110.5f)
+
+    // 240.5 - 30.5
+    FloatArrayType::Pointer iqr = am->getAttributeArrayAs<FloatArrayType>("InterquartileRange");
+    DREAM3D_REQUIRE_VALID_POINTER(iqr.get())
+    DREAM3D_REQUIRE_EQUAL((*iqr)[0], 210.0f)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestApproximateQuantiles()
+  {
+    // A permutation of 0 ... n - 1, so that a value error is also a rank error
+    const size_t numValues = 4000;
+    const double compression = 100.0;
+    std::vector<float> values(numValues);
+    for(size_t i = 0; i < numValues; i++)
+    {
+      values[i] = static_cast<float>((i * 7919) % numValues);
+    }
+
+    DataContainerArray::Pointer dca = createDataStructure(values);
+    FindArrayStatistics::Pointer filter = createFilter("5, 50, 95", true, compression);
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    AttributeMatrix::Pointer am = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_StatisticsMatrixName);
+    FloatArrayType::Pointer percentiles = am->getAttributeArrayAs<FloatArrayType>("Percentiles");
+    DREAM3D_REQUIRE_VALID_POINTER(percentiles.get())
+    FloatArrayType::Pointer median = am->getAttributeArrayAs<FloatArrayType>("Median");
+    DREAM3D_REQUIRE_VALID_POINTER(median.get())
+    FloatArrayType::Pointer iqr = am->getAttributeArrayAs<FloatArrayType>("InterquartileRange");
+    DREAM3D_REQUIRE_VALID_POINTER(iqr.get())
+
+    // The rank error of the sketch stays below 1 / compression of the values
+    const double bound = static_cast<double>(numValues) / compression;
+    const std::vector<double> fractions = {0.05, 0.5, 0.95};
+    for(size_t i = 0; i < fractions.size(); i++)
+    {
+      double exact = StatisticsHelpers::findPercentile(values, fractions[i]);
+      DREAM3D_REQUIRED(std::abs((*percentiles)[i] - exact), <=, bound)
+    }
+    DREAM3D_REQUIRED(std::abs((*median)[0] - StatisticsHelpers::findPercentile(values, 0.5)), <=, bound)
+
+    double exactIqr = StatisticsHelpers::findPercentile(values, 0.75) - StatisticsHelpers::findPercentile(values, 0.25);
+    DREAM3D_REQUIRED(std::abs((*iqr)[0] - exactIqr), <=, 2.0 * bound)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestStreamingStatistics()
+  {
+    // Enough values for several chunks; group 4 is out of range and every 7th value is masked out
+    const size_t numTuples = 300000;
+    const size_t numGroups = 4;
+    const int32_t numBins = 10;
+    std::vector<int32_t> values(numTuples);
+    std::vector<int32_t> groupIds(numTuples);
+    std::unique_ptr<bool[]> mask(new bool[numTuples]);
+    std::vector<std::vector<int32_t>> groups(numGroups);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      values[i] = static_cast<int32_t>((i * 7919) % 100);
+      groupIds[i] = static_cast<int32_t>((i * 31) % (numGroups + 1));
+      mask[i] = i % 7 != 0;
+      if(mask[i] && groupIds[i] < static_cast<int32_t>(numGroups))
+      {
+        groups[groupIds[i]].push_back(values[i]);
+      }
+    }
+
+    for(bool fullRange : {false, true})
+    {
+      std::vector<MeshIndexType> length(numGroups);
+      std::vector<int32_t> minimum(numGroups);
+      std::vector<int32_t> maximum(numGroups);
+      std::vector<float> mean(numGroups);
+      std::vector<float> stdDeviation(numGroups);
+      std::vector<float> summation(numGroups);
+      std::vector<float> histogram(numGroups * numBins);
+      GroupedStatistics::Outputs<int32_t> outputs;
+      outputs.length = length.data();
+      outputs.minimum = minimum.data();
+      outputs.maximum = maximum.data();
+      outputs.mean = mean.data();
+      outputs.stdDeviation = stdDeviation.data();
+      outputs.summation = summation.data();
+      outputs.histogram = histogram.data();
+      outputs.numBins = numBins;
+      outputs.histogramFullRange = fullRange;
+      outputs.histogramMin = 0.0f;
+      outputs.histogramMax = 100.0f;
+      GroupedStatistics::compute(values.data(), groupIds.data(), mask.get(), numTuples, numGroups, outputs);
+
+      // Serial reference over the values of every group
+      for(size_t g = 0; g < numGroups; g++)
+      {
+        const std::vector<int32_t>& group = groups[g];
+        DREAM3D_REQUIRE_EQUAL(length[g], group.size())
+        DREAM3D_REQUIRE_EQUAL(minimum[g], StatisticsHelpers::findMin(group))
+        DREAM3D_REQUIRE_EQUAL(maximum[g], StatisticsHelpers::findMax(group))
+        DREAM3D_REQUIRE_EQUAL(mean[g], StatisticsHelpers::findMean(group))
+        DREAM3D_REQUIRE_EQUAL(summation[g], static_cast<float>(StatisticsHelpers::findSummation(group)))
+        float expectedDeviation = StatisticsHelpers::findStdDeviation(group);
+        DREAM3D_REQUIRED(std::abs(stdDeviation[g] - expectedDeviation), <=, 1.0E-3f * expectedDeviation)
+
+        float rangeMin = fullRange ? static_cast<float>(minimum[g]) : outputs.histogramMin;
+        float rangeMax = fullRange ? static_cast<float>(maximum[g]) : outputs.histogramMax;
+        float increment = (rangeMax - rangeMin) / numBins;
+        std::vector<float> expectedBins(numBins, 0.0f);
+        for(int32_t value : group)
+        {
+          float position = (static_cast<float>(value) - rangeMin) / increment;
+          expectedBins[position < static_cast<float>(numBins) ? static_cast<size_t>(position) : numBins - 1]++;
+        }
+        for(int32_t b = 0; b < numBins; b++)
+        {
+          DREAM3D_REQUIRE_EQUAL(histogram[g * numBins + b], expectedBins[b])
+        }
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### FindArrayStatisticsTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPreflight())
+    DREAM3D_REGISTER_TEST(TestExactQuantiles())
+    DREAM3D_REGISTER_TEST(TestApproximateQuantiles())
+    DREAM3D_REGISTER_TEST(TestStreamingStatistics())
+  }
+
+public:
+  FindArrayStatisticsTest(const FindArrayStatisticsTest&) = delete;            // Copy Constructor Not Implemented
+  FindArrayStatisticsTest(FindArrayStatisticsTest&&) = delete;                 // Move Constructor Not Implemented
+  FindArrayStatisticsTest& operator=(const FindArrayStatisticsTest&) = delete; // Copy Assignment Not Implemented
+  FindArrayStatisticsTest& operator=(FindArrayStatisticsTest&&) = delete;      // Move Assignment Not Implemented
+};
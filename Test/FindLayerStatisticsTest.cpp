@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/LayerStatistics.hpp"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class FindLayerStatisticsTest
+{
+public:
+  FindLayerStatisticsTest() = default;
+  virtual ~FindLayerStatisticsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  size_t layerOf(size_t x, size_t y, size_t z, LayerStatistics::Plane plane)
+  {
+    return plane == LayerStatistics::Plane::XY ? z : (plane == LayerStatistics::Plane::XZ ? y : x);
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAgainstSerialReference()
+  {
+    // More z planes than slabs, and a share of values that are not positive and are skipped
+    const std::array<size_t, 3> dims = {7, 5, 150};
+    std::vector<float> values(dims[0] * dims[1] * dims[2]);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<float>((i * 7919) % 1000) - 100.0f;
+    }
+
+    const std::vector<LayerStatistics::Plane> planes = {LayerStatistics::Plane::XY, LayerStatistics::Plane::XZ, LayerStatistics::Plane::YZ};
+    for(LayerStatistics::Plane plane : planes)
+    {
+      // Serial two pass reference
+      size_t numLayers = LayerStatistics::numberOfLayers(dims, plane);
+      std::vector<std::vector<double>> layerValues(numLayers);
+      std::vector<int32_t> expectedIds(values.size());
+      for(size_t z = 0; z < dims[2]; z++)
+      {
+        for(size_t y = 0; y < dims[1]; y++)
+        {
+          for(size_t x = 0; x < dims[0]; x++)
+          {
+            size_t i = (z * dims[1] + y) * dims[0] + x;
+            size_t layer = layerOf(x, y, z, plane);
+            expectedIds[i] = static_cast<int32_t>(layer);
+            if(values[i] > 0)
+            {
+              layerValues[layer].push_back(values[i]);
+            }
+          }
+        }
+      }
+
+      // The whole volume at once, and the planes added out of order in uneven groups
+      LayerStatistics::Accumulator whole(dims, plane);
+      std::vector<int32_t> layerIds(values.size(), -1);
+      whole.addPlanes(values.data(), 0, dims[2], layerIds.data());
+      LayerStatistics::Accumulator pieces(dims, plane);
+      const std::vector<std::array<size_t, 2>> groups = {{100, 150}, {0, 37}, {37, 100}};
+      for(const std::array<size_t, 2>& group : groups)
+      {
+        pieces.addPlanes(values.data() + group[0] * dims[0] * dims[1], group[0], group[1]);
+      }
+
+      for(size_t i = 0; i < values.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(layerIds[i], expectedIds[i])
+      }
+      for(const LayerStatistics::Accumulator* accumulator : {&whole, &pieces})
+      {
+        const std::vector<LayerStatistics::Moments>& layers = accumulator->layers();
+        DREAM3D_REQUIRE_EQUAL(layers.size(), numLayers)
+        for(size_t layer = 0; layer < numLayers; layer++)
+        {
+          const std::vector<double>& expected = layerValues[layer];
+          double mean = 0.0;
+          double min = expected[0];
+          double max = expected[0];
+          for(double value : expected)
+          {
+            mean += value;
+            min = std::min(min, value);
+            max = std::max(max, value);
+          }
+          mean /= static_cast<double>(expected.size());
+          double variance = 0.0;
+          for(double value : expected)
+          {
+            variance += (value - mean) * (value - mean);
+          }
+          variance /= static_cast<double>(expected.size());
+
+          const LayerStatistics::Moments& moments = layers[layer];
+          DREAM3D_REQUIRE_EQUAL(moments.count, expected.size())
+          DREAM3D_REQUIRE_EQUAL(moments.min, min)
+          DREAM3D_REQUIRE_EQUAL(moments.max, max)
+          DREAM3D_REQUIRED(std::abs(moments.mean - mean), <=, 1.0E-10 * mean)
+          DREAM3D_REQUIRED(std::abs(moments.variance() - variance), <=, 1.0E-10 * variance)
+        }
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### FindLayerStatisticsTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAgainstSerialReference())
+  }
+
+public:
+  FindLayerStatisticsTest(const FindLayerStatisticsTest&) = delete;            // Copy Constructor Not Implemented
+  FindLayerStatisticsTest(FindLayerStatisticsTest&&) = delete;                 // Move Constructor Not Implemented
+  FindLayerStatisticsTest& operator=(const FindLayerStatisticsTest&) = delete; // Copy Assignment Not Implemented
+  FindLayerStatisticsTest& operator=(FindLayerStatisticsTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <string>
@@ -179,6 +180,9 @@ public:
     filter->setFindMedian(true);
     filter->setFindStdDeviation(true);
     filter->setFindSummation(true);
+    filter->setFindPercentiles(true);
+    filter->setPercentiles("25, 75");
+    filter->setFindInterquartileRange(true);
 
     filter->setDestinationAttributeMatrix({k_DataContainerName, k_AttributeMatrixName, ""});
 
@@ -256,6 +260,20 @@ public:
       DREAM3D_REQUIRE_EQUAL(k_SummationData[i], ((*sumArray)[i]))
     }
 
+    // List i holds 0 ... i, so percentile p is its rank p * (i + 1) / 100 - 0.5, clamped to the list
+    FloatArrayType::Pointer percentilesArray = am->getAttributeArrayAs<FloatArrayType>("Percentiles");
+    DREAM3D_REQUIRE_VALID_POINTER(percentilesArray.get())
+    FloatArrayType::Pointer iqrArray = am->getAttributeArrayAs<FloatArrayType>("InterquartileRange");
+    DREAM3D_REQUIRE_VALID_POINTER(iqrArray.get())
+    for(size_t i = 0; i < percentilesArray->getNumberOfTuples(); i++)
+    {
+      float q25 = std::min(std::max(0.25f * (i + 1) - 0.5f, 0.0f), i + 0.0f);
+      float q75 = std::min(std::max(0.75f * (i + 1) - 0.5f, 0.0f), i + 0.0f);
+      DREAM3D_REQUIRE_EQUAL(q25, percentilesArray->getComponent(i, 0))
+      DREAM3D_REQUIRE_EQUAL(q75, percentilesArray->getComponent(i, 1))
+      DREAM3D_REQUIRE_EQUAL(q75 - q25, ((*iqrArray)[i]))
+    }
+
     return EXIT_SUCCESS;
   }
 
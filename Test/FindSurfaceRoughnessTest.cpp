@@ -0,0 +1,154 @@
+#include <cmath>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/FindSurfaceRoughness.h"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class FindSurfaceRoughnessTest
+{
+  const QString k_DataContainerName = {"DataContainer"};
+  const QString k_CellAttributeMatrixName = {"CellData"};
+  const QString k_FeatureAttributeMatrixName = {"CellFeatureData"};
+  const QString k_RoughnessAttributeMatrixName = {"RoughnessData"};
+  const QString k_WindowAttributeMatrixName = {"RoughnessWindowData"};
+
+public:
+  FindSurfaceRoughnessTest() = default;
+  virtual ~FindSurfaceRoughnessTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // An 8 x 8 x 4 image whose boundary cells lie d cells above and below the diagonal
+  // y = x at x = 2 ... 5, with d = 1 on the planes z = 0, 1 and d = 2 on z = 2, 3. The
+  // cells above the diagonal are feature 1, the ones below feature 2.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(8, 8, 4));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New({8, 8, 4}, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAm);
+    Int8ArrayType::Pointer boundaryCells = Int8ArrayType::CreateArray(8 * 8 * 4, SIMPL::CellData::BoundaryCells, true);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(8 * 8 * 4, SIMPL::CellData::FeatureIds, true);
+    boundaryCells->initializeWithZeros();
+    featureIds->initializeWithZeros();
+    for(size_t z = 0; z < 4; z++)
+    {
+      size_t d = z < 2 ? 1 : 2;
+      for(size_t x = 2; x <= 5; x++)
+      {
+        size_t above = (z * 8 + x + d) * 8 + x;
+        size_t below = (z * 8 + x - d) * 8 + x;
+        boundaryCells->setValue(above, 1);
+        boundaryCells->setValue(below, 1);
+        featureIds->setValue(above, 1);
+        featureIds->setValue(below, 2);
+      }
+    }
+    cellAm->addOrReplaceAttributeArray(boundaryCells);
+    cellAm->addOrReplaceAttributeArray(featureIds);
+
+    dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({3}, k_FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature));
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int requireParams(const DoubleArrayType::Pointer& params, size_t tuple, double ra, double rq, double rz)
+  {
+    const double tolerance = 1.0E-9;
+    DREAM3D_REQUIRED(std::abs(params->getComponent(tuple, 0) - ra), <=, tolerance)
+    DREAM3D_REQUIRED(std::abs(params->getComponent(tuple, 1) - rq), <=, tolerance)
+    DREAM3D_REQUIRED(std::abs(params->getComponent(tuple, 2) - rz), <=, tolerance)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestSlopedLine()
+  {
+    DataContainerArray::Pointer dca = createDataStructure();
+    FindSurfaceRoughness::Pointer filter = FindSurfaceRoughness::New();
+    filter->setDataContainerArray(dca);
+    filter->setBoundaryCellsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::BoundaryCells});
+    filter->setAttributeMatrixName(k_RoughnessAttributeMatrixName);
+    filter->setRoughnessParamsArrayName("RoughnessParams");
+    filter->setComputeFeatureRoughness(true);
+    filter->setFeatureIdsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds});
+    filter->setFeatureRoughnessArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, "Roughness"});
+    filter->setComputeWindowedRoughness(true);
+    filter->setWindowSize(3);
+    filter->setWindowAttributeMatrixName(k_WindowAttributeMatrixName);
+    filter->setWindowRoughnessArrayName("WindowRoughness");
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataContainerName);
+    const double root2 = std::sqrt(2.0);
+
+    // Image: the fitted line is the diagonal, and half of the 32 cells lie 1 / sqrt(2) and
+    // half 2 / sqrt(2) from it. The parameters are Ra, the intercept and the slope.
+    DoubleArrayType::Pointer params = dc->getAttributeMatrix(k_RoughnessAttributeMatrixName)->getAttributeArrayAs<DoubleArrayType>("RoughnessParams");
+    DREAM3D_REQUIRE_VALID_POINTER(params.get())
+    DREAM3D_REQUIRED(std::abs(params->getValue(0) - 1.5 / root2), <=, 1.0E-9)
+    DREAM3D_REQUIRED(std::abs(params->getValue(1)), <=, 1.0E-9)
+    DREAM3D_REQUIRED(std::abs(params->getValue(2) - 1.0), <=, 1.0E-9)
+
+    // Features: each side is fitted by y = x +- 1.5, with its cells 0.5 / sqrt(2) from the
+    // line on either side; feature 0 has no boundary cells
+    DoubleArrayType::Pointer features = dc->getAttributeMatrix(k_FeatureAttributeMatrixName)->getAttributeArrayAs<DoubleArrayType>("Roughness");
+    DREAM3D_REQUIRE_VALID_POINTER(features.get())
+    DREAM3D_REQUIRE_EQUAL(requireParams(features, 0, 0.0, 0.0, 0.0), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(requireParams(features, 1, 0.5 / root2, 0.5 / root2, 1.0 / root2), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(requireParams(features, 2, 0.5 / root2, 0.5 / root2, 1.0 / root2), EXIT_SUCCESS)
+
+    // Windows of 3 planes, cut off at z = 0 and z = 3; every window line is the diagonal
+    DoubleArrayType::Pointer windows = dc->getAttributeMatrix(k_WindowAttributeMatrixName)->getAttributeArrayAs<DoubleArrayType>("WindowRoughness");
+    DREAM3D_REQUIRE_VALID_POINTER(windows.get())
+    DREAM3D_REQUIRE_EQUAL(windows->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(requireParams(windows, 0, 1.0 / root2, 1.0 / root2, root2), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(requireParams(windows, 1, 4.0 / 3.0 / root2, 1.0, 2.0 * root2), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(requireParams(windows, 2, 5.0 / 3.0 / root2, std::sqrt(1.5), 2.0 * root2), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(requireParams(windows, 3, root2, root2, 2.0 * root2), EXIT_SUCCESS)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### FindSurfaceRoughnessTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestSlopedLine())
+  }
+
+public:
+  FindSurfaceRoughnessTest(const FindSurfaceRoughnessTest&) = delete;            // Copy Constructor Not Implemented
+  FindSurfaceRoughnessTest(FindSurfaceRoughnessTest&&) = delete;                 // Move Constructor Not Implemented
+  FindSurfaceRoughnessTest& operator=(const FindSurfaceRoughnessTest&) = delete; // Copy Assignment Not Implemented
+  FindSurfaceRoughnessTest& operator=(FindSurfaceRoughnessTest&&) = delete;      // Move Assignment Not Implemented
+};
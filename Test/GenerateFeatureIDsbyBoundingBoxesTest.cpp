@@ -15,6 +15,9 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
@@ -62,11 +65,222 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // Two boxes with the feature ids 7 and 9 that are placed along x; both contain every y and
+  // z of the test geometries
+  // -----------------------------------------------------------------------------
+  void addBoxes(const DataContainer::Pointer& dc, float box0Center, float box0Size, float box1Center, float box1Size)
+  {
+    AttributeMatrix::Pointer boxes = AttributeMatrix::New({2}, "Boxes", AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(boxes);
+    FloatArrayType::Pointer centers = FloatArrayType::CreateArray(2, {3}, "BoxCenter", true);
+    FloatArrayType::Pointer dims = FloatArrayType::CreateArray(2, {3}, "BoxDims", true);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(2, "BoxFeatureIds", true);
+    float box0[6] = {box0Center, 2.0f, 0.0f, box0Size, 6.0f, 2.0f};
+    float box1[6] = {box1Center, 2.0f, 0.0f, box1Size, 6.0f, 2.0f};
+    for(size_t c = 0; c < 3; c++)
+    {
+      centers->setComponent(0, c, box0[c]);
+      dims->setComponent(0, c, box0[3 + c]);
+      centers->setComponent(1, c, box1[c]);
+      dims->setComponent(1, c, box1[3 + c]);
+    }
+    featureIds->setValue(0, 7);
+    featureIds->setValue(1, 9);
+    boxes->addOrReplaceAttributeArray(centers);
+    boxes->addOrReplaceAttributeArray(dims);
+    boxes->addOrReplaceAttributeArray(featureIds);
+  }
+
+  // -----------------------------------------------------------------------------
+  GenerateFeatureIDsbyBoundingBoxes::Pointer createFilter(const DataContainerArray::Pointer& dca)
+  {
+    GenerateFeatureIDsbyBoundingBoxes::Pointer filter = GenerateFeatureIDsbyBoundingBoxes::New();
+    filter->setDataContainerArray(dca);
+    filter->setFeatureIDsArrayPath({"Test", "AM", "FeatureIds"});
+    filter->setFeatureAttributeMatrixArrayPath({"Test", "Features", ""});
+    filter->setBoxCenterArrayPath({"Test", "Boxes", "BoxCenter"});
+    filter->setBoxDimensionsArrayPath({"Test", "Boxes", "BoxDims"});
+    filter->setBoxFeatureIDsArrayPath({"Test", "Boxes", "BoxFeatureIds"});
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestImageGeometry()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(10, 4, 1));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+    dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({10, 4, 1}, "AM", AttributeMatrix::Type::Cell));
+    addBoxes(dc, 3.0f, 4.0f, 5.0f, 6.0f);
+
+    GenerateFeatureIDsbyBoundingBoxes::Pointer filter = createFilter(dca);
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // Cells are sampled at x = 0 ... 9; box 0 holds x = 2 ... 4 and box 1 holds x = 3 ... 7
+    const std::vector<int32_t> expected = {0, 0, 7, 7, 7, 9, 9, 9, 0, 0};
+    Int32ArrayType::Pointer featureIds = dc->getAttributeMatrix("AM")->getAttributeArrayAs<Int32ArrayType>("FeatureIds");
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    for(size_t y = 0; y < 4; y++)
+    {
+      for(size_t x = 0; x < 10; x++)
+      {
+        DREAM3D_REQUIRE_EQUAL(featureIds->getValue(y * 10 + x), expected[x])
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(dc->getAttributeMatrix("Features")->getNumberOfTuples(), 3U)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createEdgeDataStructure(size_t numTuples)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+
+    // Vertices at x = 0, 2, 4 and 6; the edges have their midpoints at x = 1, 3, 5 and 3
+    SharedVertexList::Pointer vertices = EdgeGeom::CreateSharedVertexList(4);
+    EdgeGeom::Pointer edgeGeom = EdgeGeom::CreateGeometry(4, vertices, SIMPL::Geometry::EdgeGeometry, true);
+    float* vertex = edgeGeom->getVertexPointer(0);
+    MeshIndexType* edge = edgeGeom->getEdgePointer(0);
+    const MeshIndexType edgeVertices[8] = {0, 1, 1, 2, 2, 3, 0, 3};
+    for(size_t v = 0; v < 4; v++)
+    {
+      vertex[3 * v] = 2.0f * v;
+      vertex[3 * v + 1] = 0.0f;
+      vertex[3 * v + 2] = 0.0f;
+    }
+    for(size_t i = 0; i < 8; i++)
+    {
+      edge[i] = edgeVertices[i];
+    }
+    dc->setGeometry(edgeGeom);
+    dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({numTuples}, "AM", AttributeMatrix::Type::Edge));
+    addBoxes(dc, 3.0f, 2.0f, 3.0f, 6.0f);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestEdgeGeometry()
+  {
+    DataContainerArray::Pointer dca = createEdgeDataStructure(4);
+    GenerateFeatureIDsbyBoundingBoxes::Pointer filter = createFilter(dca);
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // Box 0 is (2, 4) and box 1 is (0, 6) along x, so the midpoints at x = 3 go to box 0
+    const std::vector<int32_t> expected = {9, 7, 9, 7};
+    Int32ArrayType::Pointer featureIds = dca->getDataContainer("Test")->getAttributeMatrix("AM")->getAttributeArrayAs<Int32ArrayType>("FeatureIds");
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expected[i])
+    }
+
+    // The Attribute Matrix must have one tuple per edge
+    filter = createFilter(createEdgeDataStructure(3));
+    filter->preflight();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, -5556)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestManyOverlappingBoxes()
+  {
+    // Boxes of 10 to 80 units centered in a 100 unit cube, so most points lie in many boxes and
+    // the points on the rim of the lattice in none
+    const size_t numBoxes = 500;
+    const size_t pointsPerAxis = 20;
+    const size_t numPoints = pointsPerAxis * pointsPerAxis * pointsPerAxis;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+    VertexGeom::Pointer vertexGeom = VertexGeom::CreateGeometry(static_cast<int64_t>(numPoints), SIMPL::Geometry::VertexGeometry, true);
+    float* vertex = vertexGeom->getVertexPointer(0);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      vertex[3 * i] = 8.3f * static_cast<float>(i % pointsPerAxis) - 30.0f;
+      vertex[3 * i + 1] = 8.3f * static_cast<float>((i / pointsPerAxis) % pointsPerAxis) - 30.0f;
+      vertex[3 * i + 2] = 8.3f * static_cast<float>(i / (pointsPerAxis * pointsPerAxis)) - 30.0f;
+    }
+    dc->setGeometry(vertexGeom);
+    dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({numPoints}, "AM", AttributeMatrix::Type::Vertex));
+
+    AttributeMatrix::Pointer boxes = AttributeMatrix::New({numBoxes}, "Boxes", AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(boxes);
+    FloatArrayType::Pointer centers = FloatArrayType::CreateArray(numBoxes, {3}, "BoxCenter", true);
+    FloatArrayType::Pointer dims = FloatArrayType::CreateArray(numBoxes, {3}, "BoxDims", true);
+    Int32ArrayType::Pointer boxFeatureIds = Int32ArrayType::CreateArray(numBoxes, "BoxFeatureIds", true);
+    uint32_t state = 12345;
+    const auto next = [&state](float lo, float hi) {
+      state = state * 1664525U + 1013904223U;
+      return lo + (hi - lo) * static_cast<float>(state >> 8) / static_cast<float>(1U << 24);
+    };
+    for(size_t k = 0; k < numBoxes; k++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        centers->setComponent(k, c, next(0.0f, 100.0f));
+        dims->setComponent(k, c, next(10.0f, 80.0f));
+      }
+      boxFeatureIds->setValue(k, static_cast<int32_t>(k + 1));
+    }
+    boxes->addOrReplaceAttributeArray(centers);
+    boxes->addOrReplaceAttributeArray(dims);
+    boxes->addOrReplaceAttributeArray(boxFeatureIds);
+
+    GenerateFeatureIDsbyBoundingBoxes::Pointer filter = createFilter(dca);
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // Brute force: the lowest numbered box that strictly contains the point
+    Int32ArrayType::Pointer featureIds = dc->getAttributeMatrix("AM")->getAttributeArrayAs<Int32ArrayType>("FeatureIds");
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    size_t numInside = 0;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      int32_t expected = 0;
+      for(size_t k = 0; k < numBoxes && expected == 0; k++)
+      {
+        bool inside = true;
+        for(size_t c = 0; c < 3; c++)
+        {
+          float lo = centers->getComponent(k, c) - dims->getComponent(k, c) / 2.0;
+          float hi = centers->getComponent(k, c) + dims->getComponent(k, c) / 2.0;
+          inside = inside && vertex[3 * i + c] > lo && vertex[3 * i + c] < hi;
+        }
+        expected = inside ? boxFeatureIds->getValue(k) : 0;
+      }
+      numInside += expected > 0 ? 1 : 0;
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expected)
+    }
+    DREAM3D_REQUIRED(numInside, >, numPoints / 2)
+    DREAM3D_REQUIRED(numInside, <, numPoints)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestGenerateFeatureIDsbyBoundingBoxesTest())
+    DREAM3D_REGISTER_TEST(TestImageGeometry())
+    DREAM3D_REGISTER_TEST(TestEdgeGeometry())
+    DREAM3D_REGISTER_TEST(TestManyOverlappingBoxes())
   }
 };
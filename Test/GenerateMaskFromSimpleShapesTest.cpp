@@ -15,6 +15,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
@@ -61,11 +62,67 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  int TestShapeIds()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(10, 1, 1));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+    dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({10, 1, 1}, "AM", AttributeMatrix::Type::Cell));
+
+    // Two overlapping boxes: box 0 spans x = (0.5, 3.5) and box 1 spans x = (2.5, 5.5)
+    AttributeMatrix::Pointer shapes = AttributeMatrix::New({2}, "Shapes", AttributeMatrix::Type::CellFeature);
+    dc->addOrReplaceAttributeMatrix(shapes);
+    FloatArrayType::Pointer centers = FloatArrayType::CreateArray(2, {3}, "Centers", true);
+    FloatArrayType::Pointer boxDims = FloatArrayType::CreateArray(2, {3}, "BoxDims", true);
+    const std::vector<float> centerValues = {2.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < centerValues.size(); i++)
+    {
+      (*centers)[i] = centerValues[i];
+      (*boxDims)[i] = (i % 3 == 0) ? 3.0f : 2.0f;
+    }
+    shapes->addOrReplaceAttributeArray(centers);
+    shapes->addOrReplaceAttributeArray(boxDims);
+
+    GenerateMaskFromSimpleShapes::Pointer filter = GenerateMaskFromSimpleShapes::New();
+    filter->setDataContainerArray(dca);
+    filter->setMaskShape(1);
+    filter->setMaskArrayPath(DataArrayPath("Test", "AM", "Mask"));
+    filter->setCentersArrayPath(DataArrayPath("Test", "Shapes", "Centers"));
+    filter->setBoxDimensionsArrayPath(DataArrayPath("Test", "Shapes", "BoxDims"));
+    filter->setCreateShapeIds(true);
+    filter->setShapeIdsArrayName("ShapeIds");
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // Cells are sampled at x = 0 ... 9; x = 3 lies in both boxes and keeps the lower id
+    const std::vector<int32_t> expected = {-1, 0, 0, 0, 1, 1, -1, -1, -1, -1};
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix("AM");
+    Int32ArrayType::Pointer shapeIds = am->getAttributeArrayAs<Int32ArrayType>("ShapeIds");
+    DREAM3D_REQUIRE_VALID_POINTER(shapeIds.get())
+    BoolArrayType::Pointer mask = am->getAttributeArrayAs<BoolArrayType>("Mask");
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t x = 0; x < expected.size(); x++)
+    {
+      DREAM3D_REQUIRE_EQUAL(shapeIds->getValue(x), expected[x])
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(x), expected[x] >= 0)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestGenerateMaskFromSimpleShapesTest())
+    DREAM3D_REGISTER_TEST(TestShapeIds())
   }
 };
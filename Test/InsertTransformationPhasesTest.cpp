@@ -0,0 +1,282 @@
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/PhaseType.h"
+#include "SIMPLib/Common/ShapeType.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Math/MatrixMath.h"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/InsertTransformationPhases.h"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class InsertTransformationPhasesTest
+{
+  const QString k_DataContainerName = {"DataContainer"};
+  const QString k_CellAttributeMatrixName = {"CellData"};
+  const QString k_FeatureAttributeMatrixName = {"CellFeatureData"};
+  const QString k_EnsembleAttributeMatrixName = {"CellEnsembleData"};
+  const size_t k_BlockSize = 10;
+  const size_t k_BlocksPerAxis = 3;
+  const float k_Misorientation = 60.0f;
+
+public:
+  InsertTransformationPhasesTest() = default;
+  virtual ~InsertTransformationPhasesTest() = default;
+
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    // QFile::remove(UnitTest::InsertTransformationPhasesTest::TestFile1);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Euler angles of the parent feature featureId; every feature gets its own orientation
+  // -----------------------------------------------------------------------------
+  OrientationF parentEulerAngles(size_t featureId)
+  {
+    return OrientationF(0.2f + 0.1f * featureId, 0.4f + 0.05f * featureId, 0.6f + 0.07f * featureId);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Cubes of k_BlockSize cells, every cube is a parent feature of phase 1
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+
+    size_t dim = k_BlockSize * k_BlocksPerAxis;
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(dim, dim, dim));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+
+    size_t numFeatures = k_BlocksPerAxis * k_BlocksPerAxis * k_BlocksPerAxis + 1;
+    std::vector<size_t> scalarDims(1, 1);
+    std::vector<size_t> cDims(1, 1);
+
+    std::vector<size_t> tupleDims = {dim, dim, dim};
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tupleDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tupleDims, scalarDims, SIMPL::CellData::FeatureIds, true);
+    Int32ArrayType::Pointer cellPhases = Int32ArrayType::CreateArray(tupleDims, scalarDims, SIMPL::CellData::Phases, true);
+    cDims[0] = 3;
+    FloatArrayType::Pointer cellEulerAngles = FloatArrayType::CreateArray(tupleDims, cDims, SIMPL::CellData::EulerAngles, true);
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          size_t cell = (z * dim + y) * dim + x;
+          size_t featureId = ((z / k_BlockSize) * k_BlocksPerAxis + y / k_BlockSize) * k_BlocksPerAxis + x / k_BlockSize + 1;
+          OrientationF euler = parentEulerAngles(featureId);
+          featureIds->setValue(cell, static_cast<int32_t>(featureId));
+          cellPhases->setValue(cell, 1);
+          cellEulerAngles->setComponent(cell, 0, euler[0]);
+          cellEulerAngles->setComponent(cell, 1, euler[1]);
+          cellEulerAngles->setComponent(cell, 2, euler[2]);
+        }
+      }
+    }
+    cellAttrMat->addOrReplaceAttributeArray(featureIds);
+    cellAttrMat->addOrReplaceAttributeArray(cellPhases);
+    cellAttrMat->addOrReplaceAttributeArray(cellEulerAngles);
+
+    tupleDims = {numFeatures};
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tupleDims, k_FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+    dc->addOrReplaceAttributeMatrix(featureAttrMat);
+    cDims[0] = 4;
+    FloatArrayType::Pointer avgQuats = FloatArrayType::CreateArray(tupleDims, cDims, SIMPL::FeatureData::AvgQuats, true);
+    cDims[0] = 3;
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(tupleDims, cDims, SIMPL::FeatureData::Centroids, true);
+    FloatArrayType::Pointer featureEulerAngles = FloatArrayType::CreateArray(tupleDims, cDims, SIMPL::FeatureData::EulerAngles, true);
+    FloatArrayType::Pointer equivalentDiameters = FloatArrayType::CreateArray(tupleDims, scalarDims, SIMPL::FeatureData::EquivalentDiameters, true);
+    Int32ArrayType::Pointer featurePhases = Int32ArrayType::CreateArray(tupleDims, scalarDims, SIMPL::FeatureData::Phases, true);
+    avgQuats->initializeWithZeros();
+    centroids->initializeWithZeros();
+    featureEulerAngles->initializeWithZeros();
+    equivalentDiameters->initializeWithZeros();
+    featurePhases->initializeWithZeros();
+    for(size_t featureId = 1; featureId < numFeatures; featureId++)
+    {
+      size_t block = featureId - 1;
+      OrientationF euler = parentEulerAngles(featureId);
+      QuatF quat = OrientationTransformation::eu2qu<OrientationF, QuatF>(euler);
+      for(size_t c = 0; c < 3; c++)
+      {
+        featureEulerAngles->setComponent(featureId, c, euler[c]);
+      }
+      for(size_t c = 0; c < 4; c++)
+      {
+        avgQuats->setComponent(featureId, c, quat[c]);
+      }
+      float halfBlock = 0.5f * static_cast<float>(k_BlockSize - 1);
+      centroids->setComponent(featureId, 0, static_cast<float>((block % k_BlocksPerAxis) * k_BlockSize) + halfBlock);
+      centroids->setComponent(featureId, 1, static_cast<float>(((block / k_BlocksPerAxis) % k_BlocksPerAxis) * k_BlockSize) + halfBlock);
+      centroids->setComponent(featureId, 2, static_cast<float>((block / (k_BlocksPerAxis * k_BlocksPerAxis)) * k_BlockSize) + halfBlock);
+      equivalentDiameters->setValue(featureId, static_cast<float>(k_BlockSize));
+      featurePhases->setValue(featureId, 1);
+    }
+    featureAttrMat->addOrReplaceAttributeArray(avgQuats);
+    featureAttrMat->addOrReplaceAttributeArray(centroids);
+    featureAttrMat->addOrReplaceAttributeArray(featureEulerAngles);
+    featureAttrMat->addOrReplaceAttributeArray(equivalentDiameters);
+    featureAttrMat->addOrReplaceAttributeArray(featurePhases);
+
+    tupleDims = {2};
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(tupleDims, k_EnsembleAttributeMatrixName, AttributeMatrix::Type::CellEnsemble);
+    dc->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(tupleDims, scalarDims, SIMPL::EnsembleData::CrystalStructures, true);
+    crystalStructures->setValue(0, EbsdLib::CrystalStructure::UnknownCrystalStructure);
+    crystalStructures->setValue(1, EbsdLib::CrystalStructure::Cubic_High);
+    DataArray<PhaseType::EnumType>::Pointer phaseTypes = DataArray<PhaseType::EnumType>::CreateArray(tupleDims, scalarDims, SIMPL::EnsembleData::PhaseTypes, true);
+    phaseTypes->setValue(0, static_cast<PhaseType::EnumType>(PhaseType::Type::Unknown));
+    phaseTypes->setValue(1, static_cast<PhaseType::EnumType>(PhaseType::Type::Primary));
+    DataArray<ShapeType::EnumType>::Pointer shapeTypes = DataArray<ShapeType::EnumType>::CreateArray(tupleDims, scalarDims, SIMPL::EnsembleData::ShapeTypes, true);
+    shapeTypes->setValue(0, static_cast<ShapeType::EnumType>(ShapeType::Type::Unknown));
+    shapeTypes->setValue(1, static_cast<ShapeType::EnumType>(ShapeType::Type::Ellipsoid));
+    Int32ArrayType::Pointer numFeaturesArray = Int32ArrayType::CreateArray(tupleDims, scalarDims, SIMPL::EnsembleData::NumFeatures, true);
+    numFeaturesArray->setValue(0, 0);
+    numFeaturesArray->setValue(1, static_cast<int32_t>(numFeatures - 1));
+    ensembleAttrMat->addOrReplaceAttributeArray(crystalStructures);
+    ensembleAttrMat->addOrReplaceAttributeArray(phaseTypes);
+    ensembleAttrMat->addOrReplaceAttributeArray(shapeTypes);
+    ensembleAttrMat->addOrReplaceAttributeArray(numFeaturesArray);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  InsertTransformationPhases::Pointer createFilter()
+  {
+    InsertTransformationPhases::Pointer filter = InsertTransformationPhases::New();
+    filter->setParentPhase(1);
+    filter->setTransCrystalStruct(EbsdLib::CrystalStructure::Cubic_High);
+    filter->setTransformationPhaseMisorientation(k_Misorientation);
+    filter->setTransformationPhaseHabitPlane(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    filter->setDefineHabitPlane(true);
+    filter->setUseAllVariants(false);
+    filter->setTransformationPhaseThickness(0.5f);
+    filter->setNumTransformationPhasesPerFeature(2);
+    filter->setPeninsulaFrac(0.0f);
+
+    filter->setStatsGenCellEnsembleAttributeMatrixPath({k_DataContainerName, k_EnsembleAttributeMatrixName, ""});
+    filter->setCellFeatureAttributeMatrixName({k_DataContainerName, k_FeatureAttributeMatrixName, ""});
+    filter->setFeatureIdsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds});
+    filter->setCellEulerAnglesArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::EulerAngles});
+    filter->setCellPhasesArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::Phases});
+    filter->setAvgQuatsArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, SIMPL::FeatureData::AvgQuats});
+    filter->setCentroidsArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, SIMPL::FeatureData::Centroids});
+    filter->setEquivalentDiametersArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, SIMPL::FeatureData::EquivalentDiameters});
+    filter->setFeatureEulerAnglesArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, SIMPL::FeatureData::EulerAngles});
+    filter->setFeaturePhasesArrayPath({k_DataContainerName, k_FeatureAttributeMatrixName, SIMPL::FeatureData::Phases});
+    filter->setFeatureParentIdsArrayName(SIMPL::FeatureData::ParentIds);
+    filter->setNumFeaturesPerParentArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::FeatureData::NumFeaturesPerParent});
+    filter->setCrystalStructuresArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures});
+    filter->setPhaseTypesArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::EnsembleData::PhaseTypes});
+    filter->setShapeTypesArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::EnsembleData::ShapeTypes});
+    filter->setNumFeaturesArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::EnsembleData::NumFeatures});
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every plate cell must hold the orientation of its parent rotated about the habit plane
+  // normal by the transformation phase misorientation, up to the cubic symmetry
+  // -----------------------------------------------------------------------------
+  int TestPlateOrientation()
+  {
+    InsertTransformationPhases::Pointer filter = createFilter();
+    DataContainerArray::Pointer dca = createDataStructure();
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    AttributeMatrix::Pointer cellAttrMat = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_CellAttributeMatrixName);
+    AttributeMatrix::Pointer featureAttrMat = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_FeatureAttributeMatrixName);
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    Int32ArrayType::Pointer cellPhases = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::Phases);
+    FloatArrayType::Pointer cellEulerAngles = cellAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    Int32ArrayType::Pointer parentIds = featureAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::FeatureData::ParentIds);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(cellPhases.get())
+    DREAM3D_REQUIRE_VALID_POINTER(cellEulerAngles.get())
+    DREAM3D_REQUIRE_VALID_POINTER(parentIds.get())
+
+    // rotation about the normalized (1, 1, 1) habit plane
+    float habitPlane = 1.0f / std::sqrt(3.0f);
+    float rotMat[3][3];
+    OrientationTransformation::ax2om<OrientationF, OrientationF>(OrientationF(habitPlane, habitPlane, habitPlane, k_Misorientation * static_cast<float>(SIMPLib::Constants::k_PiOver180D)))
+        .toGMatrix(rotMat);
+
+    std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+    LaueOps::Pointer cubicOps = orientationOps[EbsdLib::CrystalStructure::Cubic_High];
+    size_t numPlateCells = 0;
+    for(size_t cell = 0; cell < featureIds->getNumberOfTuples(); cell++)
+    {
+      if(cellPhases->getValue(cell) != 2)
+      {
+        continue;
+      }
+      numPlateCells++;
+      int32_t parentId = parentIds->getValue(static_cast<size_t>(featureIds->getValue(cell)));
+      DREAM3D_REQUIRED(parentId, >, 0)
+
+      float g[3][3];
+      float expectedMat[3][3];
+      OrientationTransformation::eu2om<OrientationF, OrientationF>(parentEulerAngles(static_cast<size_t>(parentId))).toGMatrix(g);
+      MatrixMath::Multiply3x3with3x3(rotMat, g, expectedMat);
+      QuatF expected = OrientationTransformation::om2qu<OrientationF, QuatF>(OrientationF(expectedMat));
+
+      OrientationF plateEuler(cellEulerAngles->getComponent(cell, 0), cellEulerAngles->getComponent(cell, 1), cellEulerAngles->getComponent(cell, 2));
+      QuatF plate = OrientationTransformation::eu2qu<OrientationF, QuatF>(plateEuler);
+
+      OrientationD axisAngle = cubicOps->calculateMisorientation(expected, plate);
+      DREAM3D_REQUIRED(axisAngle[3], <, 1.0E-2)
+    }
+    // a plate is placed in every parent unless the random plate count is 0 for all of them
+    DREAM3D_REQUIRED(numPlateCells, >, 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### InsertTransformationPhasesTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPlateOrientation())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  InsertTransformationPhasesTest(const InsertTransformationPhasesTest&) = delete;            // Copy Constructor Not Implemented
+  InsertTransformationPhasesTest(InsertTransformationPhasesTest&&) = delete;                 // Move Constructor Not Implemented
+  InsertTransformationPhasesTest& operator=(const InsertTransformationPhasesTest&) = delete; // Copy Assignment Not Implemented
+  InsertTransformationPhasesTest& operator=(InsertTransformationPhasesTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,129 @@
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/RemoveFlaggedVertices.h"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class RemoveFlaggedVerticesTest
+{
+  const QString k_VertexDataContainerName = {"VertexDataContainer"};
+  const QString k_ReducedVertexDataContainerName = {"ReducedVertexDataContainer"};
+  const QString k_VertexAttributeMatrixName = {"VertexData"};
+  const QString k_MaskArrayName = {"Mask"};
+  const QString k_VertexValuesArrayName = {"VertexValues"};
+
+public:
+  RemoveFlaggedVerticesTest() = default;
+  virtual ~RemoveFlaggedVerticesTest() = default;
+
+  // -----------------------------------------------------------------------------
+  int TestRemove()
+  {
+    // Flagged vertices at the start, in the middle and at the end, so the kept ones form
+    // several runs
+    const std::vector<bool> mask = {true, false, true, true, false, false, true, false, true};
+    const std::vector<size_t> keptVerts = {1, 4, 5, 7};
+    const size_t numVerts = mask.size();
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_VertexDataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    VertexGeom::Pointer vertexGeom = VertexGeom::CreateGeometry(static_cast<int64_t>(numVerts), SIMPL::Geometry::VertexGeometry, true);
+    float* vertex = vertexGeom->getVertexPointer(0);
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      vertex[3 * i] = static_cast<float>(i);
+      vertex[3 * i + 1] = 2.0f * static_cast<float>(i);
+      vertex[3 * i + 2] = -static_cast<float>(i);
+    }
+    dc->setGeometry(vertexGeom);
+
+    AttributeMatrix::Pointer vertexAm = AttributeMatrix::New({numVerts}, k_VertexAttributeMatrixName, AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAm);
+    DataArray<bool>::Pointer maskArray = DataArray<bool>::CreateArray(numVerts, k_MaskArrayName, true);
+    Int32ArrayType::Pointer vertexValues = Int32ArrayType::CreateArray(numVerts, {3}, k_VertexValuesArrayName, true);
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      maskArray->setValue(i, mask[i]);
+      for(size_t c = 0; c < 3; c++)
+      {
+        vertexValues->setComponent(i, c, static_cast<int32_t>(10 * i + c));
+      }
+    }
+    vertexAm->addOrReplaceAttributeArray(maskArray);
+    vertexAm->addOrReplaceAttributeArray(vertexValues);
+
+    RemoveFlaggedVertices::Pointer filter = RemoveFlaggedVertices::New();
+    filter->setDataContainerArray(dca);
+    filter->setVertexGeometry({k_VertexDataContainerName, "", ""});
+    filter->setMaskArrayPath({k_VertexDataContainerName, k_VertexAttributeMatrixName, k_MaskArrayName});
+    filter->setReducedVertexGeometry(k_ReducedVertexDataContainerName);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer reduced = dca->getDataContainer(k_ReducedVertexDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(reduced.get())
+    VertexGeom::Pointer reducedGeom = reduced->getGeometryAs<VertexGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(reducedGeom.get())
+    DREAM3D_REQUIRE_EQUAL(reducedGeom->getNumberOfVertices(), keptVerts.size())
+    float* reducedVertex = reducedGeom->getVertexPointer(0);
+    for(size_t i = 0; i < keptVerts.size(); i++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        DREAM3D_REQUIRE_EQUAL(reducedVertex[3 * i + a], vertex[3 * keptVerts[i] + a])
+      }
+    }
+
+    AttributeMatrix::Pointer reducedAm = reduced->getAttributeMatrix(k_VertexAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(reducedAm.get())
+    DREAM3D_REQUIRE_EQUAL(reducedAm->getNumberOfTuples(), keptVerts.size())
+    DataArray<bool>::Pointer reducedMask = reducedAm->getAttributeArrayAs<DataArray<bool>>(k_MaskArrayName);
+    Int32ArrayType::Pointer reducedValues = reducedAm->getAttributeArrayAs<Int32ArrayType>(k_VertexValuesArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(reducedMask.get())
+    DREAM3D_REQUIRE_VALID_POINTER(reducedValues.get())
+    for(size_t i = 0; i < keptVerts.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(reducedMask->getValue(i), false)
+      for(size_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(reducedValues->getComponent(i, c), static_cast<int32_t>(10 * keptVerts[i] + c))
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### RemoveFlaggedVerticesTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRemove())
+  }
+
+public:
+  RemoveFlaggedVerticesTest(const RemoveFlaggedVerticesTest&) = delete;            // Copy Constructor Not Implemented
+  RemoveFlaggedVerticesTest(RemoveFlaggedVerticesTest&&) = delete;                 // Move Constructor Not Implemented
+  RemoveFlaggedVerticesTest& operator=(const RemoveFlaggedVerticesTest&) = delete; // Copy Assignment Not Implemented
+  RemoveFlaggedVerticesTest& operator=(RemoveFlaggedVerticesTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,140 @@
+#include <array>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/RobustAutomaticThreshold.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/RobustThresholding.hpp"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class RobustAutomaticThresholdTest
+{
+  const QString k_DataContainerName = {"DataContainer"};
+  const QString k_AttributeMatrixName = {"CellData"};
+  const QString k_DataArrayName = {"Data"};
+  const QString k_MaskArrayName = {"Mask"};
+
+public:
+  RobustAutomaticThresholdTest() = default;
+  virtual ~RobustAutomaticThresholdTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // A 6 x 5 x 4 volume holding 10 for x < 3 and 50 for x >= 3
+  // -----------------------------------------------------------------------------
+  std::vector<float> stepValues()
+  {
+    std::vector<float> values(6 * 5 * 4);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = i % 6 < 3 ? 10.0f : 50.0f;
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestGlobalTiling()
+  {
+    // The tiles only split the slowest axis longer than 1, into no more than 64 tiles
+    RobustThresholding::Volume volume;
+    volume.dims = {6, 5, 4};
+    RobustThresholding::Tiling tiling = RobustThresholding::globalTiling(volume);
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[0], 1)
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[1], 1)
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[2], 4)
+
+    volume.dims = {6, 5, 1};
+    tiling = RobustThresholding::globalTiling(volume);
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[1], 5)
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[2], 1)
+
+    volume.dims = {100000, 1, 1};
+    tiling = RobustThresholding::globalTiling(volume);
+    DREAM3D_REQUIRE_EQUAL(tiling.numTiles[0], 64)
+    DREAM3D_REQUIRED(tiling.numTiles[0] * tiling.tileSize[0], >=, volume.dims[0])
+
+    // The global threshold does not depend on the tiling
+    std::vector<float> values = stepValues();
+    volume.dims = {6, 5, 4};
+    RobustThresholding::CentralDifference<float> gradient(values.data(), volume);
+    float tiled = RobustThresholding::globalThreshold(RobustThresholding::accumulate(values.data(), gradient, volume, RobustThresholding::globalTiling(volume)));
+    float single = RobustThresholding::globalThreshold(RobustThresholding::accumulate(values.data(), gradient, volume, RobustThresholding::Tiling(volume, volume.dims)));
+    DREAM3D_REQUIRE_EQUAL(tiled, single)
+    DREAM3D_REQUIRE_EQUAL(tiled, 30.0f)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestSmallVolume()
+  {
+    std::vector<float> values = stepValues();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(6, 5, 4));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({6, 5, 4}, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(values.size(), k_DataArrayName, true);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      (*data)[i] = values[i];
+    }
+    am->addOrReplaceAttributeArray(data);
+
+    RobustAutomaticThreshold::Pointer filter = RobustAutomaticThreshold::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputArrayPath({k_DataContainerName, k_AttributeMatrixName, k_DataArrayName});
+    filter->setFeatureIdsArrayPath({k_DataContainerName, k_AttributeMatrixName, k_MaskArrayName});
+    filter->setGradientSource(1);
+    filter->setUseLocalThresholds(false);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    // The gradient only lives on the planes x = 2 and x = 3, so the threshold is (10 + 50) / 2
+    DataArray<bool>::Pointer mask = am->getAttributeArrayAs<DataArray<bool>>(k_MaskArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), i % 6 >= 3)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### RobustAutomaticThresholdTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestGlobalTiling())
+    DREAM3D_REGISTER_TEST(TestSmallVolume())
+  }
+
+public:
+  RobustAutomaticThresholdTest(const RobustAutomaticThresholdTest&) = delete;            // Copy Constructor Not Implemented
+  RobustAutomaticThresholdTest(RobustAutomaticThresholdTest&&) = delete;                 // Move Constructor Not Implemented
+  RobustAutomaticThresholdTest& operator=(const RobustAutomaticThresholdTest&) = delete; // Copy Assignment Not Implemented
+  RobustAutomaticThresholdTest& operator=(RobustAutomaticThresholdTest&&) = delete;      // Move Assignment Not Implemented
+};